@@ -0,0 +1,218 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/src/libzueci/zueci.c" "core/CMakeFiles/ZXing.dir/src/libzueci/zueci.c.o" "gcc" "core/CMakeFiles/ZXing.dir/src/libzueci/zueci.c.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx.cxx" "core/CMakeFiles/ZXing.dir/cmake_pch.hxx.gch" "gcc" "core/CMakeFiles/ZXing.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/cmake_pch.hxx.gch" "gcc" "core/CMakeFiles/ZXing.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/core/src/Barcode.cpp" "core/CMakeFiles/ZXing.dir/src/Barcode.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/Barcode.cpp.o.d"
+  "/root/repo/core/src/BarcodeFormat.cpp" "core/CMakeFiles/ZXing.dir/src/BarcodeFormat.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BarcodeFormat.cpp.o.d"
+  "/root/repo/core/src/BinaryBitmap.cpp" "core/CMakeFiles/ZXing.dir/src/BinaryBitmap.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BinaryBitmap.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/BinaryBitmap.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BinaryBitmap.cpp.o.d"
+  "/root/repo/core/src/BitArray.cpp" "core/CMakeFiles/ZXing.dir/src/BitArray.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitArray.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/BitArray.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitArray.cpp.o.d"
+  "/root/repo/core/src/BitMatrix.cpp" "core/CMakeFiles/ZXing.dir/src/BitMatrix.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitMatrix.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/BitMatrix.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitMatrix.cpp.o.d"
+  "/root/repo/core/src/BitMatrixIO.cpp" "core/CMakeFiles/ZXing.dir/src/BitMatrixIO.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitMatrixIO.cpp.o.d"
+  "/root/repo/core/src/BitSource.cpp" "core/CMakeFiles/ZXing.dir/src/BitSource.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitSource.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/BitSource.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/BitSource.cpp.o.d"
+  "/root/repo/core/src/CharacterSet.cpp" "core/CMakeFiles/ZXing.dir/src/CharacterSet.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/CharacterSet.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/CharacterSet.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/CharacterSet.cpp.o.d"
+  "/root/repo/core/src/ConcentricCandidates.cpp" "core/CMakeFiles/ZXing.dir/src/ConcentricCandidates.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ConcentricCandidates.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ConcentricCandidates.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ConcentricCandidates.cpp.o.d"
+  "/root/repo/core/src/ConcentricFinder.cpp" "core/CMakeFiles/ZXing.dir/src/ConcentricFinder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ConcentricFinder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ConcentricFinder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ConcentricFinder.cpp.o.d"
+  "/root/repo/core/src/Content.cpp" "core/CMakeFiles/ZXing.dir/src/Content.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/Content.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/Content.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/Content.cpp.o.d"
+  "/root/repo/core/src/ECI.cpp" "core/CMakeFiles/ZXing.dir/src/ECI.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ECI.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ECI.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ECI.cpp.o.d"
+  "/root/repo/core/src/Error.cpp" "core/CMakeFiles/ZXing.dir/src/Error.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/Error.cpp.o.d"
+  "/root/repo/core/src/GTIN.cpp" "core/CMakeFiles/ZXing.dir/src/GTIN.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GTIN.cpp.o.d"
+  "/root/repo/core/src/GenericGF.cpp" "core/CMakeFiles/ZXing.dir/src/GenericGF.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GenericGF.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/GenericGF.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GenericGF.cpp.o.d"
+  "/root/repo/core/src/GenericGFPoly.cpp" "core/CMakeFiles/ZXing.dir/src/GenericGFPoly.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GenericGFPoly.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/GenericGFPoly.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GenericGFPoly.cpp.o.d"
+  "/root/repo/core/src/GlobalHistogramBinarizer.cpp" "core/CMakeFiles/ZXing.dir/src/GlobalHistogramBinarizer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GlobalHistogramBinarizer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/GlobalHistogramBinarizer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GlobalHistogramBinarizer.cpp.o.d"
+  "/root/repo/core/src/GridSampler.cpp" "core/CMakeFiles/ZXing.dir/src/GridSampler.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GridSampler.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/GridSampler.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/GridSampler.cpp.o.d"
+  "/root/repo/core/src/HRI.cpp" "core/CMakeFiles/ZXing.dir/src/HRI.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/HRI.cpp.o.d"
+  "/root/repo/core/src/HybridBinarizer.cpp" "core/CMakeFiles/ZXing.dir/src/HybridBinarizer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/HybridBinarizer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/HybridBinarizer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/HybridBinarizer.cpp.o.d"
+  "/root/repo/core/src/JSON.cpp" "core/CMakeFiles/ZXing.dir/src/JSON.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/JSON.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/JSON.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/JSON.cpp.o.d"
+  "/root/repo/core/src/MultiFormatReader.cpp" "core/CMakeFiles/ZXing.dir/src/MultiFormatReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/MultiFormatReader.cpp.o.d"
+  "/root/repo/core/src/MultiFormatWriter.cpp" "core/CMakeFiles/ZXing.dir/src/MultiFormatWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/MultiFormatWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/MultiFormatWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/MultiFormatWriter.cpp.o.d"
+  "/root/repo/core/src/PerspectiveTransform.cpp" "core/CMakeFiles/ZXing.dir/src/PerspectiveTransform.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/PerspectiveTransform.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/PerspectiveTransform.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/PerspectiveTransform.cpp.o.d"
+  "/root/repo/core/src/ReadBarcode.cpp" "core/CMakeFiles/ZXing.dir/src/ReadBarcode.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ReadBarcode.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ReadBarcode.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ReadBarcode.cpp.o.d"
+  "/root/repo/core/src/ReedSolomonDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/ReedSolomonDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ReedSolomonDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ReedSolomonDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ReedSolomonDecoder.cpp.o.d"
+  "/root/repo/core/src/ReedSolomonEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/ReedSolomonEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ReedSolomonEncoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ReedSolomonEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ReedSolomonEncoder.cpp.o.d"
+  "/root/repo/core/src/ResultPoint.cpp" "core/CMakeFiles/ZXing.dir/src/ResultPoint.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ResultPoint.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ResultPoint.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ResultPoint.cpp.o.d"
+  "/root/repo/core/src/TextDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/TextDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/TextDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/TextDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/TextDecoder.cpp.o.d"
+  "/root/repo/core/src/TextEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/TextEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/TextEncoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/TextEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/TextEncoder.cpp.o.d"
+  "/root/repo/core/src/TextUtfEncoding.cpp" "core/CMakeFiles/ZXing.dir/src/TextUtfEncoding.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/TextUtfEncoding.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/TextUtfEncoding.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/TextUtfEncoding.cpp.o.d"
+  "/root/repo/core/src/ThreadPool.cpp" "core/CMakeFiles/ZXing.dir/src/ThreadPool.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/ThreadPool.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/core/src/Utf.cpp" "core/CMakeFiles/ZXing.dir/src/Utf.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/Utf.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/Utf.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/Utf.cpp.o.d"
+  "/root/repo/core/src/WhiteRectDetector.cpp" "core/CMakeFiles/ZXing.dir/src/WhiteRectDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/WhiteRectDetector.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/WhiteRectDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/WhiteRectDetector.cpp.o.d"
+  "/root/repo/core/src/WriteBarcode.cpp" "core/CMakeFiles/ZXing.dir/src/WriteBarcode.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/WriteBarcode.cpp.o.d"
+  "/root/repo/core/src/ZXingCpp.cpp" "core/CMakeFiles/ZXing.dir/src/ZXingCpp.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/ZXingCpp.cpp.o.d"
+  "/root/repo/core/src/aztec/AZDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/aztec/AZDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZDecoder.cpp.o.d"
+  "/root/repo/core/src/aztec/AZDetector.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZDetector.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/aztec/AZDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZDetector.cpp.o.d"
+  "/root/repo/core/src/aztec/AZEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZEncoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/aztec/AZEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZEncoder.cpp.o.d"
+  "/root/repo/core/src/aztec/AZHighLevelEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZHighLevelEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZHighLevelEncoder.cpp.o.d"
+  "/root/repo/core/src/aztec/AZReader.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/aztec/AZReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZReader.cpp.o.d"
+  "/root/repo/core/src/aztec/AZToken.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZToken.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZToken.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/aztec/AZToken.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZToken.cpp.o.d"
+  "/root/repo/core/src/aztec/AZWriter.cpp" "core/CMakeFiles/ZXing.dir/src/aztec/AZWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/aztec/AZWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/aztec/AZWriter.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMBitLayout.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMBitLayout.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMBitLayout.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMBitLayout.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMBitLayout.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMDataBlock.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDataBlock.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDataBlock.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDecoder.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMDetector.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDetector.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMDetector.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMECEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMECEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMECEncoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMECEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMECEncoder.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMHighLevelEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMHighLevelEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMHighLevelEncoder.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMReader.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMReader.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMSymbolInfo.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMSymbolInfo.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMSymbolInfo.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMSymbolInfo.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMSymbolInfo.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMVersion.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMVersion.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMVersion.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMVersion.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMVersion.cpp.o.d"
+  "/root/repo/core/src/datamatrix/DMWriter.cpp" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/datamatrix/DMWriter.cpp.o.d"
+  "/root/repo/core/src/maxicode/MCBitMatrixParser.cpp" "core/CMakeFiles/ZXing.dir/src/maxicode/MCBitMatrixParser.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/maxicode/MCBitMatrixParser.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/maxicode/MCBitMatrixParser.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/maxicode/MCBitMatrixParser.cpp.o.d"
+  "/root/repo/core/src/maxicode/MCDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/maxicode/MCDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/maxicode/MCDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/maxicode/MCDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/maxicode/MCDecoder.cpp.o.d"
+  "/root/repo/core/src/maxicode/MCReader.cpp" "core/CMakeFiles/ZXing.dir/src/maxicode/MCReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/maxicode/MCReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/maxicode/MCReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/maxicode/MCReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODCodabarReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODCodabarWriter.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCodabarWriter.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode128Patterns.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Patterns.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Patterns.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Patterns.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Patterns.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode128Reader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Reader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Reader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Reader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Reader.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode128Writer.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Writer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode128Writer.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode39Reader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Reader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Reader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Reader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Reader.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode39Writer.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Writer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode39Writer.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode93Reader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Reader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Reader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Reader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Reader.cpp.o.d"
+  "/root/repo/core/src/oned/ODCode93Writer.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Writer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODCode93Writer.cpp.o.d"
+  "/root/repo/core/src/oned/ODDXFilmEdgeReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODDXFilmEdgeReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDXFilmEdgeReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODDXFilmEdgeReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDXFilmEdgeReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODDataBarCommon.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarCommon.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarCommon.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarCommon.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarCommon.cpp.o.d"
+  "/root/repo/core/src/oned/ODDataBarExpandedBitDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedBitDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedBitDecoder.cpp.o.d"
+  "/root/repo/core/src/oned/ODDataBarExpandedReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODDataBarLimitedReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarLimitedReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarLimitedReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarLimitedReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarLimitedReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODDataBarReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODDataBarReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODEAN13Writer.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN13Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN13Writer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN13Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN13Writer.cpp.o.d"
+  "/root/repo/core/src/oned/ODEAN8Writer.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN8Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN8Writer.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN8Writer.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODEAN8Writer.cpp.o.d"
+  "/root/repo/core/src/oned/ODITFReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODITFReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODITFReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODITFReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODITFReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODITFWriter.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODITFWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODITFWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODITFWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODITFWriter.cpp.o.d"
+  "/root/repo/core/src/oned/ODMultiUPCEANReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODMultiUPCEANReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODMultiUPCEANReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODMultiUPCEANReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODMultiUPCEANReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODReader.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODReader.cpp.o.d"
+  "/root/repo/core/src/oned/ODUPCAWriter.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCAWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCAWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCAWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCAWriter.cpp.o.d"
+  "/root/repo/core/src/oned/ODUPCEANCommon.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEANCommon.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEANCommon.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEANCommon.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEANCommon.cpp.o.d"
+  "/root/repo/core/src/oned/ODUPCEWriter.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODUPCEWriter.cpp.o.d"
+  "/root/repo/core/src/oned/ODWriterHelper.cpp" "core/CMakeFiles/ZXing.dir/src/oned/ODWriterHelper.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODWriterHelper.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/oned/ODWriterHelper.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/oned/ODWriterHelper.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFBarcodeValue.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBarcodeValue.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBarcodeValue.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBarcodeValue.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBarcodeValue.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFBoundingBox.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBoundingBox.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBoundingBox.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBoundingBox.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFBoundingBox.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFCodewordDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFCodewordDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFCodewordDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFCodewordDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFCodewordDecoder.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDecoder.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFDetectionResult.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResult.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResult.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResult.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResult.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFDetectionResultColumn.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResultColumn.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResultColumn.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResultColumn.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResultColumn.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFDetector.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetector.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFDetector.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFEncoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFEncoder.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFHighLevelEncoder.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFHighLevelEncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFHighLevelEncoder.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFModulusGF.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusGF.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusGF.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusGF.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusGF.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFModulusPoly.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusPoly.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusPoly.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusPoly.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFModulusPoly.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFReader.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFReader.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFReader.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFScanningDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFScanningDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFScanningDecoder.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFScanningDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFScanningDecoder.cpp.o.d"
+  "/root/repo/core/src/pdf417/PDFWriter.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/PDFWriter.cpp.o.d"
+  "/root/repo/core/src/pdf417/ZXBigInteger.cpp" "core/CMakeFiles/ZXing.dir/src/pdf417/ZXBigInteger.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/ZXBigInteger.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/pdf417/ZXBigInteger.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/pdf417/ZXBigInteger.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRBitMatrixParser.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRBitMatrixParser.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRBitMatrixParser.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRCodecMode.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRCodecMode.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRCodecMode.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/qrcode/QRCodecMode.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRCodecMode.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRDataBlock.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDataBlock.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDataBlock.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRDecoder.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDecoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDecoder.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRDetector.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDetector.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDetector.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRDetector.cpp.o.d"
+  "/root/repo/core/src/qrcode/QREncoder.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QREncoder.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QREncoder.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRErrorCorrectionLevel.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRErrorCorrectionLevel.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRErrorCorrectionLevel.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/qrcode/QRErrorCorrectionLevel.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRErrorCorrectionLevel.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRFormatInformation.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRFormatInformation.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRFormatInformation.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/qrcode/QRFormatInformation.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRFormatInformation.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRMaskUtil.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRMaskUtil.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRMaskUtil.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRMatrixUtil.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRMatrixUtil.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRMatrixUtil.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/qrcode/QRMatrixUtil.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRMatrixUtil.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRReader.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRReader.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRReader.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRVersion.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRVersion.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRVersion.cpp.o.d"
+  "/root/repo/core/src/qrcode/QRWriter.cpp" "core/CMakeFiles/ZXing.dir/src/qrcode/QRWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRWriter.cpp.o.d"
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/cmake_pch.hxx" "core/CMakeFiles/ZXing.dir/src/qrcode/QRWriter.cpp.o" "gcc" "core/CMakeFiles/ZXing.dir/src/qrcode/QRWriter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,231 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ZXing.dir/cmake_pch.hxx.gch"
+  "CMakeFiles/ZXing.dir/cmake_pch.hxx.gch.d"
+  "CMakeFiles/ZXing.dir/src/Barcode.cpp.o"
+  "CMakeFiles/ZXing.dir/src/Barcode.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/BarcodeFormat.cpp.o"
+  "CMakeFiles/ZXing.dir/src/BarcodeFormat.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/BinaryBitmap.cpp.o"
+  "CMakeFiles/ZXing.dir/src/BinaryBitmap.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/BitArray.cpp.o"
+  "CMakeFiles/ZXing.dir/src/BitArray.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/BitMatrix.cpp.o"
+  "CMakeFiles/ZXing.dir/src/BitMatrix.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/BitMatrixIO.cpp.o"
+  "CMakeFiles/ZXing.dir/src/BitMatrixIO.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/BitSource.cpp.o"
+  "CMakeFiles/ZXing.dir/src/BitSource.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/CharacterSet.cpp.o"
+  "CMakeFiles/ZXing.dir/src/CharacterSet.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ConcentricCandidates.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ConcentricCandidates.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ConcentricFinder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ConcentricFinder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/Content.cpp.o"
+  "CMakeFiles/ZXing.dir/src/Content.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ECI.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ECI.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/Error.cpp.o"
+  "CMakeFiles/ZXing.dir/src/Error.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/GTIN.cpp.o"
+  "CMakeFiles/ZXing.dir/src/GTIN.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/GenericGF.cpp.o"
+  "CMakeFiles/ZXing.dir/src/GenericGF.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/GenericGFPoly.cpp.o"
+  "CMakeFiles/ZXing.dir/src/GenericGFPoly.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/GlobalHistogramBinarizer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/GlobalHistogramBinarizer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/GridSampler.cpp.o"
+  "CMakeFiles/ZXing.dir/src/GridSampler.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/HRI.cpp.o"
+  "CMakeFiles/ZXing.dir/src/HRI.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/HybridBinarizer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/HybridBinarizer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/JSON.cpp.o"
+  "CMakeFiles/ZXing.dir/src/JSON.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/MultiFormatReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/MultiFormatReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/MultiFormatWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/MultiFormatWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/PerspectiveTransform.cpp.o"
+  "CMakeFiles/ZXing.dir/src/PerspectiveTransform.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ReadBarcode.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ReadBarcode.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ReedSolomonDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ReedSolomonDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ReedSolomonEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ReedSolomonEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ResultPoint.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ResultPoint.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/TextDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/TextDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/TextEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/TextEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/TextUtfEncoding.cpp.o"
+  "CMakeFiles/ZXing.dir/src/TextUtfEncoding.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ThreadPool.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ThreadPool.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/Utf.cpp.o"
+  "CMakeFiles/ZXing.dir/src/Utf.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/WhiteRectDetector.cpp.o"
+  "CMakeFiles/ZXing.dir/src/WhiteRectDetector.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/WriteBarcode.cpp.o"
+  "CMakeFiles/ZXing.dir/src/WriteBarcode.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/ZXingCpp.cpp.o"
+  "CMakeFiles/ZXing.dir/src/ZXingCpp.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZDetector.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZDetector.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZHighLevelEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZHighLevelEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZToken.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZToken.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/aztec/AZWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/aztec/AZWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMBitLayout.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMBitLayout.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMDataBlock.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMDataBlock.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMDetector.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMDetector.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMECEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMECEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMHighLevelEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMHighLevelEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMSymbolInfo.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMSymbolInfo.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMVersion.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMVersion.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/datamatrix/DMWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/libzueci/zueci.c.o"
+  "CMakeFiles/ZXing.dir/src/libzueci/zueci.c.o.d"
+  "CMakeFiles/ZXing.dir/src/maxicode/MCBitMatrixParser.cpp.o"
+  "CMakeFiles/ZXing.dir/src/maxicode/MCBitMatrixParser.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/maxicode/MCDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/maxicode/MCDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/maxicode/MCReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/maxicode/MCReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCodabarReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCodabarReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCodabarWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCodabarWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode128Patterns.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode128Patterns.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode128Reader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode128Reader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode128Writer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode128Writer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode39Reader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode39Reader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode39Writer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode39Writer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode93Reader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode93Reader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode93Writer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODCode93Writer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODDXFilmEdgeReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODDXFilmEdgeReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarCommon.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarCommon.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedBitDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedBitDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarExpandedReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarLimitedReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarLimitedReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODDataBarReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODEAN13Writer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODEAN13Writer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODEAN8Writer.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODEAN8Writer.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODITFReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODITFReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODITFWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODITFWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODMultiUPCEANReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODMultiUPCEANReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODUPCAWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODUPCAWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODUPCEANCommon.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODUPCEANCommon.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODUPCEWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODUPCEWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/oned/ODWriterHelper.cpp.o"
+  "CMakeFiles/ZXing.dir/src/oned/ODWriterHelper.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFBarcodeValue.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFBarcodeValue.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFBoundingBox.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFBoundingBox.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFCodewordDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFCodewordDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResult.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResult.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResultColumn.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDetectionResultColumn.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDetector.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFDetector.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFHighLevelEncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFHighLevelEncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFModulusGF.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFModulusGF.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFModulusPoly.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFModulusPoly.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFScanningDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFScanningDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/PDFWriter.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/pdf417/ZXBigInteger.cpp.o"
+  "CMakeFiles/ZXing.dir/src/pdf417/ZXBigInteger.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRBitMatrixParser.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRBitMatrixParser.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRCodecMode.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRCodecMode.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRDataBlock.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRDataBlock.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRDecoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRDecoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRDetector.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRDetector.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QREncoder.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QREncoder.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRErrorCorrectionLevel.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRErrorCorrectionLevel.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRFormatInformation.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRFormatInformation.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRMaskUtil.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRMaskUtil.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRMatrixUtil.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRMatrixUtil.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRReader.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRReader.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRVersion.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRVersion.cpp.o.d"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRWriter.cpp.o"
+  "CMakeFiles/ZXing.dir/src/qrcode/QRWriter.cpp.o.d"
+  "libZXing.a"
+  "libZXing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/ZXing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+/* generated by CMake */
+
+#pragma GCC system_header
+#include "/root/repo/core/src/Barcode.h"
+#include "/root/repo/core/src/BarcodeFormat.h"
+#include "/root/repo/core/src/BitHacks.h"
+#include "/root/repo/core/src/ByteArray.h"
+#include "/root/repo/core/src/CharacterSet.h"
+#include "/root/repo/core/src/Content.h"
+#include "/root/repo/core/src/Error.h"
+#include "/root/repo/core/src/Flags.h"
+#include "/root/repo/core/src/GTIN.h"
+#include "/root/repo/core/src/ImageView.h"
+#include "/root/repo/core/src/Point.h"
+#include "/root/repo/core/src/Quadrilateral.h"
+#include "/root/repo/core/src/Range.h"
+#include "/root/repo/core/src/ReadBarcode.h"
+#include "/root/repo/core/src/ReaderOptions.h"
+#include "/root/repo/core/src/StructuredAppend.h"
+#include "/root/repo/core/src/TextUtfEncoding.h"
+#include "/root/repo/core/src/ZXingCpp.h"
+#include "/root/repo/core/src/ZXAlgorithms.h"
+#include "/root/repo/core/src/WriteBarcode.h"
+#include "/root/repo/core/src/DecodeCounters.h"
+#include "/root/repo/core/src/BitMatrix.h"
+#include "/root/repo/core/src/BitMatrixIO.h"
+#include "/root/repo/core/src/Matrix.h"
+#include "/root/repo/core/src/MultiFormatWriter.h"
@@ -0,0 +1,85 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit/BarcodeFormatTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/BarcodeFormatTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/BarcodeFormatTest.cpp.o.d"
+  "/root/repo/test/unit/BitArrayUtility.cpp" "test/unit/CMakeFiles/UnitTest.dir/BitArrayUtility.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/BitArrayUtility.cpp.o.d"
+  "/root/repo/test/unit/BitHacksTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/BitHacksTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/BitHacksTest.cpp.o.d"
+  "/root/repo/test/unit/CharacterSetECITest.cpp" "test/unit/CMakeFiles/UnitTest.dir/CharacterSetECITest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/CharacterSetECITest.cpp.o.d"
+  "/root/repo/test/unit/ContentTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/ContentTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/ContentTest.cpp.o.d"
+  "/root/repo/test/unit/ErrorTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/ErrorTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/ErrorTest.cpp.o.d"
+  "/root/repo/test/unit/GS1Test.cpp" "test/unit/CMakeFiles/UnitTest.dir/GS1Test.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/GS1Test.cpp.o.d"
+  "/root/repo/test/unit/GTINTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/GTINTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/GTINTest.cpp.o.d"
+  "/root/repo/test/unit/JSONTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/JSONTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/JSONTest.cpp.o.d"
+  "/root/repo/test/unit/PatternTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/PatternTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/PatternTest.cpp.o.d"
+  "/root/repo/test/unit/ReedSolomonTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/ReedSolomonTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/ReedSolomonTest.cpp.o.d"
+  "/root/repo/test/unit/SanitizerSupport.cpp" "test/unit/CMakeFiles/UnitTest.dir/SanitizerSupport.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/SanitizerSupport.cpp.o.d"
+  "/root/repo/test/unit/StructuredAppendSessionTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/StructuredAppendSessionTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/StructuredAppendSessionTest.cpp.o.d"
+  "/root/repo/test/unit/TextDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/TextDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/TextDecoderTest.cpp.o.d"
+  "/root/repo/test/unit/TextEncoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/TextEncoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/TextEncoderTest.cpp.o.d"
+  "/root/repo/test/unit/TextUtfEncodingTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/TextUtfEncodingTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/TextUtfEncodingTest.cpp.o.d"
+  "/root/repo/test/unit/ThresholdBinarizerTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/ThresholdBinarizerTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/ThresholdBinarizerTest.cpp.o.d"
+  "/root/repo/test/unit/WorstCaseWorkloadTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/WorstCaseWorkloadTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/WorstCaseWorkloadTest.cpp.o.d"
+  "/root/repo/test/unit/ZXAlgorithmsTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/ZXAlgorithmsTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/ZXAlgorithmsTest.cpp.o.d"
+  "/root/repo/test/unit/aztec/AZDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZDecoderTest.cpp.o.d"
+  "/root/repo/test/unit/aztec/AZDetectorTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZDetectorTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZDetectorTest.cpp.o.d"
+  "/root/repo/test/unit/aztec/AZEncodeDecodeTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZEncodeDecodeTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZEncodeDecodeTest.cpp.o.d"
+  "/root/repo/test/unit/aztec/AZEncoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZEncoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZEncoderTest.cpp.o.d"
+  "/root/repo/test/unit/aztec/AZHighLevelEncoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZHighLevelEncoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/aztec/AZHighLevelEncoderTest.cpp.o.d"
+  "/root/repo/test/unit/datamatrix/DMDecodedBitStreamParserTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMDecodedBitStreamParserTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMDecodedBitStreamParserTest.cpp.o.d"
+  "/root/repo/test/unit/datamatrix/DMEncodeDecodeTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMEncodeDecodeTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMEncodeDecodeTest.cpp.o.d"
+  "/root/repo/test/unit/datamatrix/DMHighLevelEncodeTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMHighLevelEncodeTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMHighLevelEncodeTest.cpp.o.d"
+  "/root/repo/test/unit/datamatrix/DMPlacementTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMPlacementTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMPlacementTest.cpp.o.d"
+  "/root/repo/test/unit/datamatrix/DMSymbolInfoTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMSymbolInfoTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMSymbolInfoTest.cpp.o.d"
+  "/root/repo/test/unit/datamatrix/DMWriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMWriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/datamatrix/DMWriterTest.cpp.o.d"
+  "/root/repo/test/unit/maxicode/MCDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/maxicode/MCDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/maxicode/MCDecoderTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCodaBarWriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCodaBarWriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCodaBarWriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode128ReaderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode128ReaderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode128ReaderTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode128WriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode128WriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode128WriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode39ExtendedModeTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode39ExtendedModeTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode39ExtendedModeTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode39ReaderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode39ReaderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode39ReaderTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode39WriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode39WriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode39WriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode93ReaderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode93ReaderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode93ReaderTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODCode93WriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode93WriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODCode93WriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODDataBarExpandedBitDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODDataBarExpandedBitDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODDataBarExpandedBitDecoderTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODDataBarReaderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODDataBarReaderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODDataBarReaderTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODEAN13WriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODEAN13WriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODEAN13WriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODEAN8WriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODEAN8WriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODEAN8WriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODITFWriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODITFWriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODITFWriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODUPCAWriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODUPCAWriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODUPCAWriterTest.cpp.o.d"
+  "/root/repo/test/unit/oned/ODUPCEWriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/oned/ODUPCEWriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/oned/ODUPCEWriterTest.cpp.o.d"
+  "/root/repo/test/unit/pdf417/PDF417DecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417DecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417DecoderTest.cpp.o.d"
+  "/root/repo/test/unit/pdf417/PDF417ErrorCorrectionTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417ErrorCorrectionTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417ErrorCorrectionTest.cpp.o.d"
+  "/root/repo/test/unit/pdf417/PDF417HighLevelEncoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417HighLevelEncoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417HighLevelEncoderTest.cpp.o.d"
+  "/root/repo/test/unit/pdf417/PDF417ScanningDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417ScanningDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417ScanningDecoderTest.cpp.o.d"
+  "/root/repo/test/unit/pdf417/PDF417WriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417WriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/pdf417/PDF417WriterTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/MQRDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/MQRDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/MQRDecoderTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRBitMatrixParserTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRBitMatrixParserTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRBitMatrixParserTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRDataMaskTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRDataMaskTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRDataMaskTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRDecodedBitStreamParserTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRDecodedBitStreamParserTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRDecodedBitStreamParserTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QREncoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QREncoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QREncoderTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRErrorCorrectionLevelTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRErrorCorrectionLevelTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRErrorCorrectionLevelTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRFormatInformationTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRFormatInformationTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRFormatInformationTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRModeTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRModeTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRModeTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRSoftDecodeTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRSoftDecodeTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRSoftDecodeTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRVersionTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRVersionTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRVersionTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/QRWriterTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRWriterTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/QRWriterTest.cpp.o.d"
+  "/root/repo/test/unit/qrcode/RMQRDecoderTest.cpp" "test/unit/CMakeFiles/UnitTest.dir/qrcode/RMQRDecoderTest.cpp.o" "gcc" "test/unit/CMakeFiles/UnitTest.dir/qrcode/RMQRDecoderTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/core/CMakeFiles/ZXing.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,135 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UnitTest.dir/BarcodeFormatTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/BarcodeFormatTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/BitArrayUtility.cpp.o"
+  "CMakeFiles/UnitTest.dir/BitArrayUtility.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/BitHacksTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/BitHacksTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/CharacterSetECITest.cpp.o"
+  "CMakeFiles/UnitTest.dir/CharacterSetECITest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/ContentTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/ContentTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/ErrorTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/ErrorTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/GS1Test.cpp.o"
+  "CMakeFiles/UnitTest.dir/GS1Test.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/GTINTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/GTINTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/JSONTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/JSONTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/PatternTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/PatternTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/ReedSolomonTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/ReedSolomonTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/SanitizerSupport.cpp.o"
+  "CMakeFiles/UnitTest.dir/SanitizerSupport.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/StructuredAppendSessionTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/StructuredAppendSessionTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/TextDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/TextDecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/TextEncoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/TextEncoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/TextUtfEncodingTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/TextUtfEncodingTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/ThresholdBinarizerTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/ThresholdBinarizerTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/WorstCaseWorkloadTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/WorstCaseWorkloadTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/ZXAlgorithmsTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/ZXAlgorithmsTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/aztec/AZDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/aztec/AZDecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/aztec/AZDetectorTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/aztec/AZDetectorTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/aztec/AZEncodeDecodeTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/aztec/AZEncodeDecodeTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/aztec/AZEncoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/aztec/AZEncoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/aztec/AZHighLevelEncoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/aztec/AZHighLevelEncoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMDecodedBitStreamParserTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMDecodedBitStreamParserTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMEncodeDecodeTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMEncodeDecodeTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMHighLevelEncodeTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMHighLevelEncodeTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMPlacementTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMPlacementTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMSymbolInfoTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMSymbolInfoTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMWriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/datamatrix/DMWriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/maxicode/MCDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/maxicode/MCDecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCodaBarWriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCodaBarWriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode128ReaderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode128ReaderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode128WriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode128WriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode39ExtendedModeTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode39ExtendedModeTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode39ReaderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode39ReaderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode39WriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode39WriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode93ReaderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode93ReaderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODCode93WriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODCode93WriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODDataBarExpandedBitDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODDataBarExpandedBitDecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODDataBarReaderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODDataBarReaderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODEAN13WriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODEAN13WriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODEAN8WriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODEAN8WriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODITFWriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODITFWriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODUPCAWriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODUPCAWriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/oned/ODUPCEWriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/oned/ODUPCEWriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417DecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417DecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417ErrorCorrectionTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417ErrorCorrectionTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417HighLevelEncoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417HighLevelEncoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417ScanningDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417ScanningDecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417WriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/pdf417/PDF417WriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/MQRDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/MQRDecoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRBitMatrixParserTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRBitMatrixParserTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRDataMaskTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRDataMaskTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRDecodedBitStreamParserTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRDecodedBitStreamParserTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QREncoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QREncoderTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRErrorCorrectionLevelTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRErrorCorrectionLevelTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRFormatInformationTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRFormatInformationTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRModeTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRModeTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRSoftDecodeTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRSoftDecodeTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRVersionTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRVersionTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/QRWriterTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/QRWriterTest.cpp.o.d"
+  "CMakeFiles/UnitTest.dir/qrcode/RMQRDecoderTest.cpp.o"
+  "CMakeFiles/UnitTest.dir/qrcode/RMQRDecoderTest.cpp.o.d"
+  "UnitTest"
+  "UnitTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit
+# Build directory: /root/repo/_gate_build/test/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(UnitTest "/root/repo/_gate_build/test/unit/UnitTest")
+set_tests_properties(UnitTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;108;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+subdirs("../../_deps/googletest-build")
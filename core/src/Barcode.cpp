@@ -6,6 +6,7 @@
 
 #include "Barcode.h"
 
+#include "DecodeCounters.h"
 #include "DecoderResult.h"
 #include "DetectorResult.h"
 #include "JSON.h"
@@ -50,12 +51,15 @@ Result::Result(DecoderResult&& decodeResult, DetectorResult&& detectorResult, Ba
 	  _format(format),
 	  _lineCount(decodeResult.lineCount()),
 	  _isMirrored(decodeResult.isMirrored()),
+	  _isInverted(decodeResult.isInverted()),
 	  _readerInit(decodeResult.readerInit())
 #ifdef ZXING_EXPERIMENTAL_API
 	  , _symbol(std::make_shared<BitMatrix>(std::move(detectorResult).bits()))
 	  , _json(std::move(decodeResult).json())
 #endif
 {
+	detail::decodeCounters.decodeErrors += bool(_error);
+
 	if (decodeResult.versionNumber())
 		snprintf(_version, 4, "%d", decodeResult.versionNumber());
 	snprintf(_ecLevel, 4, "%s", decodeResult.ecLevel().data());
@@ -166,7 +170,9 @@ void Result::zint(unique_zint_symbol&& z)
 
 std::string Result::extra(std::string_view key) const
 {
-	return _json.empty() ? "" : key.empty() ? "{" + _json.substr(0, _json.size() - 1) + "}" : std::string(JsonGetStr(_json, key));
+	return _json.empty() ? ""
+		   : key.empty() ? StrCat('{', std::string_view(_json).substr(0, _json.size() - 1), '}')
+					     : std::string(JsonGetStr(_json, key));
 }
 #endif
 
@@ -253,4 +259,47 @@ Barcodes MergeStructuredAppendSequences(const Barcodes& barcodes)
 	return res;
 }
 
+#ifdef ZXING_EXPERIMENTAL_API
+bool StructuredAppendSession::add(const Barcode& barcode)
+{
+	if (!barcode.isValid() || !barcode.isPartOfSequence())
+		return false;
+
+	auto& seq = _sequences[barcode.sequenceId()];
+	int size = std::max(barcode.sequenceSize(), barcode.sequenceIndex() + 1);
+	if (Size(seq.parts) < size)
+		seq.parts.resize(size);
+
+	auto& slot = seq.parts[barcode.sequenceIndex()];
+	if (slot.isValid())
+		return false; // this part has been collected in an earlier frame already
+
+	slot = barcode;
+	++seq.seen;
+	return true;
+}
+
+Barcodes StructuredAppendSession::takeCompleted()
+{
+	Barcodes res;
+	for (auto it = _sequences.begin(); it != _sequences.end();) {
+		auto& [parts, seen] = it->second;
+		// a sequence is complete once the announced number of parts has been collected
+		// (sequenceSize() is 0 if the count is unknown, see PDF417, in which case we keep collecting)
+		if (seen && seen == Size(parts) && parts.back().sequenceSize() == seen) {
+			Barcode merged = std::move(parts.front());
+			for (auto part = std::next(parts.begin()); part != parts.end(); ++part)
+				merged._content.append(part->_content);
+			merged._position = {};
+			merged._sai.index = -1;
+			res.push_back(std::move(merged));
+			it = _sequences.erase(it);
+		} else {
+			++it;
+		}
+	}
+	return res;
+}
+#endif
+
 } // namespace ZXing
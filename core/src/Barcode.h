@@ -17,6 +17,7 @@
 #include "StructuredAppend.h"
 
 #ifdef ZXING_EXPERIMENTAL_API
+#include <map>
 #include <memory>
 namespace ZXing {
 class BitMatrix;
@@ -39,6 +40,8 @@ class DecoderResult;
 class DetectorResult;
 class WriterOptions;
 class Result; // TODO: 3.0 replace deprected symbol name
+struct ScanState;
+struct BitMatrixView;
 
 using Position = QuadrilateralI;
 using Barcode = Result;
@@ -54,9 +57,14 @@ class Result
 	Result& setReaderOptions(const ReaderOptions& opts);
 
 	friend Barcode MergeStructuredAppendSequence(const Barcodes&);
+	friend class StructuredAppendSession;
 	friend Barcodes ReadBarcodes(const ImageView&, const ReaderOptions&);
+	friend Barcodes DoReadBarcodes(const ImageView&, const ReaderOptions&, ScanState&);
+	friend Barcodes ReadBarcodes(const BitMatrixView&, const ReaderOptions&);
+	friend void FinalizeIncrementalResult(Barcode&, const ReaderOptions&, bool);
 	friend Image WriteBarcodeToImage(const Barcode&, const WriterOptions&);
 	friend void IncrementLineCount(Barcode&);
+	friend void AddLineCount(Barcode&, int);
 
 public:
 	Result() = default;
@@ -215,4 +223,32 @@ Barcode MergeStructuredAppendSequence(const Barcodes& results);
  */
 Barcodes MergeStructuredAppendSequences(const Barcodes& barcodes);
 
+#ifdef ZXING_EXPERIMENTAL_API
+/**
+ * @brief StructuredAppendSession collects Structured Append symbols across frames (e.g. of a video
+ * stream) and merges each sequence once all of its parts have been seen.
+ *
+ * Feed every detected barcode via add(). Parts that have already been collected are rejected in
+ * O(1), so re-scanning the same symbol every frame does not re-buffer it. takeCompleted() returns
+ * the merged barcode of every completed sequence and drops it from the session.
+ */
+class StructuredAppendSession
+{
+	struct Sequence
+	{
+		Barcodes parts; // indexed by sequenceIndex
+		int seen = 0;
+	};
+	std::map<std::string, Sequence> _sequences;
+
+public:
+	/// returns true if barcode is a new (not previously collected) part of a sequence
+	bool add(const Barcode& barcode);
+	/// merged barcodes of all completed sequences, which are thereby removed from the session
+	Barcodes takeCompleted();
+
+	void clear() { _sequences.clear(); }
+};
+#endif
+
 } // ZXing
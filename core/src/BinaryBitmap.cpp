@@ -5,9 +5,24 @@
 
 #include "BinaryBitmap.h"
 
+#include "BitHacks.h"
 #include "BitMatrix.h"
+#include "ZXConfig.h"
+#ifdef ZX_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef ZXING_EXPERIMENTAL_API
+#include "ConcentricCandidates.h"
+#endif
+#include "Profiler.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
 #include <mutex>
+#include <optional>
+#include <utility>
 
 namespace ZXing {
 
@@ -15,6 +30,15 @@ struct BinaryBitmap::Cache
 {
 	std::once_flag once;
 	std::shared_ptr<const BitMatrix> matrix;
+	// one lazily sized table of rows per rotation: compared to a std::map keyed by (row, rotation)
+	// this halves the per-row allocations of the 1D row sweep and makes the lookup a plain index
+	std::array<std::vector<std::optional<PatternRow>>, 4> patternRows;
+	std::mutex patternRowsMutex;
+#ifdef ZXING_EXPERIMENTAL_API
+	std::unique_ptr<ConcentricCandidateSets> concentric;
+	std::optional<bool> rotatedFirst;
+	std::optional<ContentClassification> content;
+#endif
 };
 
 BitMatrix BinaryBitmap::binarize(const uint8_t threshold) const
@@ -22,9 +46,22 @@ BitMatrix BinaryBitmap::binarize(const uint8_t threshold) const
 	BitMatrix res(width(), height());
 
 	if (_buffer.pixStride() == 1 && _buffer.rowStride() == _buffer.width()) {
-		// Specialize for a packed buffer with pixStride 1 to support auto vectorization (16x speedup on AVX2)
+		auto src = _buffer.data(0, 0);
+		auto end = _buffer.data(0, height());
 		auto dst = res.row(0).begin();
-		for (auto src = _buffer.data(0, 0), end = _buffer.data(0, height()); src != end; ++src, ++dst)
+#ifdef ZX_HAVE_SSE2
+		// With SET_V == 0xff the compare mask is the destination value, so binarization of a packed
+		// buffer is a pure compare+store of 16 pixels per instruction, i.e. runs at memory bandwidth.
+		// This also covers pre-thresholded input, where it degenerates into a copy with inversion.
+		const __m128i thr = _mm_set1_epi8(static_cast<char>(threshold));
+		static_assert(BitMatrix::SET_V == 0xff && BitMatrix::UNSET_V == 0);
+		for (; end - src >= 16; src += 16, dst += 16) {
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_cmpeq_epi8(_mm_min_epu8(v, thr), v));
+		}
+#endif
+		// Specialize for a packed buffer with pixStride 1 to support auto vectorization (16x speedup on AVX2)
+		for (; src != end; ++src, ++dst)
 			*dst = (*src <= threshold) * BitMatrix::SET_V;
 	} else {
 		auto processLine = [&res, threshold](int y, const auto* src, const int stride) {
@@ -51,9 +88,84 @@ BinaryBitmap::BinaryBitmap(const ImageView& buffer) : _cache(new Cache), _buffer
 
 BinaryBitmap::~BinaryBitmap() = default;
 
+bool BinaryBitmap::getPatternRow(int row, int rotation, PatternRow& res) const
+{
+	// The sizing of the table is guarded so that the band-parallel 1D scan can share the cache, but
+	// concurrent calls for the same (row, rotation) are not supported (the row bands are disjoint).
+	// The table is never resized once sized, so the entry can be filled outside the lock.
+	auto& rows = _cache->patternRows[(rotation / 90) & 3];
+	{
+		std::lock_guard lock(_cache->patternRowsMutex);
+		if (rows.empty())
+			rows.resize(rotation % 180 == 0 ? height() : width());
+	}
+	auto& cached = rows[row];
+	if (!cached) {
+		cached.emplace();
+		if (!getPatternRowImpl(row, rotation, *cached))
+			cached->clear(); // an empty pattern marks a row that failed to binarize, no need to retry
+	}
+	res = *cached;
+	return !res.empty();
+}
+
+#ifdef ZXING_EXPERIMENTAL_API
+bool BinaryBitmap::rotatedSweepFirst() const
+{
+	if (!_cache->rotatedFirst) {
+		// The bars of a 1D symbol produce strong gradients across them: if the vertical gradients of
+		// a sparse sample grid dominate, the bars run horizontally and the rotated sweep should go
+		// first. ~64x64 samples touch well under 1% of the pixels, negligible next to one row sweep.
+		constexpr int GRID = 64;
+		const int xStep = std::max(1, width() / GRID), yStep = std::max(1, height() / GRID);
+		const int pixStep = _buffer.pixStride(), rowStep = _buffer.rowStride();
+		int64_t dx = 0, dy = 0;
+		for (int y = 0; y + yStep < height(); y += yStep) {
+			const uint8_t* p = _buffer.data(0, y) + GreenIndex(_buffer.format());
+			for (int x = 0; x + xStep < width(); x += xStep, p += xStep * pixStep) {
+				dx += std::abs(p[pixStep] - p[0]);
+				dy += std::abs(p[rowStep] - p[0]);
+			}
+		}
+		_cache->rotatedFirst = dy > dx;
+	}
+	return *_cache->rotatedFirst;
+}
+#endif
+
+#ifdef ZXING_EXPERIMENTAL_API
+void BinaryBitmap::deriveBlackMatrix(const BinaryBitmap& parent, int factor)
+{
+	std::call_once(_cache->once, [&]() {
+		ZX_PROFILE_SCOPE(Binarize);
+		const BitMatrix& src = *parent.getBitMatrix();
+		auto res = std::make_shared<BitMatrix>(width(), height());
+		// With one byte (0x00/0xff) per pixel, the block reduction is a plain integer sum the
+		// auto-vectorizer handles; >= half the block set means set, matching the box filter rounding.
+		const int blockSet = factor * factor * BitMatrix::SET_V;
+		for (int y = 0; y < height(); ++y) {
+			uint8_t* d = res->row(y).begin();
+			for (int x = 0; x < width(); ++x) {
+				int sum = 0;
+				for (int ty = 0; ty < factor; ++ty) {
+					const uint8_t* s = src.row(y * factor + ty).begin() + x * factor;
+					for (int tx = 0; tx < factor; ++tx)
+						sum += s[tx];
+				}
+				d[x] = (2 * sum >= blockSet) * BitMatrix::SET_V;
+			}
+		}
+		_cache->matrix = std::move(res);
+	});
+}
+#endif
+
 const BitMatrix* BinaryBitmap::getBitMatrix() const
 {
-	std::call_once(_cache->once, [&](){_cache->matrix = getBlackMatrix();});
+	std::call_once(_cache->once, [&]() {
+		ZX_PROFILE_SCOPE(Binarize);
+		_cache->matrix = getBlackMatrix();
+	});
 	return _cache->matrix.get();
 }
 
@@ -64,26 +176,60 @@ void BinaryBitmap::invert()
 		matrix->flipAll();
 	}
 	_inverted = !_inverted;
+#ifdef ZXING_EXPERIMENTAL_API
+	_cache->concentric.reset();
+#endif
 }
 
-template <typename F>
-void SumFilter(const BitMatrix& in, BitMatrix& out, F func)
+// Computes the 3x3 neighborhood OR (dilate) or AND (erode) of in into out. Since the matrix stores
+// one byte (0x00/0xff) per pixel, the neighborhood reduction is a plain bitwise operation that can be
+// computed for 8 pixels per 64 bit word, with unaligned loads taking the place of the cross-word carry
+// handling a packed-bit representation would require.
+template <typename Op>
+void MorphFilter(const BitMatrix& in, BitMatrix& out, Op op)
 {
 	assert(in.height() >= 3);
 
-	const auto* in0 = in.row(0).begin();
-	const auto* in1 = in.row(1).begin();
-	const auto* in2 = in.row(2).begin();
+	const int stride = in.width();
+	const uint8_t* src = in.row(0).begin();
+	uint8_t* dst = out.row(0).begin();
 
-	for (auto *out1 = out.row(1).begin() + 1, *end = out.row(out.height() - 1).begin() - 1; out1 != end; ++in0, ++in1, ++in2, ++out1) {
-		int sum = 0;
-		for (int j = 0; j < 3; ++j)
-			sum += in0[j] + in1[j] + in2[j];
+	// Walk the buffer linearly from the second pixel of the second row to the second to last pixel of
+	// the second to last row, like the previous per-pixel sum filter did.
+	const int last = (in.height() - 1) * stride - 1;
+	int i = stride + 1;
 
-		*out1 = func(sum);
+	auto combine = [&op](const uint8_t* p) {
+		using BitHacks::LoadU;
+		return op(op(LoadU<uint64_t>(p - 1), LoadU<uint64_t>(p)), LoadU<uint64_t>(p + 1));
+	};
+
+	for (; i + 8 <= last; i += 8) {
+		uint64_t v = op(op(combine(src + i - stride), combine(src + i)), combine(src + i + stride));
+		memcpy(dst + i, &v, sizeof(v));
+	}
+
+	for (; i < last; ++i) {
+		uint8_t v = op(op(src[i - stride - 1], op(src[i - stride], src[i - stride + 1])),
+					   op(op(src[i - 1], op(src[i], src[i + 1])),
+						  op(src[i + stride - 1], op(src[i + stride], src[i + stride + 1]))));
+		dst[i] = v;
 	}
 }
 
+void BinaryBitmap::exclude(int left, int top, int width, int height)
+{
+	auto& matrix = *const_cast<BitMatrix*>(getBitMatrix());
+
+	left       = std::clamp(left, 0, matrix.width());
+	top        = std::clamp(top, 0, matrix.height());
+	int right  = std::clamp(left + width, left, matrix.width());
+	int bottom = std::clamp(top + height, top, matrix.height());
+
+	for (int y = top; y < bottom; ++y)
+		std::fill(matrix.row(y).begin() + left, matrix.row(y).begin() + right, BitMatrix::UNSET_V);
+}
+
 void BinaryBitmap::close()
 {
 	if (_cache->matrix) {
@@ -91,11 +237,66 @@ void BinaryBitmap::close()
 		BitMatrix tmp(matrix.width(), matrix.height());
 
 		// dilate
-		SumFilter(matrix, tmp, [](int sum) { return (sum > 0 * BitMatrix::SET_V) * BitMatrix::SET_V; });
+		MorphFilter(matrix, tmp, [](auto a, auto b) { return a | b; });
 		// erode
-		SumFilter(tmp, matrix, [](int sum) { return (sum == 9 * BitMatrix::SET_V) * BitMatrix::SET_V; });
+		MorphFilter(tmp, matrix, [](auto a, auto b) { return a & b; });
 	}
 	_closed = true;
+#ifdef ZXING_EXPERIMENTAL_API
+	_cache->concentric.reset();
+	_cache->content.reset();
+#endif
+}
+
+#ifdef ZXING_EXPERIMENTAL_API
+BinaryBitmap::ContentClassification BinaryBitmap::classifyContent() const
+{
+	if (!_cache->content) {
+		constexpr int TILE = 64, LINES = 4; // 4 sampled rows and columns per tile, i.e. ~1/8th of its pixels
+		ContentClassification res; // images smaller than one tile are not routed
+		if (width() >= TILE && height() >= TILE) {
+			res = {false, false};
+			const BitMatrix& matrix = *getBitMatrix();
+			const int stride = matrix.width();
+			// the last tile row/column is anchored at the image border (overlapping its neighbor), so
+			// the trailing width/height % TILE band is sampled as well and can not hide a symbol
+			const int nx = (width() + TILE - 1) / TILE, ny = (height() + TILE - 1) / TILE;
+			for (int iy = 0; iy < ny; ++iy)
+				for (int ix = 0; ix < nx; ++ix) {
+					const int ty = std::min(iy * TILE, height() - TILE);
+					const int tx = std::min(ix * TILE, width() - TILE);
+					int h = 0, v = 0;
+					for (int i = 0; i < LINES; ++i) {
+						int o = (2 * i + 1) * TILE / (2 * LINES);
+						const uint8_t* row = matrix.row(ty + o).begin() + tx;
+						const uint8_t* col = matrix.row(ty).begin() + tx + o;
+						for (int j = 1; j < TILE; ++j) {
+							h += row[j] != row[j - 1];
+							v += col[j * stride] != col[(j - 1) * stride];
+						}
+					}
+					// Any transitions at all may stem from (part of) a linear symbol, so only a tile
+					// without them rules the 1D sweep out. The 2D finder cascades are only worth
+					// running on a tile that is dense in both directions and not clearly anisotropic
+					// (i.e. not just bars).
+					res.hasLinear |= h + v >= 8;
+					res.hasMatrix |= h + v >= 16 && std::min(h, v) * 4 > std::max(h, v);
+				}
+		}
+		_cache->content = res;
+	}
+	return *_cache->content;
+}
+
+void BinaryBitmap::setConcentricCandidates(std::unique_ptr<ConcentricCandidateSets>&& candidates) const
+{
+	_cache->concentric = std::move(candidates);
+}
+
+const ConcentricCandidateSets* BinaryBitmap::concentricCandidates() const
+{
+	return _cache->concentric.get();
 }
+#endif
 
 } // ZXing
@@ -9,6 +9,10 @@
 
 #include "ImageView.h"
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include "Point.h"
+#endif
+
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -16,6 +20,10 @@
 namespace ZXing {
 
 class BitMatrix;
+#ifdef ZXING_EXPERIMENTAL_API
+struct ConcentricCandidateSets;
+class DecodeCache;
+#endif
 
 using PatternRow = std::vector<uint16_t>;
 
@@ -29,6 +37,10 @@ class BinaryBitmap
 	std::unique_ptr<Cache> _cache;
 	bool _inverted = false;
 	bool _closed = false;
+#ifdef ZXING_EXPERIMENTAL_API
+	PointI _scanHint = {-1, -1};
+	DecodeCache* _decodeCache = nullptr;
+#endif
 
 protected:
 	const ImageView _buffer;
@@ -40,6 +52,11 @@ protected:
 	*/
 	virtual std::shared_ptr<const BitMatrix> getBlackMatrix() const = 0;
 
+	/**
+	* Converts one row of luminance data to a vector of ints denoting the widths of the bars and spaces.
+	*/
+	virtual bool getPatternRowImpl(int row, int rotation, PatternRow& res) const = 0;
+
 	BitMatrix binarize(const uint8_t threshold) const;
 
 public:
@@ -50,10 +67,19 @@ public:
 	int height() const { return _buffer.height(); }
 
 	/**
-	* Converts one row of luminance data to a vector of ints denoting the widths of the bars and spaces.
+	* Caching version of getPatternRowImpl(). The pattern of a row depends only on the luminance buffer,
+	* not on invert()/close() state, so a cached entry stays valid for the whole variant loop in
+	* ReadBarcodes and the 1D row sweep never run-length encodes the same row twice.
 	*/
-	virtual bool getPatternRow(int row, int rotation, PatternRow& res) const = 0;
+	bool getPatternRow(int row, int rotation, PatternRow& res) const;
 
+	/**
+	* The matrix is materialized lazily on first access (whole frame at once), so scans that only ever
+	* run the 1D readers never pay for the 2D binarization. A finer, tile-on-demand materialization has
+	* been considered but does not fit the current design: the detectors read the BitMatrix directly via
+	* its (non-virtual) pixel accessors, so there is no seam to fault in tiles without putting a check
+	* into every single pixel access.
+	*/
 	const BitMatrix* getBitMatrix() const;
 
 	void invert();
@@ -61,6 +87,81 @@ public:
 
 	void close();
 	bool closed() const { return _closed; }
+
+	/**
+	* Whites out the given region (clamped to the image) in the binarized image, so that subsequent
+	* detector passes skip e.g. an already decoded symbol. Needs to be re-applied after invert()/close().
+	*/
+	void exclude(int left, int top, int width, int height);
+
+#ifdef ZXING_EXPERIMENTAL_API
+	/**
+	* Position hint for video scanning, e.g. the center of the symbol found in the previous frame
+	* (see ScanContext). The 1D row sweep starts at this point and expands outward instead of starting
+	* at the image center. A negative coordinate means 'no hint'.
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	void setScanHint(PointI center) { _scanHint = center; }
+	PointI scanHint() const { return _scanHint; }
+
+	/**
+	* Cheap dominant-gradient orientation estimate used to order the 1D rotation sweep: returns true
+	* if vertical luminance gradients dominate a sparse sample grid, i.e. the bars (if any) run
+	* horizontally and the rotated (column) sweep is the likely hit. Computed once per bitmap and cached.
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	bool rotatedSweepFirst() const;
+
+	/**
+	* Cache for the shared QR/Aztec concentric candidate stage (see ConcentricCandidates.h): when a
+	* scan includes both formats, the detector that runs first computes the candidate sets for both
+	* in a single row sweep and the other consumes its set without touching the image again.
+	* Invalidated by invert() and close().
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	void setConcentricCandidates(std::unique_ptr<ConcentricCandidateSets>&& candidates) const;
+	const ConcentricCandidateSets* concentricCandidates() const;
+
+	/**
+	* Coarse content classification used to route detector work (see MultiFormatReader::readMultiple):
+	* transition counts along a sparse line sample per 64x64 tile of the black matrix. A tile with
+	* roughly isotropic, dense transitions can hold a matrix symbol; any tile with transitions at all
+	* can hold (part of) a linear one. hasLinear/hasMatrix report whether such a tile exists, so a
+	* frame of nothing but bars skips the 2D finder cascades and an empty frame skips everything.
+	* Computed once per bitmap and cached; invert() keeps it valid (transitions are invariant under
+	* inversion), close() invalidates it. Images smaller than one tile classify as {true, true}.
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	struct ContentClassification
+	{
+		bool hasLinear = true, hasMatrix = true;
+	};
+	ContentClassification classifyContent() const;
+
+	/**
+	* Derives the black matrix by a majority vote over factor x factor blocks of an already binarized
+	* higher-resolution parent, instead of running this bitmap's own binarizer. Only valid when this
+	* bitmap's luminance buffer is the exact box-filter reduction of the parent's by that factor (see
+	* LumImagePyramid). No-op if the matrix has already been materialized.
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	void deriveBlackMatrix(const BinaryBitmap& parent, int factor);
+
+	/**
+	* Frame-to-frame decode cache for the matrix code readers (see DecodeCache.h). The pointed-to
+	* cache is owned by the scan state that persists across frames (see ScanContext), nullptr means
+	* 'no caching'.
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	void setDecodeCache(DecodeCache* cache) { _decodeCache = cache; }
+	DecodeCache* decodeCache() const { return _decodeCache; }
+#endif
 };
 
 } // ZXing
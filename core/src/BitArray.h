@@ -73,14 +73,19 @@ public:
 	*/
 	void appendBits(int value, int numBits)
 	{
-		for (; numBits; --numBits)
-			_bits.push_back((value >> (numBits-1)) & 1);
+		_bits.resize(_bits.size() + numBits);
+		auto dst = _bits.end() - numBits;
+		for (int i = numBits - 1; i >= 0; --i)
+			*dst++ = (value >> i) & 1;
 	}
 
 	void appendBit(bool bit) { _bits.push_back(bit); }
 
 	void appendBitArray(const BitArray& other) { _bits.insert(_bits.end(), other.begin(), other.end()); }
 
+	// Writers know the final bit count up front (symbol capacity), so they can allocate once.
+	void reserve(int numBits) { _bits.reserve(numBits); }
+
 	/**
 	* Reverses all bits in the array.
 	*/
@@ -117,6 +117,11 @@ public:
 
 	void mirror();
 
+	// rotate-on-copy counterparts to rotate90()/rotate180(): when the source needs to stay around
+	// anyway (e.g. orientation handling on a whole frame), these save one full copy of the matrix
+	friend BitMatrix Rotated90(const BitMatrix& input);
+	friend BitMatrix Rotated180(const BitMatrix& input);
+
 	/**
 	* Find the rectangle that contains all non-white pixels. Useful for detection of 'pure' barcodes.
 	*
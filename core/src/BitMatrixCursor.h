@@ -5,9 +5,11 @@
 
 #pragma once
 
+#include "BitHacks.h"
 #include "BitMatrix.h"
 
 #include <climits>
+#include <cstring>
 
 namespace ZXing {
 
@@ -211,6 +213,27 @@ public:
 	{
 		int maxSteps = std::min(stepsToBorder, range);
 		int steps = 0;
+
+		// A stride of +/-1 means the scanned modules are contiguous in memory (the bits are stored
+		// as full 0x00/0xff bytes): find the next transition 8 modules per 64 bit load via ctz/clz.
+		// Most traces are long straight runs, so this typically leaves only the last few modules
+		// before the edge (and the border handling) to the byte loop below. Vertical and diagonal
+		// runs stride by a full row per module and stay byte-wise.
+		// maxSteps > 8 also implies p is still inside the image (after crossing the border, following
+		// calls see a negative stepsToBorder and must not touch memory, like the byte loop below)
+		if ((stride == 1 || stride == -1) && maxSteps > 8) {
+			const uint64_t ref = p[0] ? ~UINT64_C(0) : 0;
+			while (steps + 8 < maxSteps) {
+				uint64_t word;
+				std::memcpy(&word, p + (stride == 1 ? steps + 1 : -steps - 8), sizeof(word));
+				if (uint64_t diff = word ^ ref) {
+					steps += (stride == 1 ? BitHacks::NumberOfTrailingZeros(diff) : BitHacks::NumberOfLeadingZeros(diff)) / 8;
+					break;
+				}
+				steps += 8;
+			}
+		}
+
 		do {
 			if (++steps > maxSteps) {
 				if (maxSteps == stepsToBorder)
@@ -8,7 +8,6 @@
 
 #include <array>
 #include <fstream>
-#include <sstream>
 
 namespace ZXing {
 
@@ -48,27 +47,43 @@ std::string ToString(const BitMatrix& matrix, bool inverted)
 	return res;
 }
 
-std::string ToSVG(const BitMatrix& matrix)
+void ToSVG(const BitMatrix& matrix, std::string& out)
 {
 	// see https://stackoverflow.com/questions/10789059/create-qr-code-in-vector-image/60638350#60638350
 
 	const int width = matrix.width();
 	const int height = matrix.height();
-	std::ostringstream out;
 
-	out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-		<< "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" viewBox=\"0 0 " << width << " " << height
-		<< "\" stroke=\"none\">\n"
-		<< "<path d=\"";
+	out.clear(); // keep the capacity of a reused buffer
+	out.reserve(200 + 4 * width * height);
+
+	StrAppend(out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+			  "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" viewBox=\"0 0 ",
+			  std::to_string(width), " ", std::to_string(height), "\" stroke=\"none\">\n<path d=\"");
 
+	// one path command per horizontal run of set modules instead of one rect per module
 	for (int y = 0; y < height; ++y)
-		for (int x = 0; x < width; ++x)
-			if (matrix.get(x, y))
-				out << "M" << x << "," << y << "h1v1h-1z";
+		for (int x = 0; x < width;) {
+			if (!matrix.get(x, y)) {
+				++x;
+				continue;
+			}
+			int run = x + 1;
+			while (run < width && matrix.get(run, y))
+				++run;
+			auto w = std::to_string(run - x);
+			StrAppend(out, "M", std::to_string(x), ",", std::to_string(y), "h", w, "v1h-", w, "z");
+			x = run;
+		}
 
-	out << "\"/>\n</svg>";
+	out += "\"/>\n</svg>";
+}
 
-	return out.str();
+std::string ToSVG(const BitMatrix& matrix)
+{
+	std::string res;
+	ToSVG(matrix, res);
+	return res;
 }
 
 BitMatrix ParseBitMatrix(const std::string& str, char one, bool expectSpace)
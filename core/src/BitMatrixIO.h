@@ -15,6 +15,7 @@ namespace ZXing {
 std::string ToString(const BitMatrix& matrix, bool inverted = false);
 std::string ToString(const BitMatrix& matrix, char one, char zero = ' ', bool addSpace = true, bool printAsCString = false);
 std::string ToSVG(const BitMatrix& matrix);
+void ToSVG(const BitMatrix& matrix, std::string& out); // writes into a reusable buffer, keeping its capacity
 BitMatrix ParseBitMatrix(const std::string& str, char one = 'X', bool expectSpace = true);
 void SaveAsPBM(const BitMatrix& matrix, const std::string filename, int quietZone = 0);
 
@@ -16,62 +16,43 @@ namespace ZXing {
 int
 BitSource::available() const
 {
-	return 8 * (Size(_bytes) - _byteOffset) - _bitOffset;
+	return 8 * Size(_bytes) - _bitPos;
 }
 
-static int ReadBitsImpl(int numBits, const ByteArray& _bytes, int available, int& _byteOffset, int& _bitOffset)
+// The stream is served from a 64 bit buffer holding the next not yet consumed bits left-aligned:
+// a read is one shift/mask once the buffer is topped up, instead of the byte-by-byte assembly with
+// per-byte offset bookkeeping this used to do for every segment of every 2D decode.
+static int ReadBitsImpl(int numBits, const ByteArray& bytes, int available, uint64_t& cache, int& cacheBits, int& nextByte)
 {
 	if (numBits < 1 || numBits > 32 || numBits > available) {
 		throw std::out_of_range("BitSource::readBits: out of range");
 	}
 
-	int result = 0;
-
-	// First, read remainder from current byte
-	if (_bitOffset > 0) {
-		int bitsLeft = 8 - _bitOffset;
-		int toRead = numBits < bitsLeft ? numBits : bitsLeft;
-		int bitsToNotRead = bitsLeft - toRead;
-		int mask = (0xFF >> (8 - toRead)) << bitsToNotRead;
-		result = (_bytes[_byteOffset] & mask) >> bitsToNotRead;
-		numBits -= toRead;
-		_bitOffset += toRead;
-		if (_bitOffset == 8) {
-			_bitOffset = 0;
-			_byteOffset++;
-		}
-	}
-
-	// Next read whole bytes
-	if (numBits > 0) {
-		while (numBits >= 8) {
-			result = (result << 8) | _bytes[_byteOffset];
-			_byteOffset++;
-			numBits -= 8;
-		}
-
-		// Finally read a partial byte
-		if (numBits > 0) {
-			int bitsToNotRead = 8 - numBits;
-			int mask = (0xFF >> bitsToNotRead) << bitsToNotRead;
-			result = (result << numBits) | ((_bytes[_byteOffset] & mask) >> bitsToNotRead);
-			_bitOffset += numBits;
-		}
+	// top up the buffer; numBits <= 32, so one pass is always sufficient
+	while (cacheBits <= 56 && nextByte < Size(bytes)) {
+		cache |= uint64_t(bytes[nextByte++]) << (56 - cacheBits);
+		cacheBits += 8;
 	}
 
+	int result = narrow_cast<int>(cache >> (64 - numBits));
+	cache <<= numBits;
+	cacheBits -= numBits;
 	return result;
 }
 
 int BitSource::readBits(int numBits)
 {
-	return ReadBitsImpl(numBits, _bytes, available(), _byteOffset, _bitOffset);
+	int result = ReadBitsImpl(numBits, _bytes, available(), _cache, _cacheBits, _nextByte);
+	_bitPos += numBits;
+	return result;
 }
 
 int BitSource::peakBits(int numBits) const
 {
-	int bitOffset = _bitOffset;
-	int byteOffset = _byteOffset;
-	return ReadBitsImpl(numBits, _bytes, available(), byteOffset, bitOffset);
+	uint64_t cache = _cache;
+	int cacheBits = _cacheBits;
+	int nextByte = _nextByte;
+	return ReadBitsImpl(numBits, _bytes, available(), cache, cacheBits, nextByte);
 }
 
 } // ZXing
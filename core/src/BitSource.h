@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace ZXing {
 
 class ByteArray;
@@ -22,8 +24,10 @@ class ByteArray;
 class BitSource
 {
 	const ByteArray& _bytes;
-	int _byteOffset = 0;
-	int _bitOffset = 0;
+	uint64_t _cache = 0; // the next not yet consumed bits of the stream, most significant bit first
+	int _cacheBits = 0;  // number of valid bits in _cache
+	int _nextByte = 0;   // index of the next byte to move into _cache
+	int _bitPos = 0;     // number of bits consumed so far
 
 public:
 	/**
@@ -40,14 +44,14 @@ public:
 	* @return index of next bit in current byte which would be read by the next call to {@link #readBits(int)}.
 	*/
 	int bitOffset() const {
-		return _bitOffset;
+		return _bitPos % 8;
 	}
 
 	/**
 	* @return index of next byte in input byte array which would be read by the next call to {@link #readBits(int)}.
 	*/
 	int byteOffset() const {
-		return _byteOffset;
+		return _bitPos / 8;
 	}
 
 	/**
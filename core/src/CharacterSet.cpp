@@ -8,7 +8,6 @@
 
 #include "ZXAlgorithms.h"
 
-#include <algorithm>
 #include <cctype>
 
 namespace ZXing {
@@ -19,7 +18,7 @@ struct CharacterSetName
 	CharacterSet cs;
 };
 
-static CharacterSetName NAME_TO_CHARSET[] = {
+static constexpr CharacterSetName NAME_TO_CHARSET[] = {
 	{"Cp437",		CharacterSet::Cp437},
 	{"ISO-8859-1",	CharacterSet::ISO8859_1},
 	{"ISO-8859-2",	CharacterSet::ISO8859_2},
@@ -64,21 +63,27 @@ static CharacterSetName NAME_TO_CHARSET[] = {
 	{"BINARY",		CharacterSet::BINARY},
 };
 
-static std::string NormalizeName(std::string_view sv)
+// Case-insensitive comparison ignoring the "_-[] " separator characters, so e.g. "ISO-8859-1",
+// "ISO 8859 1" and "iso88591" all match, without allocating a normalized copy of every table entry.
+static bool NameEquals(std::string_view a, std::string_view b)
 {
-	std::string str(sv);
-	std::transform(str.begin(), str.end(), str.begin(), [](char c) { return (char)std::tolower(c); });
-#ifdef __cpp_lib_erase_if
-	std::erase_if(str, [](char c) { return Contains("_-[] ", c); });
-#else
-	str.erase(std::remove_if(str.begin(), str.end(), [](char c) { return Contains("_-[] ", c); }), str.end());
-#endif
-	return str;
+	auto isSep = [](char c) { return Contains("_-[] ", c); };
+	auto ai = a.begin(), bi = b.begin();
+	while (true) {
+		while (ai != a.end() && isSep(*ai))
+			++ai;
+		while (bi != b.end() && isSep(*bi))
+			++bi;
+		if (ai == a.end() || bi == b.end())
+			return ai == a.end() && bi == b.end();
+		if (std::tolower(static_cast<unsigned char>(*ai++)) != std::tolower(static_cast<unsigned char>(*bi++)))
+			return false;
+	}
 }
 
 CharacterSet CharacterSetFromString(std::string_view name)
 {
-	auto i = FindIf(NAME_TO_CHARSET, [str = NormalizeName(name)](auto& v) { return NormalizeName(v.name) == str; });
+	auto i = FindIf(NAME_TO_CHARSET, [name](auto& v) { return NameEquals(v.name, name); });
 	return i == std::end(NAME_TO_CHARSET) ? CharacterSet::Unknown : i->cs;
 }
 
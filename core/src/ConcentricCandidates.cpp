@@ -0,0 +1,66 @@
+/*
+* Copyright 2026 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ConcentricCandidates.h"
+
+#include "BitMatrix.h"
+#include "Pattern.h"
+#include "ZXConfig.h"
+#ifdef ZXING_READER_AZTEC
+#include "aztec/AZDetector.h"
+#endif
+#ifdef ZXING_READER_QRCODE
+#include "qrcode/QRDetector.h"
+#endif
+
+#include <algorithm>
+#include <climits>
+
+namespace ZXing {
+
+ConcentricCandidateSets FindConcentricCandidates(const BitMatrix& image, bool tryHarder, int qrMaxVerticalModules)
+{
+	int height = image.height();
+
+	// the row grids replicate those of QRCode::FindFinderPatterns and Aztec::FindFinderPatterns
+	constexpr int QR_MIN_SKIP = 3;
+	int qrSkip = (3 * height) / (4 * qrMaxVerticalModules);
+	if (qrSkip < QR_MIN_SKIP || tryHarder)
+		qrSkip = QR_MIN_SKIP;
+
+	int azSkip = tryHarder ? 1 : std::clamp(height / 2 / 100, 1, 5);
+	int azMargin = tryHarder ? 5 : height / 4;
+	int azEnd = height - azMargin;
+
+	ConcentricCandidateSets res;
+	PatternRow row;
+
+	int nextQR = qrSkip - 1, nextAZ = azMargin < azEnd ? azMargin : INT_MAX;
+#ifndef ZXING_READER_QRCODE
+	nextQR = INT_MAX;
+#endif
+#ifndef ZXING_READER_AZTEC
+	nextAZ = INT_MAX;
+#endif
+	for (int y = std::min(nextQR, nextAZ); y < height; y = std::min(nextQR, nextAZ)) {
+		GetPatternRow(image, y, row, false);
+#ifdef ZXING_READER_QRCODE
+		if (y == nextQR) {
+			QRCode::FindFinderPatternsInRow(image, row, y, res.qr);
+			nextQR += qrSkip;
+		}
+#endif
+#ifdef ZXING_READER_AZTEC
+		if (y == nextAZ) {
+			Aztec::FindFinderPatternsInRow(image, row, y, res.aztec);
+			nextAZ = nextAZ + azSkip < azEnd ? nextAZ + azSkip : INT_MAX;
+		}
+#endif
+	}
+
+	return res;
+}
+
+} // ZXing
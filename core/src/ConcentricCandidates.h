@@ -0,0 +1,32 @@
+/*
+* Copyright 2026 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ConcentricFinder.h"
+
+#include <vector>
+
+namespace ZXing {
+
+class BitMatrix;
+
+/**
+* Result of the shared concentric candidate stage: both the QR and the Aztec detector start out
+* with a full-frame row sweep for their respective concentric finder pattern. When a scan includes
+* both formats, FindConcentricCandidates() performs a single sweep that run-length encodes each
+* row only once and matches both patterns on it, classifying the candidates by their ring
+* structure. The first detector that runs stores the sets in the BinaryBitmap, the second one
+* consumes its set without touching the image again.
+*/
+struct ConcentricCandidateSets
+{
+	std::vector<ConcentricPattern> qr, aztec;
+};
+
+// qrMaxVerticalModules determines the QR row skip, see QRCode::FindFinderPatterns()
+ConcentricCandidateSets FindConcentricCandidates(const BitMatrix& image, bool tryHarder, int qrMaxVerticalModules);
+
+} // ZXing
@@ -49,7 +49,9 @@ void Content::switchEncoding(ECI eci, bool isECI)
 	// remove all non-ECI entries on first ECI entry
 	if (isECI && !hasECI)
 		encodings.clear();
-	if (isECI || !hasECI)
+	// consecutive switches to the same non-ECI charset carry no information, keeping the single
+	// entry of the (most common) one-charset symbol saves the vector growth entirely
+	if ((isECI || !hasECI) && (isECI || encodings.empty() || encodings.back().eci != eci))
 		encodings.push_back({eci, Size(bytes)});
 
 	hasECI |= isECI;
@@ -206,6 +208,10 @@ ByteArray Content::bytesECI() const
 CharacterSet Content::guessEncoding() const
 {
 #ifdef ZXING_READERS
+	// without any ECI segments the whole payload is the input, no need to assemble a copy
+	if (encodings.empty())
+		return bytes.empty() ? CharacterSet::Unknown : GuessTextEncoding(bytes.asView());
+
 	// assemble all blocks with unknown encoding
 	ByteArray input;
 	ForEachECIBlock([&](ECI eci, int begin, int end) {
@@ -238,20 +244,22 @@ ContentType Content::type() const
 	if (bytes.size() > 6 && bytes.asString(0, 4) == "[)>\x1E" && std::isdigit(bytes[4]) && std::isdigit(bytes[5]))
 		return ContentType::ISO15434;
 
-	ECI fallback = ToECI(guessEncoding());
-	std::vector<bool> binaryECIs;
+	// an explicitly configured character set (see ReaderOptions::characterSet) makes guessing redundant
+	ECI fallback = ToECI(defaultCharset != CharacterSet::Unknown ? defaultCharset : guessEncoding());
+	bool anyBinary = false, anyText = false;
 	ForEachECIBlock([&](ECI eci, int begin, int end) {
 		if (eci == ECI::Unknown)
 			eci = fallback;
-		binaryECIs.push_back((!IsText(eci)
-							  || (ToInt(eci) > 0 && ToInt(eci) < 28 && ToInt(eci) != 25
-								  && std::any_of(bytes.begin() + begin, bytes.begin() + end,
-												 [](auto c) { return c < 0x20 && c != 0x9 && c != 0xa && c != 0xd; }))));
+		bool isBinary = (!IsText(eci)
+						 || (ToInt(eci) > 0 && ToInt(eci) < 28 && ToInt(eci) != 25
+							 && std::any_of(bytes.begin() + begin, bytes.begin() + end,
+											[](auto c) { return c < 0x20 && c != 0x9 && c != 0xa && c != 0xd; })));
+		(isBinary ? anyBinary : anyText) = true;
 	});
 
-	if (!Contains(binaryECIs, true))
+	if (!anyBinary)
 		return ContentType::Text;
-	if (!Contains(binaryECIs, false))
+	if (!anyText)
 		return ContentType::Binary;
 
 	return ContentType::Mixed;
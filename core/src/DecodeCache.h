@@ -0,0 +1,99 @@
+/*
+* Copyright 2026 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "BarcodeFormat.h"
+#include "BitMatrix.h"
+#include "DecoderResult.h"
+#include "ZXAlgorithms.h"
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ZXing {
+
+/**
+* Frame-to-frame decode cache for the matrix code readers (see ScanContext): a symbol that stays in
+* view across video frames is detected anew in every frame but its sampled module grid is bit-for-bit
+* identical, so the error correction and content parsing work of the decoder is redundant. The cache
+* keys each successfully decoded symbol by format, grid dimension and a hash over the sampled modules
+* and returns a copy of the stored DecoderResult on a match. The position is not part of the key: the
+* fresh DetectorResult of the current frame provides it, so a cache hit still reports the up-to-date
+* location of a moving symbol. Failed decodes are not cached, marginal symbols get their full retry
+* cascade every frame.
+*
+* The cache is shared between the layer- and candidate-parallel workers of a scan, hence the mutex.
+* Lookups copy the entry out under the lock; the copy is cheap relative to even a single
+* Reed-Solomon block decode.
+*/
+class DecodeCache
+{
+	struct Entry
+	{
+		BarcodeFormat format;
+		int width, height;
+		uint64_t hash;
+		DecoderResult result;
+	};
+
+	std::mutex _mutex;
+	std::vector<Entry> _entries; // small FIFO, oldest entry is evicted first
+
+	static constexpr int MAX_ENTRIES = 8;
+
+public:
+	static uint64_t Hash(const BitMatrix& bits)
+	{
+		// FNV-1a over the (contiguous, byte-per-module) grid
+		uint64_t hash = 0xcbf29ce484222325;
+		for (int y = 0; y < bits.height(); ++y)
+			for (auto v : bits.row(y))
+				hash = (hash ^ v) * 0x100000001b3;
+		return hash;
+	}
+
+	std::optional<DecoderResult> find(BarcodeFormat format, const BitMatrix& bits, uint64_t hash)
+	{
+		std::lock_guard lock(_mutex);
+		for (auto& e : _entries)
+			if (e.hash == hash && e.format == format && e.width == bits.width() && e.height == bits.height())
+				return e.result.copy();
+		return std::nullopt;
+	}
+
+	void add(BarcodeFormat format, const BitMatrix& bits, uint64_t hash, const DecoderResult& result)
+	{
+		std::lock_guard lock(_mutex);
+		for (auto& e : _entries)
+			if (e.hash == hash && e.format == format && e.width == bits.width() && e.height == bits.height())
+				return;
+		if (Size(_entries) >= MAX_ENTRIES)
+			_entries.erase(_entries.begin());
+		_entries.push_back({format, bits.width(), bits.height(), hash, result.copy()});
+	}
+
+	/**
+	* Convenience wrapper used at the reader's decode call sites: looks the grid up in the cache (if
+	* there is one), otherwise runs the given decode function and stores a valid result.
+	*/
+	template <typename DecodeFunc>
+	static DecoderResult FindOrDecode(DecodeCache* cache, BarcodeFormat format, const BitMatrix& bits, DecodeFunc&& decode)
+	{
+		if (!cache)
+			return decode();
+		auto hash = Hash(bits);
+		if (auto cached = cache->find(format, bits, hash))
+			return std::move(*cached);
+		auto result = decode();
+		if (result.isValid())
+			cache->add(format, bits, hash, result);
+		return result;
+	}
+};
+
+} // ZXing
@@ -0,0 +1,63 @@
+/*
+* Copyright 2025 ZXing authors
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ZXConfig.h"
+
+#include <cstdint>
+
+namespace ZXing {
+
+/**
+ * Cheap, always-on diagnostic counters of the barcode reading pipeline.
+ *
+ * In contrast to the opt-in ZX_ENABLE_PROFILING timings (see Profiler.h) and the LogMatrix debug
+ * visualization, these are plain per-thread integer increments that are safe to keep enabled in
+ * release/production builds. They help answer why the decode rate of a deployment dropped (e.g.
+ * candidates are still found but Reed-Solomon correction fails) without access to the input frames.
+ */
+// WARNING: this API is experimental and may change/disappear
+struct DecodeCounters
+{
+	int32_t symbolCandidates = 0;   ///< candidate symbol regions detected (e.g. QR finder pattern sets)
+	int32_t gridsSampled = 0;       ///< candidate regions that reached perspective grid sampling (2D symbologies)
+	int32_t rowPatternsScanned = 0; ///< pattern rows handed to the linear (1D) decoders
+	int32_t rsDecodeCalls = 0;      ///< Reed-Solomon error correction invocations
+	int32_t rsDecodeFailures = 0;   ///< ...that failed to correct the codewords
+	int32_t decodeErrors = 0;       ///< candidates aborted during decode (format/checksum error)
+
+	DecodeCounters& operator+=(const DecodeCounters& other)
+	{
+		symbolCandidates += other.symbolCandidates;
+		gridsSampled += other.gridsSampled;
+		rowPatternsScanned += other.rowPatternsScanned;
+		rsDecodeCalls += other.rsDecodeCalls;
+		rsDecodeFailures += other.rsDecodeFailures;
+		decodeErrors += other.decodeErrors;
+		return *this;
+	}
+};
+
+namespace detail {
+inline ZX_THREAD_LOCAL DecodeCounters decodeCounters;
+}
+
+/**
+ * Counters accumulated by the last ReadBarcodes() call on the calling thread (each call resets them
+ * on entry). Counts from internal worker threads (see ReaderOptions::maxNumberOfThreads) are merged
+ * back into the calling thread's counters before ReadBarcodes() returns.
+ */
+inline const DecodeCounters& LastDecodeCounters()
+{
+	return detail::decodeCounters;
+}
+
+inline void ResetDecodeCounters()
+{
+	detail::decodeCounters = {};
+}
+
+} // ZXing
@@ -29,12 +29,15 @@ class DecoderResult
 	int _versionNumber = 0;
 	StructuredAppendInfo _structuredAppend;
 	bool _isMirrored = false;
+	bool _isInverted = false;
 	bool _readerInit = false;
 	Error _error;
 	std::string _json;
 	std::shared_ptr<CustomData> _customData;
 
-	DecoderResult(const DecoderResult &) = delete;
+	// Copying is kept out of the public interface to prevent accidental deep copies of the Content,
+	// use the explicit copy() below where one is actually required (see e.g. DecodeCache).
+	DecoderResult(const DecoderResult &) = default;
 	DecoderResult& operator=(const DecoderResult &) = delete;
 
 public:
@@ -45,6 +48,8 @@ public:
 	DecoderResult(DecoderResult&&) noexcept = default;
 	DecoderResult& operator=(DecoderResult&&) noexcept = default;
 
+	DecoderResult copy() const { return *this; }
+
 	bool isValid(bool includeErrors = false) const
 	{
 		return (!_content.bytes.empty() && !_error) || (includeErrors && !!_error);
@@ -78,6 +83,7 @@ public:
 	ZX_PROPERTY(StructuredAppendInfo, structuredAppend, setStructuredAppend)
 	ZX_PROPERTY(Error, error, setError)
 	ZX_PROPERTY(bool, isMirrored, setIsMirrored)
+	ZX_PROPERTY(bool, isInverted, setIsInverted)
 	ZX_PROPERTY(bool, readerInit, setReaderInit)
 	ZX_PROPERTY(std::string, json, setJson)
 	ZX_PROPERTY(std::shared_ptr<CustomData>, customData, setCustomData)
@@ -10,6 +10,9 @@
 #include "Quadrilateral.h"
 
 #include <utility>
+#ifdef ZXING_EXPERIMENTAL_API
+#include <vector>
+#endif
 
 namespace ZXing {
 
@@ -22,6 +25,9 @@ class DetectorResult
 {
 	BitMatrix _bits;
 	QuadrilateralI _position;
+#ifdef ZXING_EXPERIMENTAL_API
+	std::vector<PointI> _weakModules;
+#endif
 
 	DetectorResult(const DetectorResult&) = delete;
 	DetectorResult& operator=(const DetectorResult&) = delete;
@@ -39,6 +45,17 @@ public:
 	QuadrilateralI&& position() && { return std::move(_position); }
 
 	bool isValid() const { return !_bits.empty(); }
+
+#ifdef ZXING_EXPERIMENTAL_API
+	/**
+	* Modules whose binarized sample neighborhood was not unanimous, ordered by ascending confidence
+	* (see SampleGrid). Consumed by the soft-decision decode retry in QRCode::Decode.
+	*
+	* WARNING: this API is experimental and may change/disappear
+	*/
+	void setWeakModules(std::vector<PointI>&& weakModules) { _weakModules = std::move(weakModules); }
+	const std::vector<PointI>& weakModules() const { return _weakModules; }
+#endif
 };
 
 } // ZXing
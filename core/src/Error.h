@@ -5,8 +5,9 @@
 
 #pragma once
 
-#include <string>
 #include <cstdint>
+#include <string>
+#include <string_view>
 
 namespace ZXing {
 
@@ -32,15 +33,35 @@ class Error
 {
 public:
 	enum class Type : uint8_t { None, Format, Checksum, Unsupported };
+
+	// Lightweight message carrier for the constructors: a string literal is kept as a plain pointer,
+	// so constructing an Error on a speculative decode path that is about to be discarded does not
+	// allocate. The std::string is rendered lazily in msg() on first access.
+	struct Msg
+	{
+		const char* literal;
+		std::string owned;
+		Msg() : literal(nullptr) {}
+		Msg(const char* msg) : literal(msg) {} // msg must point to a string with static storage duration
+		Msg(std::string msg) : literal(nullptr), owned(std::move(msg)) {}
+	};
+
 	Type type() const noexcept { return _type; }
-	const std::string& msg() const noexcept { return _msg; }
+	const std::string& msg() const
+	{
+		if (_literal && _msg.empty())
+			_msg = _literal;
+		return _msg;
+	}
 	explicit operator bool() const noexcept { return _type != Type::None; }
 
 	std::string location() const;
 
 	Error() = default;
-	Error(Type type, std::string msg = {}) : _msg(std::move(msg)), _type(type) {}
-	Error(const char* file, short line, Type type, std::string msg = {}) : _msg(std::move(msg)), _file(file), _line(line), _type(type) {}
+	Error(Type type, Msg msg = {}) : _msg(std::move(msg.owned)), _literal(msg.literal), _type(type) {}
+	Error(const char* file, short line, Type type, Msg msg = {})
+		: _msg(std::move(msg.owned)), _literal(msg.literal), _file(file), _line(line), _type(type)
+	{}
 
 	static constexpr auto Format = Type::Format;
 	static constexpr auto Checksum = Type::Checksum;
@@ -48,12 +69,15 @@ public:
 
 	inline bool operator==(const Error& o) const noexcept
 	{
-		return _type == o._type && _msg == o._msg && _file == o._file && _line == o._line;
+		return _type == o._type && msgView() == o.msgView() && _file == o._file && _line == o._line;
 	}
 	inline bool operator!=(const Error& o) const noexcept { return !(*this == o); }
 
 protected:
-	std::string _msg;
+	std::string_view msgView() const noexcept { return _literal ? std::string_view(_literal) : std::string_view(_msg); }
+
+	mutable std::string _msg;
+	const char* _literal = nullptr;
 	const char* _file = nullptr;
 	short _line = -1;
 	Type _type = Type::None;
@@ -64,9 +88,9 @@ inline bool operator!=(const Error& e, Error::Type t) noexcept { return !(e == t
 inline bool operator==(Error::Type t, const Error& e) noexcept { return e.type() == t; }
 inline bool operator!=(Error::Type t, const Error& e) noexcept { return !(t == e); }
 
-#define FormatError(...) Error(__FILE__, __LINE__, Error::Format, std::string(__VA_ARGS__))
-#define ChecksumError(...) Error(__FILE__, __LINE__, Error::Checksum, std::string(__VA_ARGS__))
-#define UnsupportedError(...) Error(__FILE__, __LINE__, Error::Unsupported, std::string(__VA_ARGS__))
+#define FormatError(...) Error(__FILE__, __LINE__, Error::Format, ZXing::Error::Msg(__VA_ARGS__))
+#define ChecksumError(...) Error(__FILE__, __LINE__, Error::Checksum, ZXing::Error::Msg(__VA_ARGS__))
+#define UnsupportedError(...) Error(__FILE__, __LINE__, Error::Unsupported, ZXing::Error::Msg(__VA_ARGS__))
 
 std::string ToString(const Error& e);
 
@@ -0,0 +1,131 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "BinaryBitmap.h"
+#include "BitHacks.h"
+#include "BitMatrix.h"
+#include "Pattern.h"
+#include "ReadBarcode.h" // BitMatrixView
+
+#include <cstdint>
+#include <cstring>
+
+namespace ZXing {
+
+#ifdef ZXING_EXPERIMENTAL_API
+
+/**
+* Serves an externally computed black matrix (see BitMatrixView) in place of the built-in
+* binarizers: the pattern rows of the linear readers are run-length encoded straight from the
+* packed bits and the BitMatrix of the 2D readers is a plain unpack of them. This is the CPU side
+* of a GPU (compute shader) binarization backend, which hands over 1 bit per pixel instead of a
+* luminance buffer.
+*/
+class ExternalBinarizer : public BinaryBitmap
+{
+	const uint8_t* _bits = nullptr;
+	int _rowStride = 0;
+
+	bool bit(int x, int y) const { return (_bits[y * _rowStride + (x >> 3)] >> (x & 7)) & 1; }
+
+public:
+	explicit ExternalBinarizer(const BitMatrixView& mask)
+		// the base class buffer is only ever used for its dimensions here, both overrides below read
+		// the packed bits directly
+		: BinaryBitmap(ImageView(mask.data, mask.width, mask.height, ImageFormat::Lum,
+								 mask.rowStride ? mask.rowStride : (mask.width + 7) / 8, 1)),
+		  _bits(mask.data),
+		  _rowStride(mask.rowStride ? mask.rowStride : (mask.width + 7) / 8)
+	{}
+
+	bool getPatternRowImpl(int row, int rotation, PatternRow& res) const override
+	{
+		res.clear();
+
+		if (rotation == 0) {
+			// the input is conveniently packed already: extract the run lengths with the same
+			// transition-word trick as the SIMD path in ThresholdBinarizer
+			const uint8_t* data = _bits + row * _rowStride;
+			const int w = width();
+			uint64_t lastBit = 0; // the color of the pixel before the current word, starting with white
+			int pos = 0, lastPos = 0;
+			auto addTransitions = [&](uint64_t m, int n) {
+				uint64_t t = (m ^ (m << 1 | lastBit)) & (n == 64 ? ~0ULL : (1ULL << n) - 1);
+				while (t) {
+					int i = BitHacks::NumberOfTrailingZeros(t);
+					res.push_back(narrow_cast<PatternRow::value_type>(pos + i - lastPos));
+					lastPos = pos + i;
+					t &= t - 1;
+				}
+				lastBit = m >> (n - 1) & 1;
+				pos += n;
+			};
+
+			int x = 0;
+			for (; x + 64 <= w; x += 64) {
+				uint64_t m;
+				memcpy(&m, data + x / 8, sizeof(m));
+				addTransitions(m, 64);
+			}
+			if (x < w) {
+				uint64_t m = 0;
+				for (int j = 0; x + j < w; ++j)
+					m |= uint64_t(bit(x + j, row)) << j;
+				addTransitions(m, w - x);
+			}
+
+			res.push_back(narrow_cast<PatternRow::value_type>(w - lastPos));
+			if (lastBit)
+				res.push_back(0); // last value is number of white pixels, here 0
+
+			return true;
+		}
+
+		// map the rotated coordinates back into the unrotated mask, see ImageView::rotated()
+		auto bitAt = [this, rotation, row](int x) {
+			switch (rotation) {
+			case 90: return bit(row, height() - 1 - x);
+			case 180: return bit(width() - 1 - x, height() - 1 - row);
+			default: return bit(width() - 1 - row, x); // 270
+			}
+		};
+
+		const int w = rotation % 180 == 0 ? width() : height();
+		bool lastVal = false;
+		int lastPos = 0;
+		for (int x = 0; x < w; ++x) {
+			bool val = bitAt(x);
+			if (val != lastVal) {
+				res.push_back(narrow_cast<PatternRow::value_type>(x - lastPos));
+				lastVal = val;
+				lastPos = x;
+			}
+		}
+
+		res.push_back(narrow_cast<PatternRow::value_type>(w - lastPos));
+		if (lastVal)
+			res.push_back(0); // last value is number of white pixels, here 0
+
+		return true;
+	}
+
+	std::shared_ptr<const BitMatrix> getBlackMatrix() const override
+	{
+		auto res = std::make_shared<BitMatrix>(width(), height());
+		for (int y = 0; y < height(); ++y) {
+			const uint8_t* src = _bits + y * _rowStride;
+			auto* dst = res->row(y).begin();
+			for (int x = 0, w = width(); x < w; ++x)
+				dst[x] = (src[x >> 3] >> (x & 7) & 1) * BitMatrix::SET_V;
+		}
+		return res;
+	}
+};
+
+#endif // ZXING_EXPERIMENTAL_API
+
+} // ZXing
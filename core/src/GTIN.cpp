@@ -8,9 +8,9 @@
 
 #include "Barcode.h"
 
-#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iomanip>
-#include <iterator>
 #include <sstream>
 #include <string>
 
@@ -23,11 +23,6 @@ struct CountryId
 	const char id[3];
 };
 
-bool operator<(const CountryId& lhs, const CountryId& rhs)
-{
-	return lhs.last < rhs.last;
-}
-
 // https://www.gs1.org/standards/id-keys/company-prefix (as of 7 Feb 2022)
 // and https://en.wikipedia.org/wiki/List_of_GS1_country_codes
 static const CountryId COUNTRIES[] = {
@@ -157,6 +152,22 @@ static const CountryId COUNTRIES[] = {
 	// clang-format on
 };
 
+// flat prefix -> country index built once on first use: one table load per lookup instead of a
+// binary search over the ranges above
+static const char* CountryOfPrefix(int prefix)
+{
+	static const auto table = [] {
+		std::array<uint8_t, 1000> t = {}; // index into COUNTRIES + 1, 0 means unassigned
+		static_assert(Size(COUNTRIES) < 0xff);
+		for (uint8_t i = 0; i < Size(COUNTRIES); ++i)
+			for (int p = COUNTRIES[i].first; p <= COUNTRIES[i].last; ++p)
+				t[p] = i + 1;
+		return t;
+	}();
+
+	return prefix >= 0 && prefix < Size(table) && table[prefix] ? COUNTRIES[table[prefix] - 1].id : nullptr;
+}
+
 std::string LookupCountryIdentifier(const std::string& GTIN, const BarcodeFormat format)
 {
 	// Ignore add-on if any
@@ -194,9 +205,9 @@ std::string LookupCountryIdentifier(const std::string& GTIN, const BarcodeFormat
 	if (size == 8 && format == BarcodeFormat::EAN8 && prefix <= 99) // Restricted Circulation Numbers
 		return {};
 
-	const auto it = std::lower_bound(std::begin(COUNTRIES), std::end(COUNTRIES), CountryId{0, narrow_cast<uint16_t>(prefix), ""});
+	const char* id = CountryOfPrefix(prefix);
 
-	return it != std::end(COUNTRIES) && prefix >= it->first && prefix <= it->last ? it->id : std::string();
+	return id ? id : std::string();
 }
 
 std::string EanAddOn(const Barcode& barcode)
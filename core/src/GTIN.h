@@ -18,12 +18,11 @@ namespace ZXing::GTIN {
 template <typename T>
 T ComputeCheckDigit(const std::basic_string<T>& digits, bool skipTail = false)
 {
+	// single forward pass with branch-free alternation of the 3-1-3-... weights (the digit in
+	// front of the check digit position carries weight 3), which the compiler can vectorize
 	int sum = 0, N = Size(digits) - skipTail;
-	for (int i = N - 1; i >= 0; i -= 2)
-		sum += digits[i] - '0';
-	sum *= 3;
-	for (int i = N - 2; i >= 0; i -= 2)
-		sum += digits[i] - '0';
+	for (int i = 0, w = N % 2 ? 3 : 1; i < N; ++i, w ^= 2)
+		sum += w * (digits[i] - '0');
 	return ToDigit<T>((10 - (sum % 10)) % 10);
 }
 
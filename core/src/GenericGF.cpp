@@ -6,104 +6,115 @@
 
 #include "GenericGF.h"
 
+#include <array>
+
 namespace ZXing {
 
+/**
+* Compile-time generated exp/log tables of GF(Size) using the given primitive polynomial, whose
+* coefficients are represented by the bits of Primitive, where the least-significant bit
+* represents the constant coefficient. The tables live in .rodata (shared between processes) and
+* the GenericGF instances below are constant-initialized, so no field pays any runtime setup.
+*/
+template <int Primitive, int Size>
+struct GFTable
+{
+#ifdef ZX_REED_SOLOMON_USE_MORE_MEMORY_FOR_SPEED
+	static constexpr int EXP_SIZE = Size * 2;
+#else
+	static constexpr int EXP_SIZE = Size;
+#endif
+	std::array<short, EXP_SIZE> exp = {};
+	std::array<short, Size> log = {};
+
+	constexpr GFTable()
+	{
+		int x = 1;
+		for (int i = 0; i < Size; ++i) {
+			exp[i] = x;
+			x *= 2; // we're assuming the generator alpha is 2
+			if (x >= Size) {
+				x ^= Primitive;
+				x &= Size - 1;
+			}
+		}
+
+#ifdef ZX_REED_SOLOMON_USE_MORE_MEMORY_FOR_SPEED
+		for (int i = Size - 1; i < Size * 2; ++i)
+			exp[i] = exp[i - (Size - 1)];
+#endif
+
+		for (int i = 0; i < Size - 1; ++i)
+			log[exp[i]] = i;
+		// log[0] == 0 but this should never be used
+	}
+};
+
+template <int Primitive, int Size>
+constexpr GFTable<Primitive, Size> gfTable{};
+
 const GenericGF &
 GenericGF::AztecData12()
 {
-	static GenericGF inst(0x1069, 4096, 1); // x^12 + x^6 + x^5 + x^3 + 1
+	constexpr auto& table = gfTable<0x1069, 4096>; // x^12 + x^6 + x^5 + x^3 + 1
+	static constexpr GenericGF inst(4096, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::AztecData10()
 {
-	static GenericGF inst(0x409, 1024, 1); // x^10 + x^3 + 1
+	constexpr auto& table = gfTable<0x409, 1024>; // x^10 + x^3 + 1
+	static constexpr GenericGF inst(1024, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::AztecData6()
 {
-	static GenericGF inst(0x43, 64, 1); // x^6 + x + 1
+	constexpr auto& table = gfTable<0x43, 64>; // x^6 + x + 1
+	static constexpr GenericGF inst(64, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::AztecParam()
 {
-	static GenericGF inst(0x13, 16, 1); // x^4 + x + 1
+	constexpr auto& table = gfTable<0x13, 16>; // x^4 + x + 1
+	static constexpr GenericGF inst(16, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::QRCodeField256()
 {
-	static GenericGF inst(0x011D, 256, 0); // x^8 + x^4 + x^3 + x^2 + 1
+	constexpr auto& table = gfTable<0x011D, 256>; // x^8 + x^4 + x^3 + x^2 + 1
+	static constexpr GenericGF inst(256, 0, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::DataMatrixField256()
 {
-	static GenericGF inst(0x012D, 256, 1); // x^8 + x^5 + x^3 + x^2 + 1
+	constexpr auto& table = gfTable<0x012D, 256>; // x^8 + x^5 + x^3 + x^2 + 1
+	static constexpr GenericGF inst(256, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::AztecData8()
 {
-	static const GenericGF inst(0x012D, 256, 1); // = DATA_MATRIX_FIELD_256;
+	constexpr auto& table = gfTable<0x012D, 256>; // = DATA_MATRIX_FIELD_256;
+	static constexpr GenericGF inst(256, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
 const GenericGF &
 GenericGF::MaxiCodeField64()
 {
-	static const GenericGF inst(0x43, 64, 1); // = AZTEC_DATA_6;
+	constexpr auto& table = gfTable<0x43, 64>; // = AZTEC_DATA_6;
+	static constexpr GenericGF inst(64, 1, table.exp.data(), table.log.data());
 	return inst;
 }
 
-
-/**
-* Create a representation of GF(size) using the given primitive polynomial.
-*
-* @param primitive irreducible polynomial whose coefficients are represented by
-*  the bits of an int, where the least-significant bit represents the constant
-*  coefficient
-* @param size the size of the field
-* @param b the factor b in the generator polynomial can be 0- or 1-based
-*  (g(x) = (x+a^b)(x+a^(b+1))...(x+a^(b+2t-1))).
-*  In most cases it should be 1, but for QR code it is 0.
-*/
-GenericGF::GenericGF(int primitive, int size, int b) :
-	_size(size),
-	_generatorBase(b)
-{
-#ifdef ZX_REED_SOLOMON_USE_MORE_MEMORY_FOR_SPEED
-	_expTable.resize(size * 2, 0);
-#else
-	_expTable.resize(size, 0);
-#endif
-	_logTable.resize(size, 0);
-	int x = 1;
-	for (int i = 0; i < size; ++i) {
-		_expTable[i] = x;
-		x *= 2; // we're assuming the generator alpha is 2
-		if (x >= size) {
-			x ^= primitive;
-			x &= size - 1;
-		}
-	}
-
-#ifdef ZX_REED_SOLOMON_USE_MORE_MEMORY_FOR_SPEED
-	for (int i = size - 1; i < size * 2; ++i)
-		_expTable[i] = _expTable[i - (size - 1)];
-#endif
-
-	for (int i = 0; i < size - 1; ++i)
-		_logTable[_expTable[i]] = i;
-	// logTable[0] == 0 but this should never be used
-}
-
 } // namespace ZXing
@@ -10,7 +10,6 @@
 #include "ZXConfig.h"
 
 #include <stdexcept>
-#include <vector>
 
 namespace ZXing {
 
@@ -29,21 +28,21 @@ class GenericGF
 {
 	const int _size;
 	int _generatorBase;
-	std::vector<short> _expTable;
-	std::vector<short> _logTable;
+	const short* _expTable;
+	const short* _logTable;
 
 	/**
-	* Create a representation of GF(size) using the given primitive polynomial.
+	* Create a representation of GF(size) backed by the given compile-time generated exp/log
+	* tables (see GFTable in GenericGF.cpp).
 	*
-	* @param primitive irreducible polynomial whose coefficients are represented by
-	*  the bits of an int, where the least-significant bit represents the constant
-	*  coefficient
 	* @param size the size of the field (m = log2(size) is called the word size of the encoding)
 	* @param b the factor b in the generator polynomial can be 0- or 1-based
 	*  (g(x) = (x+a^b)(x+a^(b+1))...(x+a^(b+2t-1))).
 	*  In most cases it should be 1, but for QR code it is 0.
 	*/
-	GenericGF(int primitive, int size, int b);
+	constexpr GenericGF(int size, int b, const short* expTable, const short* logTable)
+		: _size(size), _generatorBase(b), _expTable(expTable), _logTable(logTable)
+	{}
 
 public:
 	static const GenericGF& AztecData12();
@@ -63,7 +62,7 @@ public:
 	* @return 2 to the power of a in GF(size)
 	*/
 	int exp(int a) const {
-		return _expTable.at(a);
+		return _expTable[a];
 	}
 
 	/**
@@ -73,7 +72,7 @@ public:
 		if (a == 0) {
 			throw std::invalid_argument("a == 0");
 		}
-		return _logTable.at(a);
+		return _logTable[a];
 	}
 
 	/**
@@ -102,6 +101,27 @@ public:
 #endif
 	}
 
+	/**
+	* @return product of a and the non-zero element whose log is logB
+	*
+	* This is the kernel of polynomial evaluation at a fixed point (syndrome computation, root
+	* search, Forney): looking the constant factor's log up once outside the Horner loop leaves one
+	* log and one exp lookup per coefficient.
+	*/
+	int multiplyByLog(int a, int logB) const noexcept {
+		if (a == 0)
+			return 0;
+
+#ifdef ZX_REED_SOLOMON_USE_MORE_MEMORY_FOR_SPEED
+		return _expTable[_logTable[a] + logB];
+#else
+		auto fast_mod = [](const int input, const int ceil) {
+			return input < ceil ? input : input - ceil;
+		};
+		return _expTable[fast_mod(_logTable[a] + logB, _size - 1)];
+#endif
+	}
+
 	int size() const noexcept {
 		return _size;
 	}
@@ -25,8 +25,10 @@ GenericGFPoly::evaluateAt(int a) const
 	if (a == 1) // return the sum of the coefficients
 		return Reduce(_coefficients, 0, [](auto s, auto c) { return s ^ c; });
 
+	// a is constant across the Horner loop, so its log is looked up only once
+	int logA = _field->log(a);
 	return std::accumulate(_coefficients.begin(), _coefficients.end(), 0,
-						   [this, a](auto s, auto c) { return _field->multiply(a, s) ^ c; });
+						   [this, logA](auto s, auto c) { return _field->multiplyByLog(s, logA) ^ c; });
 }
 
 GenericGFPoly& GenericGFPoly::addOrSubtract(GenericGFPoly& other)
@@ -88,6 +88,19 @@ public:
 		_field = &field;
 		return *this;
 	}
+
+	/**
+	 * @brief set field and coefficients in place, reusing existing storage (see malloc caching)
+	 */
+	GenericGFPoly& set(const GenericGF& field, const std::vector<int>& coefficients)
+	{
+		assert(!coefficients.empty());
+		_field = &field;
+		_coefficients.reserve(coefficients.size());
+		_coefficients.assign(coefficients.begin(), coefficients.end());
+		normalize();
+		return *this;
+	}
 	const GenericGF& field() const noexcept { return *_field; }
 	const auto& coefficients() const noexcept { return _coefficients; }
 
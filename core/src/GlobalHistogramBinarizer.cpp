@@ -48,7 +48,26 @@ static void ThresholdSharpened(const ImageLineView in, int threshold, std::vecto
 static auto GenHistogram(const ImageLineView line)
 {
 	// This code causes about 20% of the total runtime on an AVX2 system for a EAN13 search on Lum input data.
-	// Trying to increase the performance by performing 2 or 4 "parallel" histograms helped nothing.
+	if (line.begin().stride == 1) {
+		// Four independent accumulators break the store-to-load dependency that arises when neighboring
+		// pixels hit the same bucket, which is the common case in flat image areas. This is a measurable
+		// win on in-order ARM cores and performance neutral on out-of-order x86 hardware.
+		std::array<Histogram, 4> h = {};
+		const uint8_t* p = line.begin().pos;
+		const uint8_t* end = p + line.size();
+		for (; p + 4 <= end; p += 4) {
+			h[0][p[0] >> LUMINANCE_SHIFT]++;
+			h[1][p[1] >> LUMINANCE_SHIFT]++;
+			h[2][p[2] >> LUMINANCE_SHIFT]++;
+			h[3][p[3] >> LUMINANCE_SHIFT]++;
+		}
+		for (; p != end; ++p)
+			h[0][*p >> LUMINANCE_SHIFT]++;
+		for (int i = 0; i < Size(h[0]); ++i)
+			h[0][i] += h[1][i] + h[2][i] + h[3][i];
+		return h[0];
+	}
+
 	Histogram res = {};
 	for (auto pix : line)
 		res[pix >> LUMINANCE_SHIFT]++;
@@ -103,7 +122,35 @@ static int EstimateBlackPoint(const Histogram& buckets)
 	return bestValley << LUMINANCE_SHIFT;
 }
 
-bool GlobalHistogramBinarizer::getPatternRow(int row, int rotation, PatternRow& res) const
+// Reading a column one pixel at a time misses the cache on every access. Transposing a whole band
+// of 32 adjacent columns costs barely more than gathering one (all 32 bytes of a row share a cache
+// line or two), so the vertical sweep visiting a second column in the same band already breaks
+// even and a dense (tryHarder) sweep approaches the streaming behavior of the horizontal rows.
+// Bands are materialized on demand, a sweep that exits early only pays for what it touched.
+const uint8_t* GlobalHistogramBinarizer::transposedRow(int x) const
+{
+	constexpr int BAND = 32;
+	const int h = height(), rowStride = _buffer.rowStride(), band = x / BAND;
+
+	std::lock_guard lock(_transposedMutex);
+	if (_transposedBands.empty())
+		_transposedBands.resize((width() + BAND - 1) / BAND);
+
+	auto& buf = _transposedBands[band];
+	if (!buf) {
+		const int x0 = band * BAND, bandW = std::min(BAND, width() - x0);
+		buf = std::make_unique_for_overwrite<uint8_t[]>(size_t(bandW) * h);
+		const uint8_t* src = _buffer.data(x0, 0);
+		// stored bottom-up, i.e. directly in rotated(90) order: the row readers sweep the vertical
+		// orientation exclusively as rotation 90, which can then be served without any further copy
+		for (int y = h - 1; y >= 0; --y, src += rowStride)
+			for (int tx = 0; tx < bandW; ++tx)
+				buf[size_t(tx) * h + y] = src[tx];
+	}
+	return buf.get() + size_t(x - band * BAND) * h;
+}
+
+bool GlobalHistogramBinarizer::getPatternRowImpl(int row, int rotation, PatternRow& res) const
 {
 	auto buffer = _buffer.rotated(rotation);
 	auto lineView = RowView(buffer, row);
@@ -111,13 +158,25 @@ bool GlobalHistogramBinarizer::getPatternRow(int row, int rotation, PatternRow&
 	if (buffer.width() < 3)
 		return false; // special casing the code below for a width < 3 makes no sense
 
-#if defined(__AVX__) // or defined(__ARM_NEON)
-	// If we are extracting a column (instead of a row), we run into cache misses on every pixel access both
-	// during the histogram calculation and during the sharpen+threshold operation. Additionally, if we
-	// perform the ThresholdSharpened function on pixStride==1 data, the auto-vectorizer makes that part
-	// 8x faster on an AVX2 cpu which easily recovers the extra cost that we pay for the copying.
+	// If we are extracting a column (instead of a row), we run into cache misses on every pixel access
+	// both during the histogram calculation and during the sharpen+threshold operation. Additionally,
+	// if we perform the ThresholdSharpened function on pixStride==1 data, the auto-vectorizer makes
+	// that part 8x faster on an AVX2 cpu which easily recovers the extra cost that we pay for the
+	// copying. Single channel buffers serve the columns from lazily transposed bands (see
+	// transposedRow) instead of gathering them one cache miss per pixel here.
 	ZX_THREAD_LOCAL std::vector<uint8_t> line;
-	if (std::abs(buffer.pixStride()) > 4) {
+	if (bool rot90 = (rotation + 360) % 360 == 90; rotation % 180 != 0 && _buffer.pixStride() == 1) {
+		const uint8_t* tRow = transposedRow(rot90 ? row : width() - 1 - row);
+		if (rot90) { // the bands are stored in rotated(90) order, no copy required
+			lineView = {{tRow, 1}, {tRow + height(), 1}};
+		} else {
+			line.resize(height());
+			std::reverse_copy(tRow, tRow + height(), line.begin());
+			lineView = {{line.data(), 1}, {line.data() + line.size(), 1}};
+		}
+	}
+#if defined(__AVX__) // or defined(__ARM_NEON)
+	else if (std::abs(buffer.pixStride()) > 4) {
 		line.resize(lineView.size());
 		std::copy(lineView.begin(), lineView.end(), line.begin());
 		lineView = {{line.data(), 1}, {line.data() + line.size(), 1}};
@@ -8,6 +8,8 @@
 
 #include "BinaryBitmap.h"
 
+#include <mutex>
+
 namespace ZXing {
 
 /**
@@ -23,11 +25,19 @@ namespace ZXing {
 */
 class GlobalHistogramBinarizer : public BinaryBitmap
 {
+	// lazily transposed 32-column bands of a single channel luminance buffer, so the vertical
+	// (rotation 90/270) pattern row extraction streams memory like the horizontal one and the
+	// transposition cost is only paid for the bands the sweep actually visits, see getPatternRowImpl
+	mutable std::mutex _transposedMutex;
+	mutable std::vector<std::unique_ptr<uint8_t[]>> _transposedBands;
+
+	const uint8_t* transposedRow(int x) const;
+
 public:
 	explicit GlobalHistogramBinarizer(const ImageView& buffer);
 	~GlobalHistogramBinarizer() override;
 
-	bool getPatternRow(int row, int rotation, PatternRow &res) const override;
+	bool getPatternRowImpl(int row, int rotation, PatternRow &res) const override;
 	std::shared_ptr<const BitMatrix> getBlackMatrix() const override;
 };
 
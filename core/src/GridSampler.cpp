@@ -7,6 +7,12 @@
 
 #include "GridSampler.h"
 
+#include "DecodeCounters.h"
+#include "ZXAlgorithms.h"
+
+#include <algorithm>
+#include <utility>
+
 #ifdef PRINT_DEBUG
 #include "LogMatrix.h"
 #include "BitMatrixIO.h"
@@ -18,13 +24,16 @@ namespace ZXing {
 LogMatrix log;
 #endif
 
-DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const PerspectiveTransform& mod2Pix)
+DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const PerspectiveTransform& mod2Pix,
+						  bool collectWeakModules)
 {
-	return SampleGrid(image, width, height, {ROI{0, width, 0, height, mod2Pix}});
+	return SampleGrid(image, width, height, {ROI{0, width, 0, height, mod2Pix}}, collectWeakModules);
 }
 
-DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const ROIs& rois)
+DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const ROIs& rois,
+						  bool collectWeakModules [[maybe_unused]])
 {
+	++detail::decodeCounters.gridsSampled;
 #ifdef PRINT_DEBUG
 	LogMatrix log;
 	static int i = 0;
@@ -41,8 +50,54 @@ DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const R
 	}
 
 	BitMatrix res(width, height);
+#ifdef ZXING_EXPERIMENTAL_API
+	// Modules whose binarized 3x3 pixel neighborhood around the sample point is not unanimous (see
+	// also the disabled majority-sampling experiment below), with the number of agreeing neighbors
+	// as confidence. Consumed by the soft-decision decode retry, see QRDecoder.
+	std::vector<std::pair<int, PointI>> weak;
+	auto sample = [&](int x, int y, PointF p) {
+		bool v = image.get(p);
+		if (v)
+			res.set(x, y);
+		if (!collectWeakModules)
+			return;
+		auto differs = [&](int dx, int dy) {
+			PointF q = p + PointF(dx, dy);
+			return int(image.isIn(q) && image.get(q) != v);
+		};
+		// pre-filter with two axial neighbors: most modules of a clean symbol are unanimous and cost
+		// only two extra reads
+		int nDiff = differs(1, 0) + differs(0, 1);
+		if (nDiff == 0)
+			return;
+		nDiff += differs(-1, 0) + differs(0, -1) + differs(-1, -1) + differs(1, -1) + differs(-1, 1) + differs(1, 1);
+		if (nDiff >= 2)
+			weak.emplace_back(8 - nDiff, PointI(x, y));
+	};
+#else
+	auto sample = [&](int x, int y, PointF p) {
+		if (image.get(p))
+			res.set(x, y);
+	};
+#endif
 	for (auto&& [x0, x1, y0, y1, mod2Pix] : rois) {
-		for (int y = y0; y < y1; ++y)
+		for (int y = y0; y < y1; ++y) {
+			auto pa = centered(PointI{x0, y}), pb = centered(PointI{x1 - 1, y});
+			// If the row is projected onto the straight segment between the projections of its two end
+			// points (no pole of the projection in between) and those are inside the image, then so is
+			// every inner point and the per-point isIn check below can be skipped. The homogeneous
+			// coordinates are then stepped incrementally along the row instead of evaluating the full
+			// transform per module.
+			if (mod2Pix.isSegmentMappedToSegment(pa, pb) && image.isIn(mod2Pix(pa)) && image.isIn(mod2Pix(pb))) {
+				mod2Pix.projectRow(pa, x1 - x0, [&sample, x0 = x0, y](int i, PointF p) {
+#ifdef PRINT_DEBUG
+					log(p, 3);
+#endif
+					sample(x0 + i, y, p);
+				});
+				continue;
+			}
+
 			for (int x = x0; x < x1; ++x) {
 				auto p = mod2Pix(centered(PointI{x, y}));
 				// Due to a "numerical instability" in the PerspectiveTransform generation/application it has been observed
@@ -62,11 +117,12 @@ DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const R
 					for (int dx = -1; dx <= 1; ++dx)
 						sum += image.get(p + PointF(dx, dy));
 				if (sum >= 5)
+					res.set(x, y);
 #else
-				if (image.get(p))
+				sample(x, y, p);
 #endif
-					res.set(x, y);
 			}
+		}
 	}
 
 #ifdef PRINT_DEBUG
@@ -82,8 +138,23 @@ DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const R
 		return PointI();
 	};
 
-	return {std::move(res),
-			{projectCorner({0, 0}), projectCorner({width, 0}), projectCorner({width, height}), projectCorner({0, height})}};
+	DetectorResult result(std::move(res), {projectCorner({0, 0}), projectCorner({width, 0}), projectCorner({width, height}),
+										   projectCorner({0, height})});
+#ifdef ZXING_EXPERIMENTAL_API
+	// A marginal but genuine symbol has a few borderline modules; a false candidate on a textured
+	// background has non-unanimous neighborhoods all over the grid. Only mark the former as weak, a
+	// retry budget spent on the latter would multiply the worst-case workload (see WorstCaseWorkloadTest).
+	if (!weak.empty() && Size(weak) <= width * height / 16) {
+		// keep only the least confident few: each of them costs one decode retry on checksum failure
+		constexpr int maxWeakModules = 16;
+		std::sort(weak.begin(), weak.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		weak.resize(std::min(Size(weak), maxWeakModules));
+		std::vector<PointI> weakModules(weak.size());
+		std::transform(weak.begin(), weak.end(), weakModules.begin(), [](const auto& w) { return w.second; });
+		result.setWeakModules(std::move(weakModules));
 	}
+#endif
+	return result;
+}
 
 } // ZXing
@@ -33,10 +33,14 @@ namespace ZXing {
 * @param width width of {@link BitMatrix} to sample from image
 * @param height height of {@link BitMatrix} to sample from image
 * @param mod2Pix transforming a module (grid) coordinate into an image (pixel) coordinate
+* @param collectWeakModules if true, record the modules whose binarized sample neighborhood is not
+*   unanimous in DetectorResult::weakModules() (ordered by ascending confidence), to be consumed by
+*   the soft-decision decode retry (experimental API only, otherwise ignored)
 * @return {@link DetectorResult} representing a grid of points sampled from the image within a region
 *   defined by the "src" parameters. Result is empty if transformation is invalid (out of bound access).
 */
-DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const PerspectiveTransform& mod2Pix);
+DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const PerspectiveTransform& mod2Pix,
+						  bool collectWeakModules = false);
 
 template <typename PointT = PointF>
 Quadrilateral<PointT> Rectangle(int x0, int x1, int y0, int y1, typename PointT::value_t o = 0.5)
@@ -53,6 +57,6 @@ public:
 
 using ROIs = std::vector<ROI>;
 
-DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const ROIs& rois);
+DetectorResult SampleGrid(const BitMatrix& image, int width, int height, const ROIs& rois, bool collectWeakModules = false);
 
 } // ZXing
@@ -9,6 +9,7 @@
 
 #include "ZXAlgorithms.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <string_view>
@@ -256,18 +257,67 @@ static const AiInfo aiInfos[] = {
 	{ "8200", -70 },
 };
 
+//TODO: c++20
+static bool StartsWith(std::string_view str, std::string_view pre)
+{
+	return str.substr(0, pre.size()) == pre;
+}
+
+static int AiBucket(std::string_view s)
+{
+	auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+	return isDigit(s[0]) && isDigit(s[1]) ? (s[0] - '0') * 10 + (s[1] - '0') : -1;
+}
+
+// The AI prefixes are 2 to 4 digits long and prefix-free, so the first two digits either select the
+// unique two-digit entry directly or narrow the search down to the few longer entries sharing them.
+// This turns the per-element-string scan over the whole table into an O(1) dispatch.
+static const AiInfo* FindAiInfo(std::string_view rem)
+{
+	struct Index
+	{
+		int16_t twoDigit[100];
+		int16_t bucket[100 + 1];
+		int16_t longer[Size(aiInfos)];
+	};
+	static const Index idx = [] {
+		Index idx = {};
+		std::fill(std::begin(idx.twoDigit), std::end(idx.twoDigit), int16_t(-1));
+		int16_t n = 0;
+		for (int16_t i = 0; i < Size(aiInfos); ++i)
+			if (strlen(aiInfos[i].aiPrefix) == 2)
+				idx.twoDigit[AiBucket(aiInfos[i].aiPrefix)] = i;
+			else
+				idx.longer[n++] = i;
+		std::sort(idx.longer, idx.longer + n,
+				  [](int16_t a, int16_t b) { return AiBucket(aiInfos[a].aiPrefix) < AiBucket(aiInfos[b].aiPrefix); });
+		for (int16_t b = 0, i = 0; b <= 100; idx.bucket[b++] = i)
+			while (i < n && AiBucket(aiInfos[idx.longer[i]].aiPrefix) < b)
+				++i;
+		return idx;
+	}();
+
+	int b = rem.size() >= 2 ? AiBucket(rem) : -1;
+	if (b == -1)
+		return nullptr;
+	if (idx.twoDigit[b] != -1)
+		return &aiInfos[idx.twoDigit[b]];
+	for (int i = idx.bucket[b]; i < idx.bucket[b + 1]; ++i)
+		if (StartsWith(rem, aiInfos[idx.longer[i]].aiPrefix))
+			return &aiInfos[idx.longer[i]];
+	return nullptr;
+}
+
 std::string HRIFromGS1(std::string_view gs1)
 {
-	//TODO: c++20
-	auto starts_with = [](std::string_view str, std::string_view pre) { return str.substr(0, pre.size()) == pre; };
 	constexpr char GS = 29; // GS character (29 / 0x1D)
 
 	std::string_view rem = gs1;
 	std::string res;
 
 	while (rem.size()) {
-		const AiInfo* i = FindIf(aiInfos, [&](const AiInfo& i) { return starts_with(rem, i.aiPrefix); });
-		if (i == std::end(aiInfos))
+		const AiInfo* i = FindAiInfo(rem);
+		if (!i)
 			return {};
 
 		int aiSize = i->aiSize();
@@ -8,11 +8,22 @@
 
 #include "BitMatrix.h"
 #include "Matrix.h"
+#include "ThreadPool.h"
+#include "ZXConfig.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
 #include <memory>
+#include <thread>
+#include <vector>
+
+#ifdef ZX_HAVE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #define USE_NEW_ALGORITHM
 
@@ -24,15 +35,31 @@ static constexpr int BLOCK_SIZE = 8;
 static constexpr int WINDOW_SIZE = BLOCK_SIZE * (1 + 2 * 2);
 static constexpr int MIN_DYNAMIC_RANGE = 24;
 
-HybridBinarizer::HybridBinarizer(const ImageView& iv) : GlobalHistogramBinarizer(iv) {}
+HybridBinarizer::HybridBinarizer(const ImageView& iv, int maxThreads) : GlobalHistogramBinarizer(iv), _maxThreads(maxThreads) {}
+
+// Runs func(rowBegin, rowEnd) over contiguous bands of [0, totalRows) on up to maxThreads worker threads.
+template <typename F>
+static void ForRowBands(int totalRows, int maxThreads, F func)
+{
+	int n = std::clamp(maxThreads ? maxThreads : int(std::thread::hardware_concurrency()), 1, totalRows);
+	if (n <= 1)
+		return func(0, totalRows);
+
+	int band = (totalRows + n - 1) / n;
+	std::atomic<int> next = 0;
+	RunParallel(n, [&] {
+		for (int i = next++; i < n; i = next++)
+			func(i * band, std::min((i + 1) * band, totalRows));
+	});
+}
 
 HybridBinarizer::~HybridBinarizer() = default;
 
-bool HybridBinarizer::getPatternRow(int row, int rotation, PatternRow& res) const
+bool HybridBinarizer::getPatternRowImpl(int row, int rotation, PatternRow& res) const
 {
 #if 1
 	// This is the original "hybrid" behavior: use GlobalHistogram for the 1D case
-	return GlobalHistogramBinarizer::getPatternRow(row, rotation, res);
+	return GlobalHistogramBinarizer::getPatternRowImpl(row, rotation, res);
 #else
 	// This is an alternative that can be faster in general and perform better in unevenly lit sitations like
 	// https://github.com/zxing-cpp/zxing-cpp/blob/master/test/samples/ean13-2/21.png. That said, it fairs
@@ -53,6 +80,21 @@ using T_t = uint8_t;
 static void ThresholdBlock(const uint8_t* __restrict luminances, int xoffset, int yoffset, T_t threshold, int rowStride,
 						   BitMatrix& matrix)
 {
+	static_assert(BLOCK_SIZE == 8, "the SIMD kernels below rely on 8 byte rows");
+
+#ifdef ZX_HAVE_SSE2
+	// one unsigned 'src <= threshold' compare for a whole block row: min(src, thr) == src yields
+	// 0xff (SET_V) exactly where src <= threshold
+	const __m128i thr = _mm_set1_epi8(static_cast<char>(threshold));
+	for (int y = yoffset; y < yoffset + BLOCK_SIZE; ++y) {
+		__m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(luminances + y * rowStride + xoffset));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(matrix.row(y).begin() + xoffset), _mm_cmpeq_epi8(_mm_min_epu8(v, thr), v));
+	}
+#elif defined(__ARM_NEON)
+	const uint8x8_t thr = vdup_n_u8(threshold);
+	for (int y = yoffset; y < yoffset + BLOCK_SIZE; ++y)
+		vst1_u8(matrix.row(y).begin() + xoffset, vcle_u8(vld1_u8(luminances + y * rowStride + xoffset), thr));
+#else
 	for (int y = yoffset; y < yoffset + BLOCK_SIZE; ++y) {
 		auto* src = luminances + y * rowStride + xoffset;
 		auto* const dstBegin = matrix.row(y).begin() + xoffset;
@@ -60,6 +102,7 @@ static void ThresholdBlock(const uint8_t* __restrict luminances, int xoffset, in
 		for (auto* dst = dstBegin; dst < dstBegin + BLOCK_SIZE; ++dst, ++src)
 			*dst = (*src <= threshold) * BitMatrix::SET_V;
 	}
+#endif
 }
 
 #ifndef USE_NEW_ALGORITHM
@@ -189,14 +232,15 @@ static std::shared_ptr<BitMatrix> CalculateMatrix(const uint8_t* __restrict lumi
 
 // Subdivide the image in blocks of BLOCK_SIZE and calculate one treshold value per block as
 // (max - min > MIN_DYNAMIC_RANGE) ? (max + min) / 2 : 0
-static Matrix<T_t> BlockThresholds(const ImageView iv)
+static Matrix<T_t> BlockThresholds(const ImageView iv, int maxThreads)
 {
 	int subWidth = (iv.width() + BLOCK_SIZE - 1) / BLOCK_SIZE; // ceil(width/BS)
 	int subHeight = (iv.height() + BLOCK_SIZE - 1) / BLOCK_SIZE; // ceil(height/BS)
 
 	Matrix<T_t> thresholds(subWidth, subHeight);
 
-	for (int y = 0; y < subHeight; y++) {
+	ForRowBands(subHeight, maxThreads, [&](int yBegin, int yEnd) {
+	for (int y = yBegin; y < yEnd; y++) {
 		int y0 = std::min(y * BLOCK_SIZE, iv.height() - BLOCK_SIZE);
 		for (int x = 0; x < subWidth; x++) {
 			int x0 = std::min(x * BLOCK_SIZE, iv.width() - BLOCK_SIZE);
@@ -211,6 +255,7 @@ static Matrix<T_t> BlockThresholds(const ImageView iv)
 			thresholds(x, y) = (max - min > MIN_DYNAMIC_RANGE) ? (int(max) + min) / 2 : 0;
 		}
 	}
+	});
 
 	return thresholds;
 }
@@ -221,22 +266,28 @@ static Matrix<T_t> SmoothThresholds(Matrix<T_t>&& in)
 	Matrix<T_t> out(in.width(), in.height());
 
 	constexpr int R = WINDOW_SIZE / BLOCK_SIZE / 2;
-	for (int y = 0; y < in.height(); y++) {
+
+	// integral images (summed-area tables) of the thresholds and their non-zero counts: each (2R+1)^2
+	// window average below becomes an O(1) lookup instead of a 25 element gather per block
+	Matrix<int32_t> sat(in.width() + 1, in.height() + 1), cnt(in.width() + 1, in.height() + 1);
+	for (int y = 0; y < in.height(); y++)
 		for (int x = 0; x < in.width(); x++) {
-			int left = std::clamp(x, R, in.width() - R - 1);
-			int top = std::clamp(y, R, in.height() - R - 1);
+			int t = in(x, y);
+			sat(x + 1, y + 1) = t + sat(x, y + 1) + sat(x + 1, y) - sat(x, y);
+			cnt(x + 1, y + 1) = (t > 0) + cnt(x, y + 1) + cnt(x + 1, y) - cnt(x, y);
+		}
+	auto window = [R](const Matrix<int32_t>& m, int left, int top) {
+		return m(left + 2 * R + 1, top + 2 * R + 1) - m(left, top + 2 * R + 1) - m(left + 2 * R + 1, top) + m(left, top);
+	};
 
-			int sum = in(x, y) * 2;
-			int n = (sum > 0) * 2;
-			auto add = [&](int x, int y) {
-				int t = in(x, y);
-				sum += t;
-				n += t > 0;
-			};
+	for (int y = 0; y < in.height(); y++) {
+		for (int x = 0; x < in.width(); x++) {
+			int left = std::clamp(x, R, in.width() - R - 1) - R;
+			int top = std::clamp(y, R, in.height() - R - 1) - R;
 
-			for (int dy = -R; dy <= R; ++dy)
-				for (int dx = -R; dx <= R; ++dx)
-					add(left + dx, top + dy);
+			// the center block is weighted 3x (1x from the window plus 2x extra)
+			int sum = in(x, y) * 2 + window(sat, left, top);
+			int n = (in(x, y) > 0) * 2 + window(cnt, left, top);
 
 			out(x, y) = n > 0 ? sum / n : 0;
 		}
@@ -256,7 +307,7 @@ static Matrix<T_t> SmoothThresholds(Matrix<T_t>&& in)
 	return out;
 }
 
-static std::shared_ptr<BitMatrix> ThresholdImage(const ImageView iv, const Matrix<T_t>& thresholds)
+static std::shared_ptr<BitMatrix> ThresholdImage(const ImageView iv, const Matrix<T_t>& thresholds, int maxThreads)
 {
 	auto matrix = std::make_shared<BitMatrix>(iv.width(), iv.height());
 
@@ -264,7 +315,8 @@ static std::shared_ptr<BitMatrix> ThresholdImage(const ImageView iv, const Matri
 	Matrix<uint8_t> out(iv.width(), iv.height());
 #endif
 
-	for (int y = 0; y < thresholds.height(); y++) {
+	auto processRows = [&](int yBegin, int yEnd) {
+	for (int y = yBegin; y < yEnd; y++) {
 		int yoffset = std::min(y * BLOCK_SIZE, iv.height() - BLOCK_SIZE);
 		for (int x = 0; x < thresholds.width(); x++) {
 			int xoffset = std::min(x * BLOCK_SIZE, iv.width() - BLOCK_SIZE);
@@ -277,6 +329,12 @@ static std::shared_ptr<BitMatrix> ThresholdImage(const ImageView iv, const Matri
 #endif
 		}
 	}
+	};
+
+	// the last block row overlaps the one above it whenever the height is not a multiple of BLOCK_SIZE,
+	// so it is thresholded after the workers finished to avoid writing the same rows from two threads
+	ForRowBands(thresholds.height() - 1, maxThreads, processRows);
+	processRows(thresholds.height() - 1, thresholds.height());
 
 #ifdef PRINT_DEBUG
 	std::ofstream file("thresholds_new.pnm");
@@ -289,12 +347,33 @@ static std::shared_ptr<BitMatrix> ThresholdImage(const ImageView iv, const Matri
 
 #endif
 
+#ifdef ZXING_EXPERIMENTAL_API
+static Image ToImage(const Matrix<T_t>& m)
+{
+	Image res(m.width(), m.height());
+	std::copy(m.begin(), m.end(), const_cast<uint8_t*>(res.data()));
+	return res;
+}
+
+const Image& HybridBinarizer::thresholdMap() const
+{
+	if (_thresholdMap.width() == 0 && width() >= WINDOW_SIZE && height() >= WINDOW_SIZE)
+		_thresholdMap = ToImage(BlockThresholds(_buffer, _maxThreads));
+	return _thresholdMap;
+}
+#endif
+
 std::shared_ptr<const BitMatrix> HybridBinarizer::getBlackMatrix() const
 {
 	if (width() >= WINDOW_SIZE && height() >= WINDOW_SIZE) {
 #ifdef USE_NEW_ALGORITHM
-		auto thrs = SmoothThresholds(BlockThresholds(_buffer));
-		return ThresholdImage(_buffer, thrs);
+		auto blocks = BlockThresholds(_buffer, _maxThreads);
+#ifdef ZXING_EXPERIMENTAL_API
+		// stash the block thresholds for thresholdMap() before they get consumed by the smoothing
+		_thresholdMap = ToImage(blocks);
+#endif
+		auto thrs = SmoothThresholds(std::move(blocks));
+		return ThresholdImage(_buffer, thrs, _maxThreads);
 #else
 		const uint8_t* luminances = _buffer.data();
 		int subWidth = (width() + BLOCK_SIZE - 1) / BLOCK_SIZE; // ceil(width/BS)
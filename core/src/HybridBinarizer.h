@@ -29,12 +29,29 @@ namespace ZXing {
 */
 class HybridBinarizer : public GlobalHistogramBinarizer
 {
+	int _maxThreads = 1;
+
 public:
-	explicit HybridBinarizer(const ImageView& iv);
+	/// maxThreads > 1 binarizes bands of block rows on that many worker threads (0 means one per core)
+	explicit HybridBinarizer(const ImageView& iv, int maxThreads = 1);
 	~HybridBinarizer() override;
 
-	bool getPatternRow(int row, int rotation, PatternRow &res) const override;
+	bool getPatternRowImpl(int row, int rotation, PatternRow &res) const override;
 	std::shared_ptr<const BitMatrix> getBlackMatrix() const override;
+
+#ifdef ZXING_EXPERIMENTAL_API
+	/**
+	* Returns the per 8x8 pixel block black point estimates that getBlackMatrix() computes anyway, as a
+	* width()/8 x height()/8 luminance image (empty for images smaller than the block window). This is
+	* a cheap illumination/contrast map of the frame that can e.g. drive a camera exposure control loop
+	* toward decodable contrast without a second full-frame analysis pass.
+	*/
+	// WARNING: this API is experimental and may change/disappear
+	const Image& thresholdMap() const;
+
+private:
+	mutable Image _thresholdMap;
+#endif
 };
 
 } // ZXing
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <memory>
+#include <new>
 #include <stdexcept>
 
 namespace ZXing {
@@ -16,7 +17,7 @@ namespace ZXing {
 enum class ImageFormat : uint32_t
 {
 	None = 0,
-	Lum  = 0x01000000,
+	Lum  = 0x01000000, ///< also matches the (leading) luminance plane of planar YUV formats, see YPlaneView()
 	LumA = 0x02000000,
 	RGB  = 0x03000102,
 	BGR  = 0x03020100,
@@ -134,14 +135,39 @@ public:
 
 };
 
+/**
+ * Creates a zero-copy ImageView of the luminance (Y) plane of a planar or semi-planar 8-bit YUV
+ * buffer as handed out by most camera APIs (NV12/NV21/I420/YV12/YUV420p...). The leading Y plane
+ * of all of these formats is dense 8-bit luminance with an optional row padding, which feeds the
+ * binarizers directly without the grayscale conversion copy that interleaved formats require.
+ *
+ * @param data  pointer to the start of the Y plane
+ * @param width  image width in pixels
+ * @param height  image height in pixels
+ * @param rowStride  optional row stride of the Y plane in bytes, default is width
+ */
+inline ImageView YPlaneView(const uint8_t* data, int width, int height, int rowStride = 0)
+{
+	return {data, width, height, ImageFormat::Lum, rowStride, 1};
+}
+
 class Image : public ImageView
 {
-	std::unique_ptr<uint8_t[]> _memory;
-	Image(std::unique_ptr<uint8_t[]>&& data, int w, int h, ImageFormat f) : ImageView(data.get(), w, h, f), _memory(std::move(data)) {}
+	// cache-line aligned buffer, so the vectorized luminance/binarization kernels start out aligned
+	struct AlignedDeleter
+	{
+		void operator()(uint8_t* p) const noexcept { ::operator delete[](p, std::align_val_t{64}); }
+	};
+	using Memory = std::unique_ptr<uint8_t[], AlignedDeleter>;
+
+	Memory _memory;
+	Image(Memory&& data, int w, int h, ImageFormat f) : ImageView(data.get(), w, h, f), _memory(std::move(data)) {}
 
 public:
 	Image() = default;
-	Image(int w, int h, ImageFormat f = ImageFormat::Lum) : Image(std::make_unique<uint8_t[]>(w * h * PixStride(f)), w, h, f) {}
+	Image(int w, int h, ImageFormat f = ImageFormat::Lum)
+		: Image(Memory(new (std::align_val_t{64}) uint8_t[w * h * PixStride(f)]()), w, h, f)
+	{}
 };
 
 } // ZXing
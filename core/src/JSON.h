@@ -14,24 +14,71 @@
 
 namespace ZXing {
 
-inline std::string JsonKeyValue(std::string_view key, std::string_view val)
+// Append a string value in quotes, escaping where JSON requires it. The fast path copies the
+// (typical) run of characters that need no escaping in one piece.
+inline void JsonAppendEscaped(std::string& json, std::string_view val)
 {
-	return val.empty() ? std::string() : StrCat("\"", key, "\":", val, ',');
+	json += '"';
+	while (!val.empty()) {
+		size_t n = 0;
+		while (n < val.size() && val[n] != '"' && val[n] != '\\' && static_cast<uint8_t>(val[n]) >= 0x20)
+			++n;
+		json.append(val.data(), n);
+		val.remove_prefix(n);
+		if (val.empty())
+			break;
+		char c = val.front();
+		val.remove_prefix(1);
+		switch (c) {
+		case '"': json += "\\\""; break;
+		case '\\': json += "\\\\"; break;
+		case '\b': json += "\\b"; break;
+		case '\f': json += "\\f"; break;
+		case '\n': json += "\\n"; break;
+		case '\r': json += "\\r"; break;
+		case '\t': json += "\\t"; break;
+		default: {
+			constexpr auto digits = "0123456789abcdef";
+			StrAppend(json, "\\u00", digits[(c >> 4) & 0xf], digits[c & 0xf]);
+		}
+		}
+	}
+	json += '"';
 }
 
+inline void JsonAppendKeyValue(std::string& json, std::string_view key, std::string_view val)
+{
+	if (!val.empty())
+		StrAppend(json, '"', key, "\":", val, ',');
+}
+
+// Append-style serialization into a caller provided (and thereby reusable) buffer.
 template<typename T>
-inline std::string JsonValue(std::string_view key, T val)
+inline void JsonAppendValue(std::string& json, std::string_view key, T val)
 {
-	if constexpr (std::is_same_v<T, bool>)
-		return val ? JsonKeyValue(key, "true") : "";
-	else if constexpr (std::is_arithmetic_v<T>)
-		return JsonKeyValue(key, std::to_string(val));
-	else if constexpr (std::is_convertible_v<T, std::string_view>)
-		return JsonKeyValue(key, StrCat("\"" , val, "\""));
-	else
+	if constexpr (std::is_same_v<T, bool>) {
+		if (val)
+			JsonAppendKeyValue(json, key, "true");
+	} else if constexpr (std::is_arithmetic_v<T>)
+		JsonAppendKeyValue(json, key, std::to_string(val));
+	else if constexpr (std::is_convertible_v<T, std::string_view>) {
+		if (!std::string_view(val).empty()) {
+			StrAppend(json, '"', key, "\":");
+			JsonAppendEscaped(json, val);
+			json += ',';
+		}
+	} else
 		static_assert("unsupported JSON value type");
 }
 
+template<typename T>
+inline std::string JsonValue(std::string_view key, T val)
+{
+	std::string res;
+	JsonAppendValue(res, key, val);
+	return res;
+}
+
 std::string_view JsonGetStr(std::string_view json, std::string_view key);
 
 template <typename T>
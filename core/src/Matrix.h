@@ -12,10 +12,33 @@
 #include <stdexcept>
 #include <algorithm>
 #include <cassert>
+#include <new>
 #include <vector>
 
 namespace ZXing {
 
+// Minimal std::allocator replacement returning cache-line (64 byte) aligned memory, so the
+// vectorized kernels operating on Matrix and Image buffers start out aligned and two buffers
+// never share a cache line.
+template <class T>
+struct CacheAlignedAllocator
+{
+	using value_type = T;
+	static constexpr std::align_val_t alignment{64};
+
+	CacheAlignedAllocator() = default;
+	template <class U>
+	constexpr CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept {}
+
+	T* allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), alignment)); }
+	void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, alignment); }
+
+	template <class U>
+	bool operator==(const CacheAlignedAllocator<U>&) const noexcept { return true; }
+	template <class U>
+	bool operator!=(const CacheAlignedAllocator<U>&) const noexcept { return false; }
+};
+
 template <class T>
 class Matrix
 {
@@ -25,7 +48,7 @@ public:
 private:
 	int _width = 0;
 	int _height = 0;
-	std::vector<value_t> _data;
+	std::vector<value_t, CacheAlignedAllocator<value_t>> _data;
 
 	// Nothing wrong to support it, just to make it explicit, instead of by mistake.
 	// Use copy() below.
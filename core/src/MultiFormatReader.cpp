@@ -9,14 +9,30 @@
 #include "BarcodeFormat.h"
 #include "BinaryBitmap.h"
 #include "ReaderOptions.h"
+#include "Profiler.h"
+#include "ZXConfig.h"
+#ifdef ZXING_READER_AZTEC
 #include "aztec/AZReader.h"
+#endif
+#ifdef ZXING_READER_DATAMATRIX
 #include "datamatrix/DMReader.h"
+#endif
+#ifdef ZXING_READER_MAXICODE
 #include "maxicode/MCReader.h"
+#endif
+#ifdef ZXING_READER_LINEARCODES
 #include "oned/ODReader.h"
+#endif
+#ifdef ZXING_READER_PDF417
 #include "pdf417/PDFReader.h"
+#endif
+#ifdef ZXING_READER_QRCODE
 #include "qrcode/QRReader.h"
+#endif
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 namespace ZXing {
 
@@ -24,30 +40,84 @@ MultiFormatReader::MultiFormatReader(const ReaderOptions& opts) : _opts(opts)
 {
 	auto formats = opts.formats().empty() ? BarcodeFormat::Any : opts.formats();
 
+#ifdef ZXING_EXPERIMENTAL_API
+	auto add = [&](Reader* reader, ReaderKind kind) {
+		_readers.emplace_back(reader);
+		_kinds.push_back(kind);
+	};
+#else
+	enum class ReaderKind { Linear, Matrix, Any }; // tags only, the routing needs the experimental API
+	auto add = [&](Reader* reader, ReaderKind) { _readers.emplace_back(reader); };
+#endif
+
+#ifdef ZXING_READER_LINEARCODES
 	// Put linear readers upfront in "normal" mode
 	if (formats.testFlags(BarcodeFormat::LinearCodes) && !opts.tryHarder())
-		_readers.emplace_back(new OneD::Reader(opts));
+		add(new OneD::Reader(opts), ReaderKind::Linear);
+#endif
 
+#ifdef ZXING_READER_QRCODE
 	if (formats.testFlags(BarcodeFormat::QRCode | BarcodeFormat::MicroQRCode | BarcodeFormat::RMQRCode))
-		_readers.emplace_back(new QRCode::Reader(opts, true));
+		add(new QRCode::Reader(opts, true), ReaderKind::Matrix);
+#endif
+#ifdef ZXING_READER_DATAMATRIX
 	if (formats.testFlag(BarcodeFormat::DataMatrix))
-		_readers.emplace_back(new DataMatrix::Reader(opts, true));
+		add(new DataMatrix::Reader(opts, true), ReaderKind::Matrix);
+#endif
+#ifdef ZXING_READER_AZTEC
 	if (formats.testFlag(BarcodeFormat::Aztec))
-		_readers.emplace_back(new Aztec::Reader(opts, true));
+		add(new Aztec::Reader(opts, true), ReaderKind::Matrix);
+#endif
+#ifdef ZXING_READER_PDF417
 	if (formats.testFlag(BarcodeFormat::PDF417))
-		_readers.emplace_back(new Pdf417::Reader(opts));
+		add(new Pdf417::Reader(opts), ReaderKind::Any);
+#endif
+#ifdef ZXING_READER_MAXICODE
 	if (formats.testFlag(BarcodeFormat::MaxiCode))
-		_readers.emplace_back(new MaxiCode::Reader(opts));
+		add(new MaxiCode::Reader(opts), ReaderKind::Matrix);
+#endif
 
+#ifdef ZXING_READER_LINEARCODES
 	// At end in "try harder" mode
 	if (formats.testFlags(BarcodeFormat::LinearCodes) && opts.tryHarder())
-		_readers.emplace_back(new OneD::Reader(opts));
+		add(new OneD::Reader(opts), ReaderKind::Linear);
+#endif
+
+#ifdef ZXING_EXPERIMENTAL_API
+	_hits = std::make_unique<std::atomic<uint16_t>[]>(_readers.size()); // value-initialized to 0
+#endif
+}
+
+#ifdef ZXING_EXPERIMENTAL_API
+// The reader try-order of readMultiple(), most successful first. A stable sort keeps the deliberate
+// construction order (linear readers first unless tryHarder, etc.) between readers with equal
+// history, so a fresh instance behaves exactly like the fixed order did.
+std::vector<int> MultiFormatReader::readerOrder() const
+{
+	std::vector<int> order(_readers.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+		return _hits[a].load(std::memory_order_relaxed) > _hits[b].load(std::memory_order_relaxed);
+	});
+	return order;
+}
+
+void MultiFormatReader::recordHit(int i) const
+{
+	// halve all counters before one saturates: this bounds the values and makes the order follow the
+	// observed distribution with a sliding-window-like weighting when it shifts
+	if (_hits[i].fetch_add(1, std::memory_order_relaxed) >= 1 << 12)
+		for (size_t j = 0; j < _readers.size(); ++j)
+			_hits[j].store(_hits[j].load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
 }
+#endif
 
 MultiFormatReader::~MultiFormatReader() = default;
 
 Barcode MultiFormatReader::read(const BinaryBitmap& image) const
 {
+	ZX_PROFILE_SCOPE(Decode);
+
 	Barcode r;
 	for (const auto& reader : _readers) {
 		r = reader->decode(image);
@@ -59,9 +129,31 @@ Barcode MultiFormatReader::read(const BinaryBitmap& image) const
 
 Barcodes MultiFormatReader::readMultiple(const BinaryBitmap& image, int maxSymbols) const
 {
+	ZX_PROFILE_SCOPE(Decode);
+
 	Barcodes res;
 
+#ifdef ZXING_EXPERIMENTAL_API
+	// Route detector work by coarse tile content (see BinaryBitmap::classifyContent): a frame whose
+	// tiles are all strongly anisotropic (nothing but bars) skips the 2D finder cascades, an empty
+	// frame skips everything. Only in the fast path: tryHarder keeps scanning exhaustively, and the
+	// classification errs towards running a reader whenever a tile could plausibly feed it.
+	bool route = !_opts.tryHarder() && !_opts.isPure() && _readers.size() > 1;
+	auto content = route ? image.classifyContent() : BinaryBitmap::ContentClassification{};
+
+	// Try the readers in the order of their observed hit rate: with BarcodeFormat::Any, a frame
+	// stream whose actual format distribution is stable (e.g. a scanner lane seeing mostly Code128)
+	// otherwise pays the full matrix detection cascade on every frame before the linear reader even
+	// runs. The counters live for the session (see CompiledReaders), so the order adapts within a
+	// few frames and the early-exit below then triggers before the rarely-seen readers.
+	for (int readerIdx : readerOrder()) {
+		const auto& reader = _readers[readerIdx];
+		if ((_kinds[readerIdx] != ReaderKind::Matrix && !content.hasLinear && !content.hasMatrix)
+			|| (_kinds[readerIdx] == ReaderKind::Matrix && !content.hasMatrix))
+			continue;
+#else
 	for (const auto& reader : _readers) {
+#endif
 		if (image.inverted() && !reader->supportsInversion)
 			continue;
 		auto r = reader->decode(image, maxSymbols);
@@ -73,6 +165,10 @@ Barcodes MultiFormatReader::readMultiple(const BinaryBitmap& image, int maxSymbo
 			r.erase(it, r.end());
 #endif
 		}
+#ifdef ZXING_EXPERIMENTAL_API
+		if (std::any_of(r.begin(), r.end(), [](auto&& s) { return s.isValid(); }))
+			recordHit(readerIdx);
+#endif
 		maxSymbols -= Size(r);
 		res.insert(res.end(), std::move_iterator(r.begin()), std::move_iterator(r.end()));
 		if (maxSymbols <= 0)
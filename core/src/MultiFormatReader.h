@@ -8,6 +8,10 @@
 
 #include "Barcode.h"
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include <atomic>
+#endif
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -30,6 +34,20 @@ public:
 	Barcodes readMultiple(const BinaryBitmap& image, int maxSymbols = 0xFF) const;
 
 private:
+#ifdef ZXING_EXPERIMENTAL_API
+	// what kind of image content a reader can possibly decode, used by the tile content routing in
+	// readMultiple(). PDF417 is Any: its stacked bar structure reads as linear to the tile statistics.
+	enum class ReaderKind : uint8_t { Linear, Matrix, Any };
+	std::vector<ReaderKind> _kinds;
+
+	std::vector<int> readerOrder() const;
+	void recordHit(int i) const;
+
+	// per-reader success counters driving the adaptive try-order of readMultiple(), see there.
+	// Mutable/atomic because one (session-lived, see CompiledReaders) instance serves all
+	// layer-parallel workers of DoReadBarcodes concurrently.
+	mutable std::unique_ptr<std::atomic<uint16_t>[]> _hits;
+#endif
 	std::vector<std::unique_ptr<Reader>> _readers;
 	const ReaderOptions& _opts;
 };
@@ -58,8 +58,8 @@ MultiFormatWriter::encode(const std::wstring& contents, int width, int height) c
 	switch (_format) {
 	case BarcodeFormat::Aztec: return exec1(Aztec::Writer(), AztecEccLevel);
 	case BarcodeFormat::DataMatrix: return exec2(DataMatrix::Writer());
-	case BarcodeFormat::PDF417: return exec1(Pdf417::Writer(), Pdf417EccLevel);
-	case BarcodeFormat::QRCode: return exec1(QRCode::Writer(), QRCodeEccLevel);
+	case BarcodeFormat::PDF417: return exec1(Pdf417::Writer().setOptimalSegmentation(_optimalSegmentation), Pdf417EccLevel);
+	case BarcodeFormat::QRCode: return exec1(QRCode::Writer().setOptimalSegmentation(_optimalSegmentation), QRCodeEccLevel);
 	case BarcodeFormat::Codabar: return exec0(OneD::CodabarWriter());
 	case BarcodeFormat::Code39: return exec0(OneD::Code39Writer());
 	case BarcodeFormat::Code93: return exec0(OneD::Code93Writer());
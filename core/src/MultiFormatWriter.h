@@ -49,6 +49,14 @@ public:
 		return *this;
 	}
 
+	/**
+	* Used for QRCode and PDF417 only, splits the content into multiple encoding mode segments to minimize the symbol size.
+	*/
+	MultiFormatWriter& setOptimalSegmentation(bool enable) {
+		_optimalSegmentation = enable;
+		return *this;
+	}
+
 	BitMatrix encode(const std::wstring& contents, int width, int height) const;
 	BitMatrix encode(const std::string& contents, int width, int height) const;
 
@@ -57,6 +65,7 @@ private:
 	CharacterSet _encoding = CharacterSet::Unknown;
 	int _margin = -1;
 	int _eccLevel = -1;
+	bool _optimalSegmentation = false;
 };
 
 } // ZXing
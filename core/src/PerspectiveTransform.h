@@ -41,6 +41,44 @@ public:
 	/// Project from the destination space (grid of modules) into the image space (bit matrix)
 	PointF operator()(PointF p) const;
 
+	/// Project the destination points p, p + {1, 0}, ..., p + {n-1, 0} of one grid row, stepping the
+	/// homogeneous coordinates with one addition per point instead of re-evaluating the full transform.
+	/// They are re-evaluated exactly every 32 points to keep the floating point drift far below pixel
+	/// level. Calls visit(i, pix) for each point.
+	template <typename F>
+	void projectRow(PointF p, int n, F&& visit) const
+	{
+		if (a13 == 0 && a23 == 0) {
+			// Affine transform (parallelogram quads, the common case for flat, frontally captured
+			// symbols): the denominator is constant over the whole plane, so the two divisions per
+			// point reduce to one precomputed reciprocal and the projections step exactly.
+			value_t rd = 1 / a33;
+			value_t nx = (a11 * p.x + a21 * p.y + a31) * rd, sx = a11 * rd;
+			value_t ny = (a12 * p.x + a22 * p.y + a32) * rd, sy = a12 * rd;
+			for (int i = 0; i < n; ++i, nx += sx, ny += sy)
+				visit(i, PointF{nx, ny});
+			return;
+		}
+
+		value_t nx = 0, ny = 0, d = 1;
+		for (int i = 0; i < n; ++i) {
+			if (i % 32 == 0) {
+				nx = a11 * (p.x + i) + a21 * p.y + a31;
+				ny = a12 * (p.x + i) + a22 * p.y + a32;
+				d  = a13 * (p.x + i) + a23 * p.y + a33;
+			}
+			visit(i, PointF{nx / d, ny / d});
+			nx += a11, ny += a12, d += a13;
+		}
+	}
+
+	/// true iff the segment between the two destination points is projected onto the straight segment
+	/// between their projections, i.e. the denominator of the projection has no sign change in between
+	bool isSegmentMappedToSegment(PointF a, PointF b) const
+	{
+		return (a13 * a.x + a23 * a.y + a33) * (a13 * b.x + a23 * b.y + a33) > 0;
+	}
+
 	bool isValid() const { return !std::isnan(a33); }
 };
 
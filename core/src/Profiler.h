@@ -0,0 +1,75 @@
+/*
+* Copyright 2025 ZXing authors
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ZXConfig.h"
+
+#ifdef ZX_ENABLE_PROFILING
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace ZXing {
+
+// The pipeline stages tracked by the opt-in profiling instrumentation, see ZX_ENABLE_PROFILING in ZXConfig.h.
+enum class ProfileStage : int { Grayscale, Downscale, Binarize, Decode, ReedSolomon, StageCount_ };
+
+constexpr const char* ToString(ProfileStage stage)
+{
+	constexpr const char* names[] = {"Grayscale", "Downscale", "Binarize", "Decode", "ReedSolomon"};
+	return names[static_cast<int>(stage)];
+}
+
+struct ProfileCounter
+{
+	int64_t nanos = 0; ///< accumulated wall-clock time spent in this stage
+	int32_t calls = 0; ///< number of times this stage was entered
+};
+
+using ProfileCounters = std::array<ProfileCounter, static_cast<int>(ProfileStage::StageCount_)>;
+
+namespace detail {
+inline ZX_THREAD_LOCAL ProfileCounters profileCounters;
+}
+
+/// Accumulated per-stage timings of the calling thread since the last ResetProfile()
+inline const ProfileCounters& Profile()
+{
+	return detail::profileCounters;
+}
+
+inline void ResetProfile()
+{
+	detail::profileCounters = {};
+}
+
+class ScopedProfile
+{
+	ProfileCounter& _counter;
+	std::chrono::steady_clock::time_point _start;
+
+public:
+	explicit ScopedProfile(ProfileStage stage)
+		: _counter(detail::profileCounters[static_cast<int>(stage)]), _start(std::chrono::steady_clock::now())
+	{}
+
+	~ScopedProfile()
+	{
+		_counter.nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+		_counter.calls++;
+	}
+};
+
+} // ZXing
+
+#define ZX_PROFILE_SCOPE(stage) ZXing::ScopedProfile zxProfileScope(ZXing::ProfileStage::stage)
+
+#else
+
+#define ZX_PROFILE_SCOPE(stage) (void)0
+
+#endif // ZX_ENABLE_PROFILING
@@ -106,6 +106,12 @@ Quadrilateral<PointT> Scale(const Quadrilateral<PointT>& q, int factor)
 	return {factor * q[0], factor * q[1], factor * q[2], factor * q[3]};
 }
 
+template <typename PointT>
+Quadrilateral<PointT> Translate(const Quadrilateral<PointT>& q, PointT offset)
+{
+	return {q[0] + offset, q[1] + offset, q[2] + offset, q[3] + offset};
+}
+
 template <typename PointT>
 PointT Center(const Quadrilateral<PointT>& q)
 {
@@ -5,22 +5,50 @@
 
 #include "ReadBarcode.h"
 
+#include "DecodeCounters.h"
+#include "JSON.h"
+#include "Profiler.h"
+
 #if !defined(ZXING_READERS) && !defined(ZXING_WRITERS)
 #include "Version.h"
 #endif
 
 #ifdef ZXING_READERS
+#ifdef ZXING_EXPERIMENTAL_API
+#include "DecodeCache.h"
+#include "ExternalBinarizer.h"
+#endif
 #include "GlobalHistogramBinarizer.h"
 #include "HybridBinarizer.h"
 #include "MultiFormatReader.h"
 #include "Pattern.h"
+#include "ThreadPool.h"
 #include "ThresholdBinarizer.h"
 #endif
 
+#include <algorithm>
 #include <climits>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#endif
+
+#ifdef ZX_HAVE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace ZXing {
 
 #ifdef ZXING_READERS
@@ -34,31 +62,219 @@ public:
 };
 
 template<typename P>
-static LumImage ExtractLum(const ImageView& iv, P projection)
+static void ExtractLum(const ImageView& iv, P projection, LumImage& res)
 {
-	LumImage res(iv.width(), iv.height());
+	// only allocate a new buffer if the existing one (e.g. from the last frame of a video stream) does not fit
+	if (res.width() != iv.width() || res.height() != iv.height())
+		res = LumImage(iv.width(), iv.height());
 
 	auto* dst = res.data();
 	for(int y = 0; y < iv.height(); ++y)
 		for(int x = 0, w = iv.width(); x < w; ++x)
 			*dst++ = projection(iv.data(x, y));
+}
 
-	return res;
+#if defined(ZX_HAVE_SSE2) || defined(__ARM_NEON)
+
+// Explicit SIMD version of ExtractLum for the common packed 3/4 bytes per pixel formats. MSVC and older
+// clang versions fail to auto-vectorize the generic loop below. Computes exactly RGBToLum() per pixel.
+static void ExtractLumSIMD(const ImageView& iv, LumImage& res)
+{
+	if (res.width() != iv.width() || res.height() != iv.height())
+		res = LumImage(iv.width(), iv.height());
+
+	const int pixStride = iv.pixStride();
+	const int rIdx = RedIndex(iv.format()), gIdx = GreenIndex(iv.format()), bIdx = BlueIndex(iv.format());
+	auto* dst = res.data();
+
+#ifdef ZX_HAVE_SSE2
+	// process 2x4 pixels per iteration: widen to 16 bit, use madd to get the two partial 32 bit sums
+	// (c0*p0 + c1*p1, c2*p2 + c3*p3) per pixel and combine, round and shift as in RGBToLum
+	int16_t c[4] = {};
+	c[rIdx] = 306, c[gIdx] = 601, c[bIdx] = 117;
+	const __m128i coeff = _mm_set_epi16(c[3], c[2], c[1], c[0], c[3], c[2], c[1], c[0]);
+	const __m128i round = _mm_set1_epi32(0x200);
+	const __m128i zero  = _mm_setzero_si128();
+
+	auto lum4 = [&](const uint8_t* p) {
+		__m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		__m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(v, zero), coeff);
+		__m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(v, zero), coeff);
+		// sum the two partial sums of each pixel (valid results end up in lanes 0 and 2)
+		lo = _mm_add_epi32(lo, _mm_srli_epi64(lo, 32));
+		hi = _mm_add_epi32(hi, _mm_srli_epi64(hi, 32));
+		__m128i s = _mm_unpacklo_epi64(_mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 0, 2, 0)),
+									   _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 0, 2, 0)));
+		return _mm_srli_epi32(_mm_add_epi32(s, round), 10);
+	};
+
+	for (int y = 0; y < iv.height(); ++y) {
+		const uint8_t* src = iv.data(0, y);
+		int x = 0;
+		for (int w = iv.width(); x + 8 <= w; x += 8, src += 8 * 4, dst += 8) {
+			__m128i w16 = _mm_packs_epi32(lum4(src), lum4(src + 16));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(w16, w16));
+		}
+		for (int w = iv.width(); x < w; ++x, src += pixStride)
+			*dst++ = RGBToLum(src[rIdx], src[gIdx], src[bIdx]);
+	}
+#else // __ARM_NEON
+	// process 8 pixels per iteration, vld3/vld4 de-interleaves the channels for free
+	auto lum8 = [&](uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+		uint16x8_t r16 = vmovl_u8(r), g16 = vmovl_u8(g), b16 = vmovl_u8(b);
+		auto half = [](uint16x4_t r, uint16x4_t g, uint16x4_t b) {
+			uint32x4_t s = vmull_n_u16(r, 306);
+			s = vmlal_n_u16(s, g, 601);
+			s = vmlal_n_u16(s, b, 117);
+			return vshrn_n_u32(vaddq_u32(s, vdupq_n_u32(0x200)), 10);
+		};
+		return vmovn_u16(vcombine_u16(half(vget_low_u16(r16), vget_low_u16(g16), vget_low_u16(b16)),
+									  half(vget_high_u16(r16), vget_high_u16(g16), vget_high_u16(b16))));
+	};
+
+	for (int y = 0; y < iv.height(); ++y) {
+		const uint8_t* src = iv.data(0, y);
+		int x = 0;
+		if (pixStride == 4) {
+			for (int w = iv.width(); x + 8 <= w; x += 8, src += 8 * 4, dst += 8) {
+				uint8x8x4_t p = vld4_u8(src);
+				vst1_u8(dst, lum8(p.val[rIdx], p.val[gIdx], p.val[bIdx]));
+			}
+		} else {
+			for (int w = iv.width(); x + 8 <= w; x += 8, src += 8 * 3, dst += 8) {
+				uint8x8x3_t p = vld3_u8(src);
+				vst1_u8(dst, lum8(p.val[rIdx], p.val[gIdx], p.val[bIdx]));
+			}
+		}
+		for (int w = iv.width(); x < w; ++x, src += pixStride)
+			*dst++ = RGBToLum(src[rIdx], src[gIdx], src[bIdx]);
+	}
+#endif
+}
+
+#ifdef ZX_HAVE_SSE2
+
+// Exact 16 bit sums of horizontally adjacent byte pairs
+static inline __m128i PairSumU8(__m128i v)
+{
+	return _mm_add_epi16(_mm_and_si128(v, _mm_set1_epi16(0x00ff)), _mm_srli_epi16(v, 8));
+}
+
+// Averages 2x2 source blocks of two dense rows into one destination row, rounding like addLayer<2>
+static void BoxFilterRow2(const uint8_t* s0, const uint8_t* s1, uint8_t* d, int dstW)
+{
+	int dx = 0;
+	for (; dx + 8 <= dstW; dx += 8, s0 += 16, s1 += 16, d += 8) {
+		__m128i sum = _mm_add_epi16(PairSumU8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s0))),
+									PairSumU8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s1))));
+		sum = _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(2)), 2);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(d), _mm_packus_epi16(sum, sum));
+	}
+	for (; dx < dstW; ++dx, s0 += 2, s1 += 2)
+		*d++ = (s0[0] + s0[1] + s1[0] + s1[1] + 2) / 4;
+}
+
+// Averages 4x4 source blocks of four dense rows into one destination row, rounding like addLayer<4>
+static void BoxFilterRow4(const uint8_t* const s[4], uint8_t* d, int dstW)
+{
+	int dx = 0;
+	for (; dx + 4 <= dstW; dx += 4, d += 4) {
+		__m128i sum = _mm_setzero_si128();
+		for (int i = 0; i < 4; ++i)
+			sum = _mm_add_epi16(sum, PairSumU8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s[i] + 4 * dx))));
+		__m128i quad = _mm_add_epi32(_mm_and_si128(sum, _mm_set1_epi32(0xffff)), _mm_srli_epi32(sum, 16));
+		quad = _mm_srli_epi32(_mm_add_epi32(quad, _mm_set1_epi32(8)), 4);
+		__m128i packed = _mm_packus_epi16(_mm_packs_epi32(quad, quad), _mm_setzero_si128());
+		uint32_t out = _mm_cvtsi128_si32(packed);
+		memcpy(d, &out, 4);
+	}
+	for (; dx < dstW; ++dx) {
+		int sum = 8;
+		for (int i = 0; i < 4; ++i)
+			sum += s[i][4 * dx] + s[i][4 * dx + 1] + s[i][4 * dx + 2] + s[i][4 * dx + 3];
+		*d++ = sum / 16;
+	}
+}
+
+#elif defined(__ARM_NEON)
+
+static void BoxFilterRow2(const uint8_t* s0, const uint8_t* s1, uint8_t* d, int dstW)
+{
+	int dx = 0;
+	for (; dx + 8 <= dstW; dx += 8, s0 += 16, s1 += 16, d += 8) {
+		uint16x8_t sum = vaddq_u16(vpaddlq_u8(vld1q_u8(s0)), vpaddlq_u8(vld1q_u8(s1)));
+		vst1_u8(d, vmovn_u16(vshrq_n_u16(vaddq_u16(sum, vdupq_n_u16(2)), 2)));
+	}
+	for (; dx < dstW; ++dx, s0 += 2, s1 += 2)
+		*d++ = (s0[0] + s0[1] + s1[0] + s1[1] + 2) / 4;
+}
+
+static void BoxFilterRow4(const uint8_t* const s[4], uint8_t* d, int dstW)
+{
+	int dx = 0;
+	for (; dx + 4 <= dstW; dx += 4, d += 4) {
+		uint16x8_t sum = vdupq_n_u16(0);
+		for (int i = 0; i < 4; ++i)
+			sum = vaddq_u16(sum, vpaddlq_u8(vld1q_u8(s[i] + 4 * dx)));
+		uint32x4_t quad = vpaddlq_u16(sum);
+		uint16x4_t avg = vmovn_u32(vshrq_n_u32(vaddq_u32(quad, vdupq_n_u32(8)), 4));
+		uint8x8_t packed = vmovn_u16(vcombine_u16(avg, avg));
+		vst1_lane_u32(reinterpret_cast<uint32_t*>(d), vreinterpret_u32_u8(packed), 0);
+	}
+	for (; dx < dstW; ++dx) {
+		int sum = 8;
+		for (int i = 0; i < 4; ++i)
+			sum += s[i][4 * dx] + s[i][4 * dx + 1] + s[i][4 * dx + 2] + s[i][4 * dx + 3];
+		*d++ = sum / 16;
+	}
 }
 
+#endif
+
+#endif // ZX_HAVE_SSE2 || __ARM_NEON
+
 class LumImagePyramid
 {
 	std::vector<LumImage> buffers;
+	size_t layersInUse = 0;
+
+	LumImage& nextBuffer(int w, int h)
+	{
+		// reuse an existing buffer from a previous build() if the dimensions still match
+		if (layersInUse == buffers.size())
+			buffers.emplace_back(w, h);
+		else if (buffers[layersInUse].width() != w || buffers[layersInUse].height() != h)
+			buffers[layersInUse] = LumImage(w, h);
+		return buffers[layersInUse++];
+	}
 
 	template<int N>
 	void addLayer()
 	{
 		auto siv = layers.back();
-		buffers.emplace_back(siv.width() / N, siv.height() / N);
-		layers.push_back(buffers.back());
-		auto& div = buffers.back();
+		auto& div = nextBuffer(siv.width() / N, siv.height() / N);
+		layers.push_back(div);
 		auto* d   = div.data();
 
+#if defined(ZX_HAVE_SSE2) || defined(__ARM_NEON)
+		// pairwise-add kernels for the power-of-two factors, the default factor 3 relies on the
+		// auto-vectorizer like before
+		if constexpr (N == 2 || N == 4) {
+			if (siv.pixStride() == 1) {
+				for (int dy = 0; dy < div.height(); ++dy, d += div.width()) {
+					if constexpr (N == 2) {
+						BoxFilterRow2(siv.data(0, 2 * dy), siv.data(0, 2 * dy + 1), d, div.width());
+					} else {
+						const uint8_t* s[4] = {siv.data(0, 4 * dy), siv.data(0, 4 * dy + 1), siv.data(0, 4 * dy + 2),
+											   siv.data(0, 4 * dy + 3)};
+						BoxFilterRow4(s, d, div.width());
+					}
+				}
+				return;
+			}
+		}
+#endif
+
 		for (int dy = 0; dy < div.height(); ++dy)
 			for (int dx = 0; dx < div.width(); ++dx) {
 				int sum = (N * N) / 2;
@@ -83,11 +299,18 @@ class LumImagePyramid
 public:
 	std::vector<ImageView> layers;
 
-	LumImagePyramid(const ImageView& iv, int threshold, int factor)
+	LumImagePyramid() = default;
+	LumImagePyramid(const ImageView& iv, int threshold, int factor) { build(iv, threshold, factor); }
+
+	void build(const ImageView& iv, int threshold, int factor)
 	{
+		ZX_PROFILE_SCOPE(Downscale);
+
 		if (factor < 2)
 			throw std::invalid_argument("Invalid ReaderOptions::downscaleFactor");
 
+		layersInUse = 0;
+		layers.clear();
 		layers.push_back(iv);
 		// TODO: if only matrix codes were considered, then using std::min would be sufficient (see #425)
 		while (threshold > 0 && std::max(layers.back().width(), layers.back().height()) > threshold &&
@@ -107,44 +330,168 @@ ImageView SetupLumImageView(ImageView iv, LumImage& lum, const ReaderOptions& op
 	if (iv.format() == ImageFormat::None)
 		throw std::invalid_argument("Invalid image format");
 
-	if (opts.binarizer() == Binarizer::GlobalHistogram || opts.binarizer() == Binarizer::LocalAverage) {
+	bool needsLum = opts.binarizer() == Binarizer::GlobalHistogram || opts.binarizer() == Binarizer::LocalAverage;
+#ifdef ZXING_EXPERIMENTAL_API
+	needsLum |= opts.binarizer() == Binarizer::Auto; // Auto may select either of the two above
+#endif
+	if (needsLum) {
+		ZX_PROFILE_SCOPE(Grayscale);
+#ifdef ZX_HAVE_SSE2
+		if (iv.pixStride() == 4 && PixStride(iv.format()) == 4)
+			return ExtractLumSIMD(iv, lum), lum;
+#elif defined(__ARM_NEON)
+		if ((iv.pixStride() == 3 || iv.pixStride() == 4) && PixStride(iv.format()) == iv.pixStride())
+			return ExtractLumSIMD(iv, lum), lum;
+#endif
 		// manually spell out the 3 most common pixel formats to get at least gcc to vectorize the code
 		if (iv.format() == ImageFormat::RGB && iv.pixStride() == 3) {
-			lum = ExtractLum(iv, [](const uint8_t* src) { return RGBToLum(src[0], src[1], src[2]); });
+			ExtractLum(iv, [](const uint8_t* src) { return RGBToLum(src[0], src[1], src[2]); }, lum);
 		} else if (iv.format() == ImageFormat::RGBA && iv.pixStride() == 4) {
-			lum = ExtractLum(iv, [](const uint8_t* src) { return RGBToLum(src[0], src[1], src[2]); });
+			ExtractLum(iv, [](const uint8_t* src) { return RGBToLum(src[0], src[1], src[2]); }, lum);
 		} else if (iv.format() == ImageFormat::BGR && iv.pixStride() == 3) {
-			lum = ExtractLum(iv, [](const uint8_t* src) { return RGBToLum(src[2], src[1], src[0]); });
+			ExtractLum(iv, [](const uint8_t* src) { return RGBToLum(src[2], src[1], src[0]); }, lum);
 		} else if (iv.format() != ImageFormat::Lum) {
-			lum = ExtractLum(iv, [r = RedIndex(iv.format()), g = GreenIndex(iv.format()), b = BlueIndex(iv.format())](
-									 const uint8_t* src) { return RGBToLum(src[r], src[g], src[b]); });
+			ExtractLum(iv, [r = RedIndex(iv.format()), g = GreenIndex(iv.format()), b = BlueIndex(iv.format())](
+								const uint8_t* src) { return RGBToLum(src[r], src[g], src[b]); }, lum);
 		} else if (iv.pixStride() != 1) {
 			// GlobalHistogram and LocalAverage need dense line memory layout
-			lum = ExtractLum(iv, [](const uint8_t* src) { return *src; });
+			ExtractLum(iv, [](const uint8_t* src) { return *src; }, lum);
+		} else {
+			return iv;
 		}
-		if (lum.data())
-			return lum;
+		return lum;
 	}
 	return iv;
 }
 
-std::unique_ptr<BinaryBitmap> CreateBitmap(ZXing::Binarizer binarizer, const ImageView& iv)
+std::unique_ptr<BinaryBitmap> CreateBitmap(ZXing::Binarizer binarizer, const ImageView& iv, int maxThreads = 1)
 {
 	switch (binarizer) {
 	case Binarizer::BoolCast: return std::make_unique<ThresholdBinarizer>(iv, 0);
 	case Binarizer::FixedThreshold: return std::make_unique<ThresholdBinarizer>(iv, 127);
 	case Binarizer::GlobalHistogram: return std::make_unique<GlobalHistogramBinarizer>(iv);
-	case Binarizer::LocalAverage: return std::make_unique<HybridBinarizer>(iv);
+	case Binarizer::LocalAverage: return std::make_unique<HybridBinarizer>(iv, maxThreads);
+#ifdef ZXING_EXPERIMENTAL_API
+	case Binarizer::Auto: return std::make_unique<HybridBinarizer>(iv, maxThreads); // resolved in DoReadBarcodes, robust fallback
+#endif
 	}
 	return {}; // silence gcc warning
 }
 
-Barcode ReadBarcode(const ImageView& _iv, const ReaderOptions& opts)
+#ifdef ZXING_EXPERIMENTAL_API
+// Picks the cheapest binarizer that can be expected to work on the given frame, see Binarizer::Auto.
+// Samples a sparse pixel grid and measures the dynamic range and the illumination gradient, using the
+// same dynamic range threshold as the block classification in HybridBinarizer.cpp.
+static Binarizer SelectBinarizer(const ImageView& iv)
 {
-	return FirstOrDefault(ReadBarcodes(_iv, ReaderOptions(opts).setMaxNumberOfSymbols(1)));
+	constexpr int GRID = 16;
+	constexpr int MIN_DYNAMIC_RANGE = 24; // see HybridBinarizer.cpp
+
+	int min = 255, max = 0, nMid = 0;
+	int quadSum[2][2] = {};
+	for (int i = 0; i < GRID; ++i)
+		for (int j = 0; j < GRID; ++j) {
+			int x = (2 * j + 1) * iv.width() / (2 * GRID);
+			int y = (2 * i + 1) * iv.height() / (2 * GRID);
+			int pix = iv.data(x, y)[GreenIndex(iv.format())];
+			min = std::min(min, pix);
+			max = std::max(max, pix);
+			nMid += std::abs(pix - 127) <= MIN_DYNAMIC_RANGE;
+			quadSum[2 * i / GRID][2 * j / GRID] += pix;
+		}
+
+	// a frame without sufficient global dynamic range is most likely empty, let the histogram bail out cheaply
+	if (max - min <= MIN_DYNAMIC_RANGE)
+		return Binarizer::GlobalHistogram;
+
+	auto [minQuad, maxQuad] = std::minmax({quadSum[0][0], quadSum[0][1], quadSum[1][0], quadSum[1][1]});
+	// unevenly illuminated frame: only locally adaptive thresholds work reliably
+	if ((maxQuad - minQuad) / (GRID * GRID / 4) > MIN_DYNAMIC_RANGE)
+		return Binarizer::LocalAverage;
+
+	// evenly lit and clearly bimodal around 127: the fixed threshold suffices
+	if (nMid == 0)
+		return Binarizer::FixedThreshold;
+
+	return Binarizer::GlobalHistogram;
 }
 
-Barcodes ReadBarcodes(const ImageView& _iv, const ReaderOptions& opts)
+// Cheap symbol-presence prescreen, see ReaderOptions::tryPrescreen. Counts strong horizontal
+// gradients on a sparsely sampled grid: any symbol in view produces dozens of bar/module edges,
+// while an empty field of view produces (nearly) none. Reads ~8k pixels, i.e. well under 0.1ms,
+// compared to the full binarize+detect cost of scanning an empty frame.
+static bool PrescreenFrame(const ImageView& iv)
+{
+	constexpr int ROWS = 64, COLS = 128;
+	constexpr int MIN_GRADIENT = 24;    // same dynamic range threshold as SelectBinarizer above
+	constexpr int MIN_TRANSITIONS = 16; // fewer sampled edges than even a single small symbol produces
+
+	const int rowStep = std::max(1, iv.height() / ROWS);
+	const int colStep = std::max(1, iv.width() / COLS);
+	const int pixStep = colStep * iv.pixStride();
+	int transitions = 0;
+
+	for (int y = rowStep / 2; y < iv.height(); y += rowStep) {
+		const uint8_t* p = iv.data(0, y) + GreenIndex(iv.format());
+		for (int x = 0; x + colStep < iv.width(); x += colStep, p += pixStep)
+			transitions += std::abs(p[pixStep] - p[0]) > MIN_GRADIENT;
+		if (transitions >= MIN_TRANSITIONS)
+			return true;
+	}
+	return false;
+}
+#endif
+
+#ifdef ZXING_EXPERIMENTAL_API
+// The readers 'compiled' from one ReaderOptions object: building a MultiFormatReader allocates one
+// Reader per format family, and DoReadBarcodes needs up to three option variants of it (closed
+// image, single-threaded for the layer-parallel scan). Freezing them here lets a ScanContext (or a
+// ReadBarcodesBatch worker) set them up once instead of per frame. The readers keep references
+// into this struct, so it lives on the heap and is never mutated after construction.
+struct CompiledReaders
+{
+	const ReaderOptions* source; // identity of the options object this was compiled from, see DoReadBarcodes
+	ReaderOptions opts, closedOpts, singleThreadOpts, closedSingleThreadOpts;
+	std::optional<MultiFormatReader> reader, closedReader, singleThreadReader, closedSingleThreadReader;
+
+	explicit CompiledReaders(const ReaderOptions& options) : source(&options), opts(options)
+	{
+		reader.emplace(opts);
+
+		auto formatsBenefittingFromClosing =
+			BarcodeFormat::Aztec | BarcodeFormat::DataMatrix | BarcodeFormat::QRCode | BarcodeFormat::MicroQRCode;
+		if (opts.tryDenoise() && opts.hasFormat(formatsBenefittingFromClosing)) {
+			closedOpts = ReaderOptions(opts).setFormats((opts.formats().empty() ? BarcodeFormat::Any : opts.formats())
+														& formatsBenefittingFromClosing);
+			closedReader.emplace(closedOpts);
+		}
+		if (opts.maxNumberOfThreads() != 1) {
+			singleThreadOpts = ReaderOptions(opts).setMaxNumberOfThreads(1);
+			singleThreadReader.emplace(singleThreadOpts);
+			if (closedReader) {
+				closedSingleThreadOpts = ReaderOptions(closedOpts).setMaxNumberOfThreads(1);
+				closedSingleThreadReader.emplace(closedSingleThreadOpts);
+			}
+		}
+	}
+};
+#endif
+
+// internal state that is worth keeping alive between frames of a video stream, see ScanContext
+struct ScanState
+{
+	LumImage lum;
+	LumImagePyramid pyramid;
+	int lastHitLayer = -1; // pyramid layer that produced the last successful decode, see DoReadBarcodes
+#ifdef ZXING_EXPERIMENTAL_API
+	PointI lastLinearCenter = {-1, -1}; // center of the last decoded linear symbol, see BinaryBitmap::scanHint
+	DecodeCache decodeCache; // frame-to-frame matrix decode cache, see DecodeCache.h
+	std::unique_ptr<CompiledReaders> readers;
+	const std::atomic<bool>* cancelled = nullptr; // cooperative cancellation, checked per layer/variant, see AsyncScanSession
+#endif
+};
+
+Barcodes DoReadBarcodes(const ImageView& _iv, const ReaderOptions& opts, ScanState& state)
 {
 	if (sizeof(PatternType) < 4 && (_iv.width() > 0xffff || _iv.height() > 0xffff))
 		throw std::invalid_argument("Maximum image width/height is 65535");
@@ -152,28 +499,109 @@ Barcodes ReadBarcodes(const ImageView& _iv, const ReaderOptions& opts)
 	if (!_iv.data() || _iv.width() * _iv.height() == 0)
 		throw std::invalid_argument("ImageView is null/empty");
 
-	LumImage lum;
-	ImageView iv = SetupLumImageView(_iv, lum, opts);
-	MultiFormatReader reader(opts);
+	ImageView iv = SetupLumImageView(_iv, state.lum, opts);
+#ifdef ZXING_EXPERIMENTAL_API
+	if (opts.tryPrescreen() && !opts.isPure() && !PrescreenFrame(iv))
+		return {};
 
-	if (opts.isPure())
-		return {reader.read(*CreateBitmap(opts.binarizer(), iv)).setReaderOptions(opts)};
+	// Reuse the compiled readers as long as the caller passes the same options object: a ScanContext
+	// always does, so a video stream pays for the reader setup only on its first frame. Temporary
+	// option objects (e.g. the per-roi maxNumberOfSymbols overrides) simply compile fresh, which is
+	// no worse than the per-call setup this replaces.
+	if (!state.readers || state.readers->source != &opts)
+		state.readers = std::make_unique<CompiledReaders>(opts);
+	auto& compiled = *state.readers;
+	MultiFormatReader& reader = *compiled.reader;
+#else
+	MultiFormatReader localReader(opts);
+	MultiFormatReader& reader = localReader;
+#endif
 
-	std::unique_ptr<MultiFormatReader> closedReader;
+	Binarizer binarizer = opts.binarizer();
 #ifdef ZXING_EXPERIMENTAL_API
-	auto formatsBenefittingFromClosing = BarcodeFormat::Aztec | BarcodeFormat::DataMatrix | BarcodeFormat::QRCode | BarcodeFormat::MicroQRCode;
-	ReaderOptions closedOptions = opts;
-	if (opts.tryDenoise() && opts.hasFormat(formatsBenefittingFromClosing) && _iv.height() >= 3) {
-		closedOptions.setFormats((opts.formats().empty() ? BarcodeFormat::Any : opts.formats()) & formatsBenefittingFromClosing);
-		closedReader = std::make_unique<MultiFormatReader>(closedOptions);
+	if (binarizer == Binarizer::Auto)
+		binarizer = SelectBinarizer(iv);
+#endif
+
+	if (opts.isPure()) {
+		auto barcode = reader.read(*CreateBitmap(binarizer, iv));
+		barcode.setReaderOptions(opts);
+		Barcodes res;
+		res.push_back(std::move(barcode)); // move into the result list, the braced-init-list version would deep-copy
+		return res;
 	}
+
+	MultiFormatReader* closedReader = nullptr;
+#ifdef ZXING_EXPERIMENTAL_API
+	if (compiled.closedReader && _iv.height() >= 3)
+		closedReader = &*compiled.closedReader;
 #endif
-	LumImagePyramid pyramid(iv, opts.downscaleThreshold() * opts.tryDownscale(), opts.downscaleFactor());
+	auto& pyramid = state.pyramid;
+	pyramid.build(iv, opts.downscaleThreshold() * opts.tryDownscale(), opts.downscaleFactor());
 
 	Barcodes res;
+#ifdef ZXING_EXPERIMENTAL_API
+	std::atomic<int> maxSymbols = opts.maxNumberOfSymbols() ? opts.maxNumberOfSymbols() : INT_MAX;
+	std::mutex resMutex;
+#else
 	int maxSymbols = opts.maxNumberOfSymbols() ? opts.maxNumberOfSymbols() : INT_MAX;
-	for (auto&& iv : pyramid.layers) {
-		auto bitmap = CreateBitmap(opts.binarizer(), iv);
+#endif
+
+	// white out the regions of already found symbols, so the detectors don't have to look at them again
+	// in the other layers and the invert/close variants (see the TODO in LumImagePyramid above)
+	auto maskFound = [&](BinaryBitmap& bitmap, int scale) {
+#ifdef ZXING_EXPERIMENTAL_API
+		std::lock_guard lock(resMutex);
+#endif
+		// note: don't touch the bitmap if there is nothing to mask, a pure linear scan may otherwise
+		// never need the fully binarized matrix
+		for (const auto& r : res) {
+			auto bb = BoundingBox(r.position());
+			bitmap.exclude(bb[0].x / scale, bb[0].y / scale, (bb[2].x - bb[0].x) / scale + 1, (bb[2].y - bb[0].y) / scale + 1);
+		}
+	};
+
+#ifdef ZXING_EXPERIMENTAL_API
+	// when the pyramid layers are scanned in parallel below, don't additionally multi-thread each
+	// binarizer or the row-parallel 1D scan inside the readers
+	int binarizerThreads = Size(pyramid.layers) > 1 ? 1 : opts.maxNumberOfThreads();
+	bool singleThreadReaders = binarizerThreads != opts.maxNumberOfThreads();
+	if (singleThreadReaders && closedReader)
+		closedReader = &*compiled.closedSingleThreadReader;
+	MultiFormatReader& layerReader = singleThreadReaders ? *compiled.singleThreadReader : reader;
+#else
+	int binarizerThreads = 1;
+	MultiFormatReader& layerReader = reader;
+#endif
+
+	std::vector<std::unique_ptr<BinaryBitmap>> bitmaps(pyramid.layers.size());
+	for (int i = 0; i < Size(pyramid.layers); ++i)
+		bitmaps[i] = CreateBitmap(binarizer, pyramid.layers[i], binarizerThreads);
+#ifdef ZXING_EXPERIMENTAL_API
+	// Each pyramid layer is the exact box-filter reduction of the previous one, so its black matrix
+	// follows from the previous layer's by a majority vote per block, skipping the per-layer
+	// binarization entirely (about a third of the total binarization work in the standard 3 layer
+	// setup). Only the threshold-computing binarizers are worth replacing, and the chain has to be
+	// materialized eagerly here: the layer workers below mutate their own matrix (invert/close/
+	// exclude), so deriving lazily inside a worker would race on the parent. Skipped for linear-only
+	// scans to preserve the 'never binarize in 2D' lazyness of the row readers.
+	if ((binarizer == Binarizer::LocalAverage || binarizer == Binarizer::GlobalHistogram) && Size(bitmaps) > 1
+		&& opts.hasFormat(BarcodeFormat::MatrixCodes)) {
+		bitmaps.front()->getBitMatrix();
+		for (int i = 1; i < Size(bitmaps); ++i)
+			bitmaps[i]->deriveBlackMatrix(*bitmaps[i - 1], opts.downscaleFactor());
+	}
+#endif
+
+	auto scanLayer = [&](int layerIdx) {
+		const auto& iv = pyramid.layers[layerIdx];
+		const int scale = std::max(1, _iv.width() / iv.width());
+		auto& bitmap = bitmaps[layerIdx];
+#ifdef ZXING_EXPERIMENTAL_API
+		if (state.lastLinearCenter.y >= 0)
+			bitmap->setScanHint(state.lastLinearCenter / scale);
+		bitmap->setDecodeCache(&state.decodeCache);
+#endif
 		for (int close = 0; close <= (closedReader ? 1 : 0); ++close) {
 			if (close) {
 				// if we already inverted the image in the first round, we need to undo that first
@@ -184,28 +612,542 @@ Barcodes ReadBarcodes(const ImageView& _iv, const ReaderOptions& opts)
 
 			// TODO: check if closing after invert would be beneficial
 			for (int invert = 0; invert <= static_cast<int>(opts.tryInvert() && !close); ++invert) {
+				if (maxSymbols <= 0)
+					return;
+#ifdef ZXING_EXPERIMENTAL_API
+				if (state.cancelled && state.cancelled->load(std::memory_order_relaxed))
+					return; // a newer frame superseded this scan, the partial result is discarded anyway
+#endif
 				if (invert)
 					bitmap->invert();
-				auto rs = (close ? *closedReader : reader).readMultiple(*bitmap, maxSymbols);
+				maskFound(*bitmap, scale);
+				auto rs = (close ? *closedReader : layerReader).readMultiple(*bitmap, maxSymbols);
+#ifdef ZXING_EXPERIMENTAL_API
+				std::lock_guard lock(resMutex);
+#endif
 				for (auto& r : rs) {
 					if (iv.width() != _iv.width())
 						r.setPosition(Scale(r.position(), _iv.width() / iv.width()));
 					if (!Contains(res, r)) {
 						r.setReaderOptions(opts);
-						r.setIsInverted(bitmap->inverted());
+						// a reader may have found the symbol by speculatively inverting the bitmap itself
+						r.setIsInverted(r.isInverted() != bitmap->inverted());
 						res.push_back(std::move(r));
 						--maxSymbols;
+						state.lastHitLayer = layerIdx;
 					}
 				}
-				if (maxSymbols <= 0)
+			}
+		}
+	};
+
+#ifdef ZXING_EXPERIMENTAL_API
+	// remember where the first linear symbol was found, so the row sweep of the next frame starts there
+	auto updateScanHint = [&] {
+		state.lastLinearCenter = {-1, -1};
+		for (const auto& r : res)
+			if (IsLinearBarcode(r.format())) {
+				state.lastLinearCenter = Center(r.position());
+				break;
+			}
+	};
+
+	int maxThreads = opts.maxNumberOfThreads() ? opts.maxNumberOfThreads() : std::max(1u, std::thread::hardware_concurrency());
+	if (maxThreads > 1 && Size(pyramid.layers) > 1) {
+		// scan the independent pyramid layers (each with its own invert/close variants) on worker threads, the
+		// shared maxSymbols counter lets all workers bail out early once enough symbols have been found
+		std::atomic<int> next = 0;
+		DecodeCounters workerCounters;
+		auto worker = [&]() {
+			ResetDecodeCounters(); // the pool thread may still hold counts from a previous task
+			for (int i = next++; i < Size(pyramid.layers) && maxSymbols > 0; i = next++)
+				scanLayer(i);
+			std::lock_guard lock(resMutex);
+			workerCounters += LastDecodeCounters();
+		};
+		RunParallel(std::min(maxThreads, Size(pyramid.layers)), worker, opts.threadPriority());
+		detail::decodeCounters += workerCounters;
+		updateScanHint();
+		return res;
+	}
+#endif
+
+	// with a persistent state (ScanContext), first try the layer that produced the last successful decode:
+	// when scanning a video stream the symbol size is usually stable between frames, so if maxNumberOfSymbols
+	// is reached there already, the other layers are skipped entirely
+	int firstLayer = state.lastHitLayer >= 0 && state.lastHitLayer < Size(pyramid.layers) ? state.lastHitLayer : 0;
+	scanLayer(firstLayer);
+	for (int i = 0; i < Size(pyramid.layers) && maxSymbols > 0; ++i)
+		if (i != firstLayer)
+			scanLayer(i);
+
+#ifdef ZXING_EXPERIMENTAL_API
+	updateScanHint();
+#endif
+	return res;
+}
+
+Barcode ReadBarcode(const ImageView& _iv, const ReaderOptions& opts)
+{
+	return FirstOrDefault(ReadBarcodes(_iv, ReaderOptions(opts).setMaxNumberOfSymbols(1)));
+}
+
+Barcodes ReadBarcodes(const ImageView& _iv, const ReaderOptions& opts)
+{
+	ResetDecodeCounters();
+	ScanState state;
+	return DoReadBarcodes(_iv, opts, state);
+}
+
+#ifdef ZXING_EXPERIMENTAL_API
+
+static Barcodes DoReadBarcodes(const ImageView& iv, const Rects& rois, const ReaderOptions& opts, ScanState& state)
+{
+	if (rois.empty())
+		return DoReadBarcodes(iv, opts, state);
+
+	Barcodes res;
+	int maxSymbols = opts.maxNumberOfSymbols() ? opts.maxNumberOfSymbols() : INT_MAX;
+	for (const auto& roi : rois) {
+		// clamp the same way cropped() does, so the position offset matches the cropped view
+		int left = std::clamp(roi.x, 0, iv.width() - 1), top = std::clamp(roi.y, 0, iv.height() - 1);
+		auto crop = iv.cropped(left, top, roi.width, roi.height);
+		for (auto&& r : DoReadBarcodes(crop, ReaderOptions(opts).setMaxNumberOfSymbols(std::min(maxSymbols, 0xff)), state)) {
+			r.setPosition(Translate(r.position(), PointI{left, top}));
+			if (!Contains(res, r)) {
+				res.push_back(std::move(r));
+				if (--maxSymbols <= 0)
 					return res;
 			}
 		}
 	}
+	return res;
+}
+
+Barcodes ReadBarcodes(const ImageView& iv, const Rects& rois, const ReaderOptions& opts)
+{
+	ResetDecodeCounters();
+	ScanState state;
+	return DoReadBarcodes(iv, rois, opts, state);
+}
+
+std::vector<Barcodes> ReadBarcodesBatch(ArrayView<ImageView> images, const ReaderOptions& opts, int nThreads)
+{
+	std::vector<Barcodes> res(images.size());
+	int maxThreads = std::clamp(nThreads ? nThreads : int(std::thread::hardware_concurrency()), 1, Size(images));
+
+	if (maxThreads <= 1) {
+		ScanState state;
+		for (size_t i = 0; i < images.size(); ++i)
+			res[i] = DoReadBarcodes(images[i], opts, state);
+		return res;
+	}
+
+	// Claim contiguous chunks instead of single interleaved indices: all pages of one frame (and of
+	// the ScanState buffers sized by it) are then touched by exactly one worker, which keeps them
+	// node-local under the first-touch policy of NUMA machines and lets consecutive frames of an
+	// archive segment reuse that worker's warm buffers. Node pinning itself is left to the process
+	// (numactl/taskset on the pool threads), the library stays free of a libnuma dependency.
+	const size_t chunk = std::max<size_t>(1, images.size() / (size_t(maxThreads) * 4));
+	std::atomic<size_t> next = 0;
+	auto worker = [&]() {
+		ScanState state; // reuse the internal buffers for the whole batch, see ScanContext
+		for (size_t begin = next.fetch_add(chunk); begin < images.size(); begin = next.fetch_add(chunk))
+			for (size_t i = begin, end = std::min(begin + chunk, images.size()); i < end; ++i)
+				res[i] = DoReadBarcodes(images[i], opts, state);
+	};
+	// RunParallel propagates a potential exception (e.g. invalid ImageView) to the caller
+	RunParallel(maxThreads, worker, opts.threadPriority());
+	return res;
+}
+
+int VerifyBarcode(const ImageView& image, std::string_view expectedPayload, BarcodeFormat format)
+{
+	// isPure runs only the dedicated pure-symbol detector of the (single) requested format, with no
+	// pyramid, no invert/close variants and no rotation sweep, which is what makes this an order of
+	// magnitude cheaper than a general scan of the same frame.
+	auto opts = ReaderOptions()
+					.setFormats(format)
+					.setIsPure(true)
+					.setTryRotate(false)
+					.setTryInvert(false)
+					.setTryDownscale(false)
+					.setTryDenoise(false);
+	auto barcode = ReadBarcode(image, opts);
+	if (!barcode.isValid() || barcode.text(TextMode::Plain) != expectedPayload)
+		return -1;
+	// 0 unless the decoder tracks its Reed-Solomon corrections (see QRDecoder), i.e. a perfectly
+	// printed symbol verifies with 0 and a degrading one shows a rising count before it starts to fail
+	return JsonGet<int>(barcode.extra(), "ECErrorsCorrected").value_or(0);
+}
+
+#ifdef __cpp_impl_coroutine
+// out-of-line friend of Result: coroutines can not be befriended directly without dragging
+// Generator.h into Barcode.h
+void FinalizeIncrementalResult(Barcode& r, const ReaderOptions& opts, bool bitmapInverted)
+{
+	r.setReaderOptions(opts);
+	// a reader may have found the symbol by speculatively inverting the bitmap itself
+	r.setIsInverted(r.isInverted() != bitmapInverted);
+}
+
+Generator<Barcode> ReadBarcodesIncremental(const ImageView& _iv, const ReaderOptions& opts)
+{
+	// A deliberately lean, single threaded version of the DoReadBarcodes pyramid loop: each
+	// (layer, invert) variant is scanned in turn and every new symbol is yielded right away,
+	// before the remaining variants are looked at.
+	if (sizeof(PatternType) < 4 && (_iv.width() > 0xffff || _iv.height() > 0xffff))
+		throw std::invalid_argument("Maximum image width/height is 65535");
+
+	if (!_iv.data() || _iv.width() * _iv.height() == 0)
+		throw std::invalid_argument("ImageView is null/empty");
+
+	ScanState state;
+	ImageView iv = SetupLumImageView(_iv, state.lum, opts);
+	MultiFormatReader reader(opts);
+
+	Binarizer binarizer = opts.binarizer();
+	if (binarizer == Binarizer::Auto)
+		binarizer = SelectBinarizer(iv);
+
+	if (opts.isPure()) {
+		auto barcode = reader.read(*CreateBitmap(binarizer, iv));
+		FinalizeIncrementalResult(barcode, opts, false);
+		co_yield std::move(barcode);
+		co_return;
+	}
+
+	state.pyramid.build(iv, opts.downscaleThreshold() * opts.tryDownscale(), opts.downscaleFactor());
+
+	int maxSymbols = opts.maxNumberOfSymbols() ? opts.maxNumberOfSymbols() : INT_MAX;
+	Barcodes found; // keeps a copy of each yielded symbol to deduplicate across layers/variants
+
+	for (const auto& layer : state.pyramid.layers) {
+		auto bitmap = CreateBitmap(binarizer, layer);
+		const int scale = std::max(1, _iv.width() / layer.width());
+		for (int invert = 0; invert <= static_cast<int>(opts.tryInvert()); ++invert) {
+			if (invert)
+				bitmap->invert();
+			// white out the regions of already yielded symbols, see maskFound in DoReadBarcodes
+			for (const auto& f : found) {
+				auto bb = BoundingBox(f.position());
+				bitmap->exclude(bb[0].x / scale, bb[0].y / scale, (bb[2].x - bb[0].x) / scale + 1, (bb[2].y - bb[0].y) / scale + 1);
+			}
+			for (auto& r : reader.readMultiple(*bitmap, maxSymbols)) {
+				if (layer.width() != _iv.width())
+					r.setPosition(Scale(r.position(), _iv.width() / layer.width()));
+				if (!Contains(found, r)) {
+					FinalizeIncrementalResult(r, opts, bitmap->inverted());
+					found.push_back(r);
+					--maxSymbols;
+					co_yield std::move(r);
+					if (maxSymbols <= 0)
+						co_return;
+				}
+			}
+		}
+	}
+}
+#endif // __cpp_impl_coroutine
+
+struct ScanContext::State : ScanState
+{
+	std::vector<uint8_t> blockMeans; // per-block luminance means of the last seen frame
+	Barcodes lastBarcodes;           // results of the last frame that was actually scanned
+};
+
+// Update the blockwise mean-luminance map of the frame and report whether the content changed noticeably
+// compared to the last call. Each 16x16 block is sparsely sampled, which is orders of magnitude cheaper
+// than binarization + detection and good enough to detect a (dis)appearing or moving symbol.
+static bool UpdateFrameDiff(const ImageView& iv, std::vector<uint8_t>& prevMeans, int threshold)
+{
+	constexpr int blockSize = 16, sampleStep = 4;
+	const int bw = std::max(1, iv.width() / blockSize), bh = std::max(1, iv.height() / blockSize);
+	const int gIdx = iv.format() == ImageFormat::Lum ? 0 : GreenIndex(iv.format());
+
+	bool changed = Size(prevMeans) != bw * bh;
+	if (changed)
+		prevMeans.assign(bw * bh, 0);
+
+	for (int by = 0; by < bh; ++by)
+		for (int bx = 0; bx < bw; ++bx) {
+			int sum = 0, n = 0;
+			for (int y = by * blockSize; y < std::min((by + 1) * blockSize, iv.height()); y += sampleStep)
+				for (int x = bx * blockSize; x < std::min((bx + 1) * blockSize, iv.width()); x += sampleStep, ++n)
+					sum += iv.data(x, y)[gIdx];
+			auto mean = static_cast<uint8_t>(sum / std::max(n, 1));
+			auto& prev = prevMeans[by * bw + bx];
+			changed |= std::abs(mean - prev) > threshold;
+			prev = mean;
+		}
+
+	return changed;
+}
+
+ScanContext::ScanContext(const ReaderOptions& opts) : _state(std::make_unique<State>()), _opts(opts) {}
+ScanContext::~ScanContext() = default;
+ScanContext::ScanContext(ScanContext&&) noexcept = default;
+ScanContext& ScanContext::operator=(ScanContext&&) noexcept = default;
+
+Barcodes ScanContext::readBarcodes(const ImageView& iv)
+{
+	ResetDecodeCounters();
+	if (_frameDiffThreshold > 0 && !UpdateFrameDiff(iv, _state->blockMeans, _frameDiffThreshold))
+		return _state->lastBarcodes;
+
+	auto res = DoReadBarcodes(iv, _opts, *_state);
+	if (_frameDiffThreshold > 0)
+		_state->lastBarcodes = res;
+	return res;
+}
+
+Barcodes ScanContext::readBarcodes(const ImageView& iv, const Rects& rois)
+{
+	ResetDecodeCounters();
+	return DoReadBarcodes(iv, rois, _opts, *_state);
+}
+
+Barcode ScanContext::readBarcode(const ImageView& iv)
+{
+	ResetDecodeCounters();
+	return FirstOrDefault(DoReadBarcodes(iv, ReaderOptions(_opts).setMaxNumberOfSymbols(1), *_state));
+}
+
+Barcodes ReadBarcodes(const BitMatrixView& mask, const ReaderOptions& opts)
+{
+	ResetDecodeCounters();
+
+	if (!mask.data || mask.width <= 0 || mask.height <= 0)
+		throw std::invalid_argument("BitMatrixView is null/empty");
+
+	if (sizeof(PatternType) < 4 && (mask.width > 0xffff || mask.height > 0xffff))
+		throw std::invalid_argument("Maximum image width/height is 65535");
+
+	ExternalBinarizer bitmap(mask);
+	MultiFormatReader reader(opts);
+
+	if (opts.isPure()) {
+		auto barcode = reader.read(bitmap);
+		barcode.setReaderOptions(opts);
+		Barcodes res;
+		res.push_back(std::move(barcode));
+		return res;
+	}
+
+	Barcodes res;
+	int maxSymbols = opts.maxNumberOfSymbols() ? opts.maxNumberOfSymbols() : INT_MAX;
+	for (int invert = 0; invert <= static_cast<int>(opts.tryInvert()) && maxSymbols > 0; ++invert) {
+		if (invert)
+			bitmap.invert();
+		// white out already found symbols, see maskFound in DoReadBarcodes (which also explains why
+		// the bitmap is left untouched if there is nothing to mask)
+		for (const auto& r : res) {
+			auto bb = BoundingBox(r.position());
+			bitmap.exclude(bb[0].x, bb[0].y, bb[2].x - bb[0].x + 1, bb[2].y - bb[0].y + 1);
+		}
+		for (auto& r : reader.readMultiple(bitmap, maxSymbols))
+			if (!Contains(res, r)) {
+				r.setReaderOptions(opts);
+				r.setIsInverted(r.isInverted() != bitmap.inverted());
+				res.push_back(std::move(r));
+				--maxSymbols;
+			}
+	}
+	return res;
+}
 
+// dense copy of an arbitrarily strided ImageView, so the caller's frame buffer can be reused immediately
+static Image CopyImage(const ImageView& iv)
+{
+	if (!iv.data() || iv.width() * iv.height() == 0)
+		throw std::invalid_argument("ImageView is null/empty");
+
+	Image res(iv.width(), iv.height(), iv.format());
+	auto* dst = const_cast<uint8_t*>(res.data());
+	const int pixStride = PixStride(iv.format());
+	if (iv.pixStride() == pixStride && iv.rowStride() == iv.width() * pixStride) {
+		memcpy(dst, iv.data(), iv.height() * iv.rowStride());
+	} else {
+		for (int y = 0; y < iv.height(); ++y)
+			for (int x = 0, w = iv.width(); x < w; ++x, dst += pixStride)
+				memcpy(dst, iv.data(x, y), pixStride);
+	}
 	return res;
 }
 
+struct AsyncScanSession::State
+{
+	ReaderOptions opts;
+	Callback callback;
+
+	std::mutex mutex;
+	std::condition_variable frameReady, prepReady, idle;
+	Image pending; // the most recently submitted frame, an older still queued frame is simply overwritten
+	uint64_t pendingId = 0;
+	bool hasPending = false, inFlight = false, quit = false;
+	std::atomic<bool> cancelInFlight = false;
+	std::exception_ptr error;
+	std::thread worker, preparer;
+
+	// Pipelined mode: the preparer thread converts submitted frames to dense luminance ahead of the
+	// decoder, so frame N+1's extraction overlaps frame N's detect/decode. Triple-buffered slots:
+	// at any time one may be written, one queued and one decoded, each with its own lum buffer.
+	struct PreparedFrame
+	{
+		Image raw;    // keeps the pixels alive in case view passes them through unconverted
+		LumImage lum; // reused between frames, see SetupLumImageView
+		ImageView view;
+		uint64_t id = 0;
+	};
+	std::array<PreparedFrame, 3> slots;
+	int writeSlot = 0, queuedSlot = -1, decodeSlot = -1;
+	bool preparing = false;
+
+	void runPrepare()
+	{
+		std::unique_lock lock(mutex);
+		while (!quit) {
+			frameReady.wait(lock, [&] { return hasPending || quit; });
+			if (quit)
+				break;
+			while (writeSlot == queuedSlot || writeSlot == decodeSlot)
+				writeSlot = (writeSlot + 1) % 3;
+			auto& slot = slots[writeSlot];
+			slot.raw = std::move(pending);
+			slot.id = pendingId;
+			hasPending = false;
+			preparing = true;
+			lock.unlock();
+
+			std::exception_ptr exception;
+			try {
+				slot.view = SetupLumImageView(slot.raw, slot.lum, opts);
+			} catch (...) {
+				exception = std::current_exception();
+			}
+
+			lock.lock();
+			preparing = false;
+			if (exception) {
+				error = std::move(exception);
+				idle.notify_all();
+				continue;
+			}
+			queuedSlot = writeSlot; // a previously queued but not yet decoded frame is superseded
+			if (inFlight)
+				cancelInFlight = true;
+			prepReady.notify_one();
+		}
+		prepReady.notify_all();
+	}
+
+	void run()
+	{
+		ScanState scan; // keep the internal buffers alive for the whole session, see ScanContext
+		scan.cancelled = &cancelInFlight;
+		const bool pipelined = preparer.joinable();
+
+		std::unique_lock lock(mutex);
+		while (!quit) {
+			Image frame; // keeps the pixels of the non-pipelined path alive while scanning
+			ImageView view;
+			uint64_t frameId = 0;
+			if (pipelined) {
+				prepReady.wait(lock, [&] { return queuedSlot >= 0 || quit; });
+				if (quit)
+					break;
+				decodeSlot = std::exchange(queuedSlot, -1);
+				view = slots[decodeSlot].view; // the slot is reserved until decodeSlot is reset below
+				frameId = slots[decodeSlot].id;
+			} else {
+				frameReady.wait(lock, [&] { return hasPending || quit; });
+				if (quit)
+					break;
+				frame = std::move(pending);
+				view = frame;
+				frameId = pendingId;
+				hasPending = false;
+			}
+			inFlight = true;
+			cancelInFlight = false;
+			lock.unlock();
+
+			Barcodes res;
+			ResetDecodeCounters();
+			try {
+				res = DoReadBarcodes(view, opts, scan);
+			} catch (...) {
+				lock.lock();
+				error = std::current_exception();
+				inFlight = false;
+				decodeSlot = -1;
+				idle.notify_all();
+				continue;
+			}
+
+			// a cancelled scan was superseded by a newer frame, its (partial) result is dropped
+			if (!cancelInFlight && callback)
+				callback(frameId, std::move(res));
+
+			lock.lock();
+			inFlight = false;
+			decodeSlot = -1;
+			idle.notify_all();
+		}
+	}
+};
+
+AsyncScanSession::AsyncScanSession(const ReaderOptions& opts, Callback callback, bool pipelined)
+	: _state(std::make_unique<State>())
+{
+	_state->opts = opts;
+	_state->callback = std::move(callback);
+	if (pipelined)
+		_state->preparer = std::thread(&State::runPrepare, _state.get());
+	_state->worker = std::thread(&State::run, _state.get());
+}
+
+AsyncScanSession::~AsyncScanSession()
+{
+	auto& s = *_state;
+	{
+		std::lock_guard lock(s.mutex);
+		s.quit = true;
+		s.cancelInFlight = true; // abort a potentially in-flight scan instead of waiting for it
+		s.frameReady.notify_all();
+		s.prepReady.notify_all();
+	}
+	if (s.preparer.joinable())
+		s.preparer.join();
+	s.worker.join();
+}
+
+void AsyncScanSession::submit(const ImageView& frame, uint64_t frameId)
+{
+	auto copy = CopyImage(frame); // copy (and validate) outside the lock
+	auto& s = *_state;
+	std::lock_guard lock(s.mutex);
+	if (s.error)
+		std::rethrow_exception(std::exchange(s.error, nullptr));
+	s.pending = std::move(copy);
+	s.pendingId = frameId;
+	s.hasPending = true;
+	if (s.inFlight)
+		s.cancelInFlight = true; // the frame being decoded is stale now
+	s.frameReady.notify_one();
+}
+
+void AsyncScanSession::flush()
+{
+	auto& s = *_state;
+	std::unique_lock lock(s.mutex);
+	s.idle.wait(lock, [&] { return !s.hasPending && !s.preparing && s.queuedSlot < 0 && !s.inFlight; });
+	if (s.error)
+		std::rethrow_exception(std::exchange(s.error, nullptr));
+}
+
+#endif // ZXING_EXPERIMENTAL_API
+
 #else // ZXING_READERS
 
 Barcode ReadBarcode(const ImageView&, const ReaderOptions&)
@@ -218,6 +1160,103 @@ Barcodes ReadBarcodes(const ImageView&, const ReaderOptions&)
 	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
 }
 
+#ifdef ZXING_EXPERIMENTAL_API
+
+struct ScanContext::State
+{};
+
+ScanContext::ScanContext(const ReaderOptions& opts) : _opts(opts) {}
+ScanContext::~ScanContext() = default;
+ScanContext::ScanContext(ScanContext&&) noexcept = default;
+ScanContext& ScanContext::operator=(ScanContext&&) noexcept = default;
+
+Barcodes ScanContext::readBarcodes(const ImageView&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+Barcodes ScanContext::readBarcodes(const ImageView&, const Rects&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+Barcodes ReadBarcodes(const ImageView&, const Rects&, const ReaderOptions&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+Barcodes ReadBarcodes(const BitMatrixView&, const ReaderOptions&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+std::vector<Barcodes> ReadBarcodesBatch(ArrayView<ImageView>, const ReaderOptions&, int)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+#ifdef __cpp_impl_coroutine
+// deliberately not a coroutine, so the exception is thrown at the call site like in the other stubs
+Generator<Barcode> ReadBarcodesIncremental(const ImageView&, const ReaderOptions&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+#endif
+
+int VerifyBarcode(const ImageView&, std::string_view, BarcodeFormat)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+struct RowFeedScanner::State
+{};
+
+RowFeedScanner::RowFeedScanner(const ReaderOptions&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+RowFeedScanner::~RowFeedScanner() = default;
+RowFeedScanner::RowFeedScanner(RowFeedScanner&&) noexcept = default;
+RowFeedScanner& RowFeedScanner::operator=(RowFeedScanner&&) noexcept = default;
+
+int RowFeedScanner::feedRow(const uint8_t*, int, int)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+Barcodes RowFeedScanner::releaseBarcodes()
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+Barcode ScanContext::readBarcode(const ImageView&)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+struct AsyncScanSession::State
+{};
+
+AsyncScanSession::AsyncScanSession(const ReaderOptions&, Callback, bool)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+AsyncScanSession::~AsyncScanSession() = default;
+
+void AsyncScanSession::submit(const ImageView&, uint64_t)
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+void AsyncScanSession::flush()
+{
+	throw std::runtime_error("This build of zxing-cpp does not support reading barcodes.");
+}
+
+#endif // ZXING_EXPERIMENTAL_API
+
 #endif // ZXING_READERS
 
 } // ZXing
@@ -8,6 +8,15 @@
 #include "ReaderOptions.h"
 #include "ImageView.h"
 #include "Barcode.h"
+#include "Range.h"
+
+#if defined(ZXING_EXPERIMENTAL_API) && defined(__cpp_impl_coroutine)
+#include "Generator.h"
+#endif
+
+#include <cstdint>
+#include <functional>
+#include <memory>
 
 namespace ZXing {
 
@@ -29,5 +38,214 @@ Barcode ReadBarcode(const ImageView& image, const ReaderOptions& options = {});
  */
 Barcodes ReadBarcodes(const ImageView& image, const ReaderOptions& options = {});
 
+#ifdef ZXING_EXPERIMENTAL_API
+
+/**
+ * Rect describes a region of interest (sub-rectangle) of an image to restrict barcode scanning to,
+ * e.g. a window around the position a symbol was found at in the previous frame of a video stream.
+ */
+// WARNING: this API is experimental and may change/disappear
+struct Rect
+{
+	int x = 0, y = 0, width = 0, height = 0;
+};
+
+using Rects = std::vector<Rect>;
+
+/**
+ * Read barcodes restricted to a list of regions of interest of an ImageView
+ *
+ * Only the specified sub-rectangles are converted to grayscale and binarized. Positions of the
+ * returned barcodes are translated back to full-image coordinates. An empty list scans the whole image.
+ *
+ * @param image  view of the image data including layout and format
+ * @param rois  list of regions of interest to scan, in image coordinates
+ * @param options  optional ReaderOptions to parameterize / speed up detection
+ * @return #Barcodes  list of barcodes found, may be empty
+ */
+Barcodes ReadBarcodes(const ImageView& image, const Rects& rois, const ReaderOptions& options = {});
+
+/**
+ * BitMatrixView is a non-owning view of an externally binarized black/white image, e.g. the output
+ * of a GPU compute implementation of the block-average thresholding performed by the LocalAverage
+ * binarizer. The data is row-packed 1 bit per pixel, least significant bit first within each byte,
+ * a set bit meaning black.
+ */
+// WARNING: this API is experimental and may change/disappear
+struct BitMatrixView
+{
+	const uint8_t* data = nullptr;
+	int width = 0, height = 0;
+	int rowStride = 0; ///< row stride in bytes, 0 means the dense default (width + 7) / 8
+};
+
+/**
+ * Read barcodes from an externally binarized image
+ *
+ * The given black matrix takes the place of the built-in binarizers (ReaderOptions::binarizer is
+ * ignored), so a backend that computes the thresholding on a GPU - or any other source of a 1-bit
+ * image - plugs into the pipeline without a CPU binarization pass: the pattern rows of the linear
+ * readers and the bit matrix of the 2D readers are both served directly from the packed input.
+ * tryDownscale and tryDenoise do not apply.
+ *
+ * @param blackMatrix  view of the pre-binarized image data
+ * @param options  optional ReaderOptions to parameterize / speed up detection
+ * @return #Barcodes  list of barcodes found, may be empty
+ */
+Barcodes ReadBarcodes(const BitMatrixView& blackMatrix, const ReaderOptions& options = {});
+
+#ifdef __cpp_impl_coroutine
+/**
+ * Read barcodes from an ImageView, yielding each Barcode as soon as its decode completes
+ *
+ * In contrast to ReadBarcodes, which returns only after every pyramid layer and invert pass has
+ * been scanned, the returned generator produces each symbol the moment it is decoded. When e.g. a
+ * UI wants to display/beep on the first symbol, its time-to-first-result no longer depends on how
+ * long scanning the rest of the frame takes. The scan runs single threaded on the consuming thread,
+ * advancing while the generator is iterated.
+ *
+ * @param image  view of the image data including layout and format
+ * @param options  optional ReaderOptions to parameterize / speed up detection
+ * @return generator yielding each found #Barcode as it is decoded
+ */
+Generator<Barcode> ReadBarcodesIncremental(const ImageView& image, const ReaderOptions& options = {});
+#endif
+
+/**
+ * Read barcodes from a batch of independent images on a pool of worker threads
+ *
+ * Each worker thread keeps its own set of internal buffers (see ScanContext) alive for the whole
+ * batch, which avoids the per-call setup cost of calling ReadBarcodes in a caller-managed loop.
+ *
+ * @param images  list of views of the images to process
+ * @param options  optional ReaderOptions to parameterize / speed up detection
+ * @param nThreads  number of worker threads, 0 (the default) means one per core
+ * @return one Barcodes list per input image, in input order
+ */
+std::vector<Barcodes> ReadBarcodesBatch(ArrayView<ImageView> images, const ReaderOptions& options = {}, int nThreads = 0);
+
+/**
+ * Verify that an image shows exactly the expected symbol, e.g. for inline print-and-verify stations
+ *
+ * In contrast to a general ReadBarcodes call, this runs only the pure-symbol detector of the given
+ * format on the full image: no downscale pyramid, no invert/close variants, no rotation sweep. The
+ * symbol is expected to fill the image (plus quiet zone), which is exactly what a fixed camera over
+ * a label printer produces.
+ *
+ * @param image  view of the image data including layout and format
+ * @param expectedPayload  the text content the symbol must decode to
+ * @param format  the exact symbology the label was printed in
+ * @return number of error corrected codewords (0 for a flawless print, only tracked for QR family
+ *  symbols so far) if the symbol decodes to the expected payload, -1 otherwise
+ */
+int VerifyBarcode(const ImageView& image, std::string_view expectedPayload, BarcodeFormat format);
+
+/**
+ * RowFeedScanner decodes linear barcodes from individual luminance rows as they arrive, e.g. from a
+ * line-scan camera, without assembling the rows into a 2D frame first. Each fed row runs the 1D row
+ * decoders once and carries the same cross-row state as the frame based sweep: line count and
+ * position accumulation, and the decoder state the stacked DataBar readers use to merge their
+ * (finder, pair) halves across rows. The y coordinates of the returned positions are the row
+ * numbers passed to feedRow().
+ *
+ * Only linear formats are scanned, matrix formats in the options are ignored. Not thread safe.
+ */
+// WARNING: this API is experimental and may change/disappear
+class RowFeedScanner
+{
+	struct State;
+	std::unique_ptr<State> _state;
+
+public:
+	explicit RowFeedScanner(const ReaderOptions& options = {});
+	~RowFeedScanner();
+	RowFeedScanner(RowFeedScanner&&) noexcept;
+	RowFeedScanner& operator=(RowFeedScanner&&) noexcept;
+
+	/// feed the next luminance row (8 bit per pixel, thresholded with a row-local histogram);
+	/// returns the number of symbols accumulated so far that reached ReaderOptions::minLineCount
+	int feedRow(const uint8_t* row, int width, int rowNumber);
+
+	/// return the accumulated symbols with sufficient line count and reset all cross-row state,
+	/// e.g. at the gap between two items passing the camera
+	Barcodes releaseBarcodes();
+};
+
+/**
+ * ScanContext owns the internal buffers of the barcode reading pipeline (grayscale image, downscale
+ * pyramid, etc.) and reuses them between calls. When scanning a video stream frame by frame, keeping
+ * one ScanContext alive avoids re-allocating those buffers for every frame of identical dimensions.
+ *
+ * A ScanContext is not thread safe, use one instance per scanning thread.
+ */
+// WARNING: this API is experimental and may change/disappear
+class ScanContext
+{
+	struct State;
+	std::unique_ptr<State> _state;
+	ReaderOptions _opts;
+	int _frameDiffThreshold = 0;
+
+public:
+	explicit ScanContext(const ReaderOptions& options = {});
+	~ScanContext();
+	ScanContext(ScanContext&&) noexcept;
+	ScanContext& operator=(ScanContext&&) noexcept;
+
+	const ReaderOptions& options() const noexcept { return _opts; }
+
+	/// If set to a value > 0, readBarcodes(image) returns the previous frame's results without re-scanning
+	/// as long as the blockwise mean luminance of the image changed by no more than the given threshold
+	/// since the last call. Useful for fixed-mount scanners that see an identical scene most of the time.
+	int frameDiffThreshold() const noexcept { return _frameDiffThreshold; }
+	ScanContext& setFrameDiffThreshold(int threshold) noexcept { return _frameDiffThreshold = threshold, *this; }
+
+	/// same as ReadBarcode/ReadBarcodes but reusing the internal buffers of this context
+	Barcode readBarcode(const ImageView& image);
+	Barcodes readBarcodes(const ImageView& image);
+	Barcodes readBarcodes(const ImageView& image, const Rects& rois);
+};
+
+/**
+ * AsyncScanSession decouples submitting camera frames from decoding them. Each submitted frame is
+ * copied and decoded on an internal worker thread, which invokes the given callback with the
+ * results. Only the most recently submitted frame is ever queued: when frames arrive faster than
+ * they decode, queued frames that have been superseded are dropped without being looked at and an
+ * in-flight scan is cancelled (at the next pyramid layer / invert variant boundary), so no CPU time
+ * is spent finishing the decode of stale frames. Use one session per camera stream.
+ *
+ * submit() returns as soon as the frame has been copied, so the caller may reuse its buffer
+ * immediately. The callback is invoked on the worker thread and receives no call for dropped or
+ * cancelled frames. An exception thrown by the decoding pipeline (e.g. invalid ReaderOptions) is
+ * re-thrown from the next submit() or flush() call.
+ *
+ * With pipelined=true, a second internal thread converts submitted frames to luminance ahead of the
+ * decoder, so the grayscale extraction of frame N+1 overlaps the detect/decode of frame N. This
+ * lifts the steady-state frame rate towards the cost of the slower of the two stages (instead of
+ * their sum) at the price of one extra thread plus up to two additional buffered frames of latency.
+ * It pays off for large color frames, where the conversion is a sizeable share of the total.
+ */
+// WARNING: this API is experimental and may change/disappear
+class AsyncScanSession
+{
+	struct State;
+	std::unique_ptr<State> _state;
+
+public:
+	/// called on the worker thread with the frameId passed to submit() and the barcodes found in that frame
+	using Callback = std::function<void(uint64_t frameId, Barcodes&& barcodes)>;
+
+	AsyncScanSession(const ReaderOptions& options, Callback callback, bool pipelined = false);
+	~AsyncScanSession();
+
+	/// copy the frame and schedule it for decoding, replacing a potentially still queued older frame
+	void submit(const ImageView& frame, uint64_t frameId);
+
+	/// wait until the most recently submitted frame has been decoded and its callback has returned
+	void flush();
+};
+
+#endif // ZXING_EXPERIMENTAL_API
+
 } // ZXing
 
@@ -28,6 +28,10 @@ enum class Binarizer : unsigned char // needs to be unsigned for the bitfield be
 	GlobalHistogram, ///< T = valley between the 2 largest peaks in the histogram (per line in linear case)
 	FixedThreshold,  ///< T = 127
 	BoolCast,        ///< T = 0, fastest possible
+#ifdef ZXING_EXPERIMENTAL_API
+	// WARNING: this value is experimental and may change/disappear
+	Auto,            ///< pick the cheapest of the above per image based on sampled dynamic range and illumination gradient
+#endif
 };
 
 enum class EanAddOnSymbol : unsigned char // see above
@@ -60,15 +64,21 @@ class ReaderOptions
 	bool _returnErrors             : 1;
 	uint8_t _downscaleFactor       : 3;
 	EanAddOnSymbol _eanAddOnSymbol : 2;
-	Binarizer _binarizer           : 2;
+	Binarizer _binarizer           : 3;
 	TextMode _textMode             : 3;
 	CharacterSet _characterSet     : 6;
 #ifdef ZXING_EXPERIMENTAL_API
 	bool _tryDenoise               : 1;
+	bool _tryPrescreen             : 1;
 #endif
 
 	uint8_t _minLineCount        = 2;
 	uint8_t _maxNumberOfSymbols  = 0xff;
+#ifdef ZXING_EXPERIMENTAL_API
+	uint8_t _maxNumberOfThreads  = 1;
+	int8_t _threadPriority       = 0;
+	uint16_t _timeBudgetMs       = 0;
+#endif
 	uint16_t _downscaleThreshold = 500;
 	BarcodeFormats _formats      = BarcodeFormat::None;
 
@@ -92,7 +102,8 @@ public:
 		  _characterSet(CharacterSet::Unknown)
 #ifdef ZXING_EXPERIMENTAL_API
 		  ,
-		  _tryDenoise(0)
+		  _tryDenoise(0),
+		  _tryPrescreen(0)
 #endif
 	{}
 
@@ -119,6 +130,12 @@ public:
 #ifdef ZXING_EXPERIMENTAL_API
 	/// Also try detecting code after denoising (currently morphological closing filter for 2D symbologies only).
 	ZX_PROPERTY(bool, tryDenoise, setTryDenoise)
+
+	/// Reject frames without any symbol-like structure via a sparsely sampled gradient count before
+	/// binarization. Meant for ambient scanning of a mostly empty field of view; very small symbols
+	/// in a large frame may be missed, so leave this off when every frame is known to show a symbol.
+	// WARNING: this API is experimental and may change/disappear
+	ZX_PROPERTY(bool, tryPrescreen, setTryPrescreen)
 #endif
 
 	/// Binarizer to use internally when using the ReadBarcode function
@@ -141,6 +158,22 @@ public:
 	/// The maximum number of symbols (barcodes) to detect / look for in the image with ReadBarcodes
 	ZX_PROPERTY(uint8_t, maxNumberOfSymbols, setMaxNumberOfSymbols)
 
+#ifdef ZXING_EXPERIMENTAL_API
+	/// The maximum number of worker threads ReadBarcodes may use to scan image variants in parallel (1: single threaded, 0: one per core)
+	// WARNING: this API is experimental and may change/disappear
+	ZX_PROPERTY(uint8_t, maxNumberOfThreads, setMaxNumberOfThreads)
+
+	/// Scheduling priority of this session's parallel work on the shared thread pool; higher values run first.
+	/// Lets e.g. an interactive scan preempt the parallel stages of background/batch sessions, see ThreadPool.
+	// WARNING: this API is experimental and may change/disappear
+	ZX_PROPERTY(int8_t, threadPriority, setThreadPriority)
+
+	/// Soft time budget for scanning one image in milliseconds (0: unlimited). When more than half of it is
+	/// spent, the 1D row sweep widens its row step, and once it is exhausted, no further rows are probed.
+	// WARNING: this API is experimental and may change/disappear
+	ZX_PROPERTY(uint16_t, timeBudgetMs, setTimeBudgetMs)
+#endif
+
 	/// Enable the heuristic to detect and decode "full ASCII"/extended Code39 symbols
 	ZX_PROPERTY(bool, tryCode39ExtendedMode, setTryCode39ExtendedMode)
 
@@ -7,6 +7,9 @@
 
 #include "ReedSolomonDecoder.h"
 
+#include "DecodeCounters.h"
+#include "Profiler.h"
+
 #include "GenericGF.h"
 #include "ZXConfig.h"
 
@@ -17,14 +20,15 @@
 namespace ZXing {
 
 static bool
-RunEuclideanAlgorithm(const GenericGF& field, std::vector<int>&& rCoefs, GenericGFPoly& sigma, GenericGFPoly& omega)
+RunEuclideanAlgorithm(const GenericGF& field, const std::vector<int>& rCoefs, GenericGFPoly& sigma, GenericGFPoly& omega,
+					  int numErasures = 0)
 {
 	int R = Size(rCoefs); // == numECCodeWords
-	GenericGFPoly r(field, std::move(rCoefs));
 	GenericGFPoly& tLast = omega.setField(field);
 	GenericGFPoly& t = sigma.setField(field);
-	ZX_THREAD_LOCAL GenericGFPoly q, rLast;
+	ZX_THREAD_LOCAL GenericGFPoly q, r, rLast;
 
+	r.set(field, rCoefs);
 	rLast.setField(field);
 	q.setField(field);
 
@@ -36,8 +40,10 @@ RunEuclideanAlgorithm(const GenericGF& field, std::vector<int>&& rCoefs, Generic
 	if (r.degree() >= rLast.degree())
 		swap(r, rLast);
 
-	// Run Euclidean algorithm until r's degree is less than R/2
-	while (r.degree() >= R / 2) {
+	// Run Euclidean algorithm until r's degree is less than (R + numErasures) / 2. With erasures,
+	// rCoefs contains the erasure-modified syndromes and sigma comes out as the locator of the
+	// remaining (unknown-position) errors only.
+	while (r.degree() >= (R + numErasures) / 2) {
 		swap(tLast, t);
 		swap(rLast, r);
 
@@ -64,7 +70,7 @@ RunEuclideanAlgorithm(const GenericGF& field, std::vector<int>&& rCoefs, Generic
 	r.multiplyByMonomial(inverse);
 
 	// sigma is t
-	omega = std::move(r);
+	swap(omega, r); // keep r's storage in the malloc cache
 	return true;
 }
 
@@ -102,24 +108,72 @@ FindErrorMagnitudes(const GenericGF& field, const GenericGFPoly& errorEvaluator,
 	return res;
 }
 
-bool
-ReedSolomonDecode(const GenericGF& field, std::vector<int>& message, int numECCodeWords)
+// Evaluates the message polynomial at the non-zero point whose log is logA, without materializing
+// a GenericGFPoly (whose construction would copy the message into its coefficient storage).
+static int EvaluateAt(const GenericGF& field, const std::vector<int>& message, int logA)
 {
-	GenericGFPoly poly(field, message);
+	int s = 0;
+	for (int c : message)
+		s = field.multiplyByLog(s, logA) ^ c;
+	return s;
+}
 
-	std::vector<int> syndromes(numECCodeWords);
+static bool
+DoReedSolomonDecode(const GenericGF& field, std::vector<int>& message, int numECCodeWords,
+					const std::vector<int>& erasurePositions, int* nbErrorsCorrected)
+{
+	if (nbErrorsCorrected)
+		*nbErrorsCorrected = 0;
+	ZX_PROFILE_SCOPE(ReedSolomon);
+
+	int numErasures = Size(erasurePositions);
+	if (numErasures > numECCodeWords)
+		return false;
+
+	// The vast majority of decodes sees an error-free message, where all syndromes are zero and
+	// there is nothing to correct. That common case runs allocation-free: the syndromes go into a
+	// malloc-cached buffer and no polynomial objects are involved before the all-zero check.
+	ZX_THREAD_LOCAL std::vector<int> syndromes;
+	syndromes.resize(numECCodeWords);
+	int anyNonZero = 0;
 	for (int i = 0; i < numECCodeWords; i++)
-		syndromes[numECCodeWords - 1 - i] = poly.evaluateAt(field.exp(i + field.generatorBase()));
+		anyNonZero |= syndromes[numECCodeWords - 1 - i] = EvaluateAt(field, message, i + field.generatorBase());
 
-	// if all syndromes are 0 there is no error to correct
-	if (std::all_of(syndromes.begin(), syndromes.end(), [](int c) { return c == 0; }))
+	if (!anyNonZero)
 		return true;
 
 	ZX_THREAD_LOCAL GenericGFPoly sigma, omega;
+	GenericGFPoly gamma; // erasure locator, product of (X_j * x + 1) over the known-bad positions
+
+	if (numErasures) {
+		int msgLen = Size(message);
+		gamma.setField(field).setMonomial(1);
+		GenericGFPoly term;
+		term.setField(field);
+		for (int pos : erasurePositions) {
+			if (pos < 0 || pos >= msgLen)
+				return false;
+			term.set(field, {field.exp(msgLen - 1 - pos), 1});
+			gamma.multiply(term);
+		}
+		// replace the syndromes with the erasure-modified ones: Xi(x) = S(x) * gamma(x) mod x^R
+		auto& g = gamma.coefficients(); // most significant first, g.back() == gamma_0 == 1
+		std::vector<int> modified(numECCodeWords, 0);
+		for (int k = 0; k < numECCodeWords; k++)
+			for (int j = 0; j <= numErasures && j <= k; j++)
+				modified[numECCodeWords - 1 - k] ^=
+					field.multiply(g[Size(g) - 1 - j], syndromes[numECCodeWords - 1 - (k - j)]);
+		syndromes.swap(modified);
+	}
 
-	if (!RunEuclideanAlgorithm(field, std::move(syndromes), sigma, omega))
+	if (!RunEuclideanAlgorithm(field, syndromes, sigma, omega, numErasures))
 		return false;
 
+	// fold the erasure locator into sigma, so that the root search and Forney's formula below see
+	// all (error and erasure) positions uniformly
+	if (numErasures)
+		sigma.multiply(gamma);
+
 	auto errorLocations = FindErrorLocations(field, sigma);
 	if (Size(errorLocations) != sigma.degree())
 		return false; // Error locator degree does not match number of roots, most likely there are more errors than can be recovered
@@ -137,14 +191,25 @@ ReedSolomonDecode(const GenericGF& field, std::vector<int>& message, int numECCo
 
 #if 1
 	// re-evaluate the syndromes of the recovered message to make sure it is a valid (see #940)
-	poly = GenericGFPoly(field, message);
-
 	for (int i = 0; i < numECCodeWords; i++)
-		if (poly.evaluateAt(field.exp(i + field.generatorBase())) != 0)
+		if (EvaluateAt(field, message, i + field.generatorBase()) != 0)
 			return false;
 #endif
 
+	if (nbErrorsCorrected)
+		*nbErrorsCorrected = Size(errorLocations);
+
 	return true;
 }
 
+bool
+ReedSolomonDecode(const GenericGF& field, std::vector<int>& message, int numECCodeWords,
+				  const std::vector<int>& erasurePositions, int* nbErrorsCorrected)
+{
+	++detail::decodeCounters.rsDecodeCalls;
+	bool res = DoReedSolomonDecode(field, message, numECCodeWords, erasurePositions, nbErrorsCorrected);
+	detail::decodeCounters.rsDecodeFailures += !res;
+	return res;
+}
+
 } // namespace ZXing
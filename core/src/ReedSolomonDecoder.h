@@ -38,10 +38,19 @@ class GenericGF;
 /**
  * @brief ReedSolomonDecode fixes errors in a message containing both data and parity codewords.
  *
+ * Errors-and-erasures decoding: a caller that knows which codewords are untrustworthy (e.g. from
+ * marginal samples during detection) can pass their message positions as erasures. An erasure
+ * consumes only one unit of the correction capacity instead of two (2 * errors + erasures <=
+ * numECCodeWords), doubling the recoverable loss for known-bad positions.
+ *
  * @param message data and error-correction/parity codewords
  * @param numECCodeWords number of error-correction code words
+ * @param erasurePositions indexes into message of codewords known to be unreliable (may be empty)
+ * @param nbErrorsCorrected if non-null, receives the number of corrected codewords (errors and
+ *  erasures), e.g. to grade how much of the correction capacity the symbol consumed
  * @return true iff message errors could successfully be fixed (or there have not been any)
  */
-bool ReedSolomonDecode(const GenericGF& field, std::vector<int>& message, int numECCodeWords);
+bool ReedSolomonDecode(const GenericGF& field, std::vector<int>& message, int numECCodeWords,
+					   const std::vector<int>& erasurePositions = {}, int* nbErrorsCorrected = nullptr);
 
 } // ZXing
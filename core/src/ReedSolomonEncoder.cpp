@@ -7,10 +7,13 @@
 #include "ReedSolomonEncoder.h"
 
 #include "GenericGF.h"
+#include "ZXAlgorithms.h"
+#include "ZXConfig.h"
 
 #include <algorithm>
 #include <iterator>
 #include <stdexcept>
+#include <utility>
 
 namespace ZXing {
 
@@ -41,14 +44,40 @@ ReedSolomonEncoder::encode(std::vector<int>& message, const int numECCodeWords)
 	if (numECCodeWords == 0 || numECCodeWords >= Size(message))
 		throw std::invalid_argument("Invalid number of error correction code words");
 
-	GenericGFPoly info = GenericGFPoly(*_field, std::vector<int>(message.begin(), message.end() - numECCodeWords));
-	info.multiplyByMonomial(1, numECCodeWords);
-	GenericGFPoly _;
-	info.divide(buildGenerator(numECCodeWords), _);
-	auto& coefficients = info.coefficients();
-	int numZeroCoefficients = numECCodeWords - Size(coefficients);
-	std::fill_n(message.end() - numECCodeWords, numZeroCoefficients, 0);
-	std::copy(coefficients.begin(), coefficients.end(), message.end() - numECCodeWords + numZeroCoefficients);
+	const auto& generator = buildGenerator(numECCodeWords).coefficients(); // monic, most significant coefficient first
+
+	// Long division of message * x^numECCodeWords by the generator, carried out directly in a
+	// malloc-cached scratch buffer: the remainder ends up in the last numECCodeWords entries. This
+	// replaces the former GenericGFPoly::divide() based version, which constructed three polynomial
+	// objects per call; the inner loop is one contiguous xor/multiplyByLog sweep per data word.
+	ZX_THREAD_LOCAL std::vector<int> scratch;
+	scratch.resize(message.size());
+	std::copy(message.begin(), message.end() - numECCodeWords, scratch.begin());
+	std::fill(scratch.end() - numECCodeWords, scratch.end(), 0);
+
+	for (int i = 0, n = Size(message) - numECCodeWords; i < n; ++i)
+		if (int coef = scratch[i]) {
+			int logC = _field->log(coef);
+			for (int j = 1; j <= numECCodeWords; ++j)
+				scratch[i + j] ^= _field->multiplyByLog(generator[j], logC);
+		}
+
+	std::copy(scratch.end() - numECCodeWords, scratch.end(), message.end() - numECCodeWords);
+}
+
+void ReedSolomonEncode(const GenericGF& field, std::vector<int>& message, int numECCodeWords)
+{
+	// The cached generator polynomials only depend on (field, degree) and a bulk label generation
+	// job encodes huge numbers of messages against the same few of them. Keep one encoder per field
+	// alive per thread: thread-local instead of a shared locked cache, following the memoization
+	// idiom used elsewhere (see ZX_THREAD_LOCAL in ZXConfig.h), makes concurrent encoding threads
+	// safe without any synchronization. There are only ever a handful of fields (all static
+	// singletons), so a linear search over the pointers is fine.
+	ZX_THREAD_LOCAL std::vector<std::pair<const GenericGF*, ReedSolomonEncoder>> encoders;
+	auto it = FindIf(encoders, [&](const auto& e) { return e.first == &field; });
+	if (it == encoders.end())
+		it = encoders.emplace(encoders.end(), &field, ReedSolomonEncoder(field));
+	it->second.encode(message, numECCodeWords);
 }
 
 } // ZXing
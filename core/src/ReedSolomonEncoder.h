@@ -30,10 +30,10 @@ private:
 
 /**
  * @brief ReedSolomonEncode replaces the last numECCodeWords code words in message with error correction code words
+ *
+ * Keeps one encoder per field alive per thread, so bulk encoding jobs reuse the cached generator
+ * polynomials across messages instead of rebuilding them for every symbol.
  */
-inline void ReedSolomonEncode(const GenericGF& field, std::vector<int>& message, int numECCodeWords)
-{
-	ReedSolomonEncoder(field).encode(message, numECCodeWords);
-}
+void ReedSolomonEncode(const GenericGF& field, std::vector<int>& message, int numECCodeWords);
 
 } // namespace ZXing
@@ -10,6 +10,7 @@
 #include "ZXAlgorithms.h"
 #include "libzueci/zueci.h"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
@@ -24,18 +25,23 @@ std::string BytesToUtf8(ByteView bytes, ECI eci)
 	if (eci == ECI::Unknown)
 		eci = ECI::Binary;
 
-	int error_number = zueci_dest_len_utf8(ToInt(eci), bytes.data(), bytes.size(), replacement, flags, &utf8_len);
-	if (error_number >= ZUECI_ERROR)
-		throw std::runtime_error("zueci_dest_len_utf8 failed");
+	// The typical payload is plain ASCII, which every charset but the UTF-16/32 variants passes on unchanged.
+	bool isAsciiCompatible = eci != ECI::UTF16BE && eci != ECI::UTF16LE && eci != ECI::UTF32BE && eci != ECI::UTF32LE;
+	if (isAsciiCompatible && std::all_of(bytes.begin(), bytes.end(), [](uint8_t c) { return c < 0x80; }))
+		return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
 
-	std::string utf8(utf8_len, 0);
+	// `zueci_dest_len_utf8()` would run the complete conversion a first time just to determine the
+	// output size. Converting straight into the documented worst-case buffer (4 bytes of UTF-8 per
+	// input byte, see zueci.h) and shrinking afterwards halves the work for any non-ASCII content.
+	std::string utf8(4 * bytes.size(), 0);
 
-	error_number = zueci_eci_to_utf8(ToInt(eci), bytes.data(), bytes.size(), replacement, flags,
-									 reinterpret_cast<uint8_t*>(utf8.data()), &utf8_len);
+	int error_number = zueci_eci_to_utf8(ToInt(eci), bytes.data(), bytes.size(), replacement, flags,
+										 reinterpret_cast<uint8_t*>(utf8.data()), &utf8_len);
 	if (error_number >= ZUECI_ERROR)
 		throw std::runtime_error("zueci_eci_to_utf8 failed");
 
-	assert(Size(utf8) == utf8_len);
+	assert(utf8_len <= Size(utf8));
+	utf8.resize(utf8_len);
 
 	return utf8;
 }
@@ -48,6 +54,11 @@ std::string BytesToUtf8(ByteView bytes, ECI eci)
 */
 CharacterSet GuessTextEncoding(ByteView bytes, CharacterSet fallback)
 {
+	// Plain ASCII content (the overwhelming majority of payloads) reads the same in every candidate
+	// encoding, so one vectorizable scan replaces the multi-state heuristics below.
+	if (fallback == CharacterSet::ISO8859_1 && std::all_of(bytes.begin(), bytes.end(), [](uint8_t c) { return c < 0x80; }))
+		return CharacterSet::ISO8859_1;
+
 	// For now, merely tries to distinguish ISO-8859-1, UTF-8 and Shift_JIS,
 	// which should be by far the most common encodings.
 	bool canBeISO88591 = true;
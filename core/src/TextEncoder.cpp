@@ -11,12 +11,31 @@
 #include "ZXAlgorithms.h"
 #include "libzueci/zueci.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace ZXing {
 
+// Charsets that encode the 7 bit ASCII range as identity: everything except the UTF-16/32 variants
+// (multi-byte code units) and the CJK double byte sets (where e.g. Shift_JIS redefines 0x5C/0x7E).
+static bool IsAsciiTransparent(CharacterSet charset)
+{
+	return (charset >= CharacterSet::ASCII && charset <= CharacterSet::Cp1256) || charset == CharacterSet::UTF8
+		   || charset == CharacterSet::BINARY;
+}
+
 void TextEncoder::GetBytes(const std::string& str, CharacterSet charset, std::string& bytes)
 {
+	// ASCII fast path: typical batch payloads (serials, GS1 data, label text) are pure ASCII, which
+	// needs no conversion at all for the transparent charsets. This skips both zueci passes (length
+	// computation plus conversion), which otherwise show up right next to the RS encoding when
+	// writing large batches.
+	if (IsAsciiTransparent(charset)
+		&& std::all_of(str.begin(), str.end(), [](char c) { return static_cast<unsigned char>(c) < 0x80; })) {
+		bytes = str;
+		return;
+	}
+
 	int eci = ToInt(ToECI(charset));
 	const int str_len = narrow_cast<int>(str.length());
 	int eci_len;
@@ -44,6 +63,12 @@ void TextEncoder::GetBytes(const std::string& str, CharacterSet charset, std::st
 
 void TextEncoder::GetBytes(const std::wstring& str, CharacterSet charset, std::string& bytes)
 {
+	// same fast path as above, additionally skipping the utf8 round trip
+	if (IsAsciiTransparent(charset) && std::all_of(str.begin(), str.end(), [](wchar_t c) { return c < 0x80; })) {
+		bytes.assign(str.begin(), str.end());
+		return;
+	}
+
 	GetBytes(ToUtf8(str), charset, bytes);
 }
 
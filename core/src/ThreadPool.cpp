@@ -0,0 +1,145 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ThreadPool.h"
+
+#include "ZXAlgorithms.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ZXing {
+
+struct ThreadPool::Data
+{
+	// A fork-join group: run() keeps it on its stack, so only bookkeeping lives here. toStart and
+	// running are protected by Data::mutex; the group stays registered until run() removes it.
+	struct Group
+	{
+		const std::function<void()>& worker;
+		std::condition_variable joined; // notified when the last running invocation finishes
+		std::exception_ptr exception;
+		int priority;
+		int toStart;     // invocations not yet started
+		int running = 0; // invocations currently executing
+	};
+
+	std::mutex mutex;
+	std::condition_variable pending; // notified when new invocations are up for grabs
+	std::vector<std::thread> threads;
+	std::vector<Group*> groups;
+	int size = std::max(1, int(std::thread::hardware_concurrency()) - 1);
+	int generation = 0; // bumped by setSize() to retire the current worker threads
+	bool quit = false;
+
+	// highest priority group with invocations left to start, requires mutex (FIFO within a priority)
+	Group* nextGroup()
+	{
+		Group* best = nullptr;
+		for (auto* g : groups)
+			if (g->toStart > 0 && (!best || g->priority > best->priority))
+				best = g;
+		return best;
+	}
+
+	// run one invocation of the given group, requires (and temporarily releases) lock
+	void execute(Group& group, std::unique_lock<std::mutex>& lock)
+	{
+		group.toStart--;
+		group.running++;
+		lock.unlock();
+		std::exception_ptr exception;
+		try {
+			group.worker();
+		} catch (...) {
+			exception = std::current_exception();
+		}
+		lock.lock();
+		if (exception && !group.exception)
+			group.exception = std::move(exception);
+		if (--group.running == 0 && group.toStart == 0)
+			group.joined.notify_all();
+	}
+
+	void workerLoop(int myGeneration)
+	{
+		std::unique_lock lock(mutex);
+		while (!quit && myGeneration == generation) {
+			if (Group* g = nextGroup())
+				execute(*g, lock);
+			else
+				pending.wait(lock);
+		}
+	}
+};
+
+ThreadPool::ThreadPool() : _data(new Data) {}
+
+ThreadPool::~ThreadPool()
+{
+	std::vector<std::thread> threads;
+	{
+		std::lock_guard lock(_data->mutex);
+		_data->quit = true;
+		threads.swap(_data->threads);
+	}
+	_data->pending.notify_all();
+	for (auto& t : threads)
+		t.join();
+	delete _data;
+}
+
+ThreadPool& ThreadPool::Instance()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+void ThreadPool::setSize(int nThreads)
+{
+	std::vector<std::thread> retired;
+	{
+		std::lock_guard lock(_data->mutex);
+		_data->size = nThreads ? nThreads : std::max(1, int(std::thread::hardware_concurrency()) - 1);
+		_data->generation++; // running threads finish their current invocation and exit
+		retired.swap(_data->threads);
+	}
+	_data->pending.notify_all();
+	for (auto& t : retired)
+		t.join();
+}
+
+void ThreadPool::run(int nCopies, const std::function<void()>& worker, int priority)
+{
+	auto& d = *_data;
+	Data::Group group{worker, {}, {}, priority, nCopies};
+
+	std::unique_lock lock(d.mutex);
+	// lazily (re)populate the pool, staying one worker short of size to account for the calling thread
+	while (Size(d.threads) < std::min(d.size, nCopies) - 1 && !d.quit)
+		d.threads.emplace_back(&Data::workerLoop, &d, d.generation);
+	d.groups.push_back(&group);
+	d.pending.notify_all();
+
+	// Execute our own share and help with other pending groups while waiting for the join. This way
+	// neither nested run() calls nor an empty or busy pool can ever deadlock: in the worst case the
+	// whole group executes right here on the calling thread.
+	while (group.toStart || group.running) {
+		if (Data::Group* g = d.nextGroup())
+			d.execute(*g, lock);
+		else
+			group.joined.wait(lock);
+	}
+	d.groups.erase(std::find(d.groups.begin(), d.groups.end(), &group));
+
+	if (group.exception)
+		std::rethrow_exception(group.exception);
+}
+
+} // ZXing
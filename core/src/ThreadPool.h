@@ -0,0 +1,60 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+
+namespace ZXing {
+
+/**
+ * One process-wide pool of worker threads shared by every parallel stage (pyramid layers, binarizer
+ * row bands, RS blocks, batch images) and every concurrent scan session. Compared to spawning
+ * std::async threads per call, this bounds the total library thread count when many sessions scan
+ * simultaneously and provides one place to control aggregate throughput.
+ *
+ * Scheduling is a central priority list of fork-join groups rather than per-thread work-stealing
+ * deques: every task the library submits is a coarse worker closure (milliseconds, not
+ * microseconds), so queue contention is negligible. A joining caller executes pending tasks itself
+ * while it waits, hence nested run() calls and a pool size of 0 degrade gracefully to inline
+ * execution and can not deadlock.
+ */
+class ThreadPool
+{
+public:
+	static ThreadPool& Instance();
+
+	/// Set the number of worker threads, 0 (the default) means one less than hardware_concurrency.
+	/// Takes effect immediately; pending tasks are not lost but may finish on the calling threads.
+	void setSize(int nThreads);
+
+	/// Executes nCopies invocations of worker() on up to nCopies threads (including the calling one)
+	/// and returns when all of them have finished. Groups with higher priority are scheduled first.
+	/// The first exception thrown by any of the invocations is rethrown to the caller.
+	void run(int nCopies, const std::function<void()>& worker, int priority = 0);
+
+	~ThreadPool();
+
+private:
+	ThreadPool();
+	struct Data; // the mutex/queue/thread state, hidden to keep <thread> etc. out of this header
+	Data* _data;
+};
+
+/// Configure the size of the process-wide thread pool used by ReadBarcodes() et al., see ThreadPool.
+inline void SetGlobalThreadPoolSize(int nThreads)
+{
+	ThreadPool::Instance().setSize(nThreads);
+}
+
+/// Shorthand for ThreadPool::Instance().run() used by the parallel stages.
+inline void RunParallel(int nCopies, const std::function<void()>& worker, int priority = 0)
+{
+	if (nCopies <= 1)
+		return worker();
+	ThreadPool::Instance().run(nCopies, worker, priority);
+}
+
+} // ZXing
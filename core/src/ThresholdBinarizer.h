@@ -6,9 +6,17 @@
 #pragma once
 
 #include "BinaryBitmap.h"
+#include "BitHacks.h"
 #include "BitMatrix.h"
+#include "Pattern.h"
+#include "ZXConfig.h"
 
 #include <cstdint>
+#include <vector>
+
+#ifdef ZX_HAVE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace ZXing {
 
@@ -19,7 +27,7 @@ class ThresholdBinarizer : public BinaryBitmap
 public:
 	ThresholdBinarizer(const ImageView& buffer, uint8_t threshold = 128) : BinaryBitmap(buffer), _threshold(threshold) {}
 
-	bool getPatternRow(int row, int rotation, PatternRow& res) const override
+	bool getPatternRowImpl(int row, int rotation, PatternRow& res) const override
 	{
 		auto buffer = _buffer.rotated(rotation);
 
@@ -27,6 +35,64 @@ public:
 		const uint8_t* begin = buffer.data(0, row) + GreenIndex(buffer.format());
 		const uint8_t* end = begin + buffer.width() * stride;
 
+#ifdef ZX_HAVE_SSE2
+		if (stride == 1 && buffer.width() >= 64) {
+			// Pack the threshold comparison of 64 pixels into one bit word and extract the runs from the
+			// transition word with count-trailing-zeros. This never materializes a binarized buffer at
+			// all, which is the main cost left in the isPure verification path of clean printed images.
+			const int width = buffer.width();
+			const __m128i thr = _mm_set1_epi8(static_cast<char>(_threshold));
+			auto bits16 = [&thr](const uint8_t* p) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, thr), v)));
+			};
+
+			res.clear();
+			uint64_t lastBit = 0; // the color of the pixel before the current word, starting with white
+			int pos = 0, lastPos = 0;
+			auto addTransitions = [&](uint64_t m, int n) {
+				uint64_t t = (m ^ (m << 1 | lastBit)) & (n == 64 ? ~0ULL : (1ULL << n) - 1);
+				while (t) {
+					int i = BitHacks::NumberOfTrailingZeros(t);
+					res.push_back(narrow_cast<PatternRow::value_type>(pos + i - lastPos));
+					lastPos = pos + i;
+					t &= t - 1;
+				}
+				lastBit = m >> (n - 1) & 1;
+				pos += n;
+			};
+
+			int x = 0;
+			for (; x + 64 <= width; x += 64)
+				addTransitions(bits16(begin + x) | uint64_t(bits16(begin + x + 16)) << 16
+								   | uint64_t(bits16(begin + x + 32)) << 32 | uint64_t(bits16(begin + x + 48)) << 48,
+							   64);
+			if (x < width) {
+				uint64_t m = 0;
+				for (int j = 0; x + j < width; ++j)
+					m |= uint64_t(begin[x + j] <= _threshold) << j;
+				addTransitions(m, width - x);
+			}
+
+			res.push_back(narrow_cast<PatternRow::value_type>(width - lastPos));
+			if (lastBit)
+				res.push_back(0); // last value is number of white pixels, here 0
+
+			return true;
+		}
+#endif
+
+		if (stride == 1 && buffer.width() >= 16) {
+			// binarize the row into a dense buffer (a trivially vectorizable compare) and leave the
+			// run-length encoding to the block-wise transition finder in GetPatternRow
+			ZX_THREAD_LOCAL std::vector<uint8_t> binarized;
+			binarized.resize(buffer.width());
+			for (int x = 0; x < buffer.width(); ++x)
+				binarized[x] = begin[x] <= _threshold;
+			GetPatternRow(Range(binarized), res);
+			return true;
+		}
+
 		auto* lastPos = begin;
 		bool lastVal = false;
 
@@ -10,6 +10,7 @@
 #include "ZXTestSupport.h"
 #include "ZXAlgorithms.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <cstdint>
 #include <sstream>
@@ -105,8 +106,17 @@ static void AppendFromUtf8(utf8_t utf8, std::wstring& buffer)
 	char32_t codePoint = 0;
 	state_t state = kAccepted;
 
-	for (auto b : utf8) {
-		if (Utf8Decode(b, state, codePoint) != kAccepted)
+	for (auto i = utf8.begin(); i != utf8.end();) {
+		// ASCII runs - the whole content for most linear symbologies - are appended as one plain
+		// widening copy that the compiler vectorizes, the DFA only sees multi-byte sequences
+		if (state == kAccepted && *i < 128) {
+			auto run = std::find_if(i, utf8.end(), [](char8_t c) { return c >= 128; });
+			buffer.append(i, run);
+			i = run;
+			continue;
+		}
+
+		if (Utf8Decode(*i++, state, codePoint) != kAccepted)
 			continue;
 
 		if (sizeof(wchar_t) == 2 && codePoint > 0xffff) { // surrogate pair
@@ -190,14 +200,24 @@ static void AppendToUtf8(std::wstring_view str, std::string& utf8)
 	utf8.reserve(utf8.size() + Utf8CountBytes(str));
 
 	char buffer[4];
-	for (; str.size(); str.remove_prefix(1))
-	{
+	while (str.size()) {
+		// ASCII run fast path, see AppendFromUtf8
+		size_t run = 0;
+		while (run < str.size() && uint32_t(str[run]) < 0x80)
+			++run;
+		if (run) {
+			utf8.append(str.begin(), str.begin() + run);
+			str.remove_prefix(run);
+			continue;
+		}
+
 		uint32_t cp;
 		if (IsUtf16SurrogatePair(str)) {
 			cp = Utf32FromUtf16Surrogates(str);
 			str.remove_prefix(1);
 		} else
 			cp = str.front();
+		str.remove_prefix(1);
 
 		auto bufLength = Utf32ToUtf8(cp, buffer);
 		utf8.append(buffer, bufLength);
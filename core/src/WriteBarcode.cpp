@@ -9,12 +9,18 @@
 #include "WriteBarcode.h"
 #include "BitMatrix.h"
 #include "JSON.h"
+#include "ThreadPool.h"
 
 #if !defined(ZXING_READERS) && !defined(ZXING_WRITERS)
 #include "Version.h"
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
 #ifdef ZXING_USE_ZINT
 
@@ -68,6 +74,7 @@ ZX_RO_PROPERTY(bool, gs1);
 ZX_RO_PROPERTY(bool, stacked);
 ZX_RO_PROPERTY(int, version);
 ZX_RO_PROPERTY(int, dataMask);
+ZX_RO_PROPERTY(bool, optimalSegmentation);
 
 #undef ZX_RO_PROPERTY
 
@@ -117,21 +124,31 @@ static std::string ToSVG(ImageView iv)
 
 	// see https://stackoverflow.com/questions/10789059/create-qr-code-in-vector-image/60638350#60638350
 
-	std::ostringstream res;
+	std::string res;
+	res.reserve(200 + 4 * iv.width() * iv.height());
 
-	res << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-		<< "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" viewBox=\"0 0 " << iv.width() << " " << iv.height()
-		<< "\" stroke=\"none\">\n"
-		<< "<path d=\"";
+	StrAppend(res, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+			  "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" viewBox=\"0 0 ",
+			  std::to_string(iv.width()), " ", std::to_string(iv.height()), "\" stroke=\"none\">\n<path d=\"");
 
+	// one path command per horizontal run of black modules instead of one rect per module
 	for (int y = 0; y < iv.height(); ++y)
-		for (int x = 0; x < iv.width(); ++x)
-			if (*iv.data(x, y) == 0)
-				res << "M" << x << "," << y << "h1v1h-1z";
+		for (int x = 0; x < iv.width();) {
+			if (*iv.data(x, y) != 0) {
+				++x;
+				continue;
+			}
+			int run = x + 1;
+			while (run < iv.width() && *iv.data(run, y) == 0)
+				++run;
+			auto w = std::to_string(run - x);
+			StrAppend(res, "M", std::to_string(x), ",", std::to_string(y), "h", w, "v1h-", w, "z");
+			x = run;
+		}
 
-	res << "\"/>\n</svg>";
+	res += "\"/>\n</svg>";
 
-	return res.str();
+	return res;
 }
 
 static Image ToImage(BitMatrix bits, bool isLinearCode, const WriterOptions& opts)
@@ -444,6 +461,12 @@ Barcode CreateBarcode(const void* data, int size, int mode, const CreatorOptions
 	auto res = Barcode(std::move(decRes), std::move(detRes), opts.format());
 #endif
 
+	// Note on two "obvious" optimizations that don't fit here: the zint_symbol can not be reused
+	// across calls, since it is moved into the returned Barcode below to serve later WriteBarcodeTo*
+	// calls (the batch API hands each worker its own CreatorOptions clone instead). And transcribing
+	// zint's encoded_data directly into the BitMatrix would require replicating the per-symbology
+	// quiet zone and row height layout, while the OUT_BUFFER_INTERMEDIATE bitmap requested above is
+	// already a minimal one-byte-per-module-pixel rendering that is converted in this single pass.
 	auto bits = BitMatrix(zint->bitmap_width, zint->bitmap_height);
 	std::transform(zint->bitmap, zint->bitmap + zint->bitmap_width * zint->bitmap_height, bits.row(0).begin(),
 				   [](unsigned char v) { return (v == '1') * BitMatrix::SET_V; });
@@ -522,6 +545,7 @@ Barcode CreateBarcodeFromText(std::string_view contents, const CreatorOptions& o
 	if (!opts.ecLevel().empty())
 		writer.setEccLevel(std::stoi(opts.ecLevel()));
 	writer.setEncoding(CharacterSet::UTF8); // write UTF8 (ECI value 26) for maximum compatibility
+	writer.setOptimalSegmentation(opts.optimalSegmentation().value_or(false));
 
 	return CreateBarcode(writer.encode(std::string(contents), 0, IsLinearBarcode(opts.format()) ? 50 : 0), opts);
 }
@@ -580,6 +604,58 @@ Barcode CreateBarcodeFromBytes(const void*, int, const CreatorOptions&)
 
 namespace ZXing {
 
+// the zint symbol / encoder state attached to CreatorOptions must not be shared between threads,
+// so each batch worker encodes with its own copy of the user-visible option state
+static CreatorOptions CloneCreatorOptions(const CreatorOptions& opts)
+{
+	return CreatorOptions(opts.format(), opts.options())
+		.readerInit(opts.readerInit())
+		.forceSquareDataMatrix(opts.forceSquareDataMatrix())
+		.ecLevel(opts.ecLevel());
+}
+
+Barcodes CreateBarcodesFromText(ArrayView<std::string_view> contents, const CreatorOptions& opts, int nThreads)
+{
+	if (contents.empty())
+		return {};
+
+	// Print jobs tend to repeat payloads heavily (e.g. carton labels duplicated per side), so encode
+	// each distinct payload only once and fill the repeats with copies afterwards. A copy shares the
+	// immutable bit matrix (and zint symbol) via their shared_ptr members, so duplicates cost a hash
+	// lookup instead of a full encode + verify-read.
+	std::unordered_map<std::string_view, size_t> firstSeen;
+	std::vector<size_t> duplicateOf(contents.size(), SIZE_MAX);
+	for (size_t i = 0; i < contents.size(); ++i)
+		if (auto [it, inserted] = firstSeen.try_emplace(contents[i], i); !inserted)
+			duplicateOf[i] = it->second;
+
+	Barcodes res(contents.size());
+	int maxThreads = std::clamp(nThreads ? nThreads : int(std::thread::hardware_concurrency()), 1,
+								narrow_cast<int>(firstSeen.size()));
+
+	if (maxThreads <= 1) {
+		for (size_t i = 0; i < contents.size(); ++i)
+			if (duplicateOf[i] == SIZE_MAX)
+				res[i] = CreateBarcodeFromText(contents[i], opts);
+	} else {
+		std::atomic<size_t> next = 0;
+		auto worker = [&]() {
+			auto threadOpts = CloneCreatorOptions(opts);
+			for (size_t i = next++; i < contents.size(); i = next++)
+				if (duplicateOf[i] == SIZE_MAX)
+					res[i] = CreateBarcodeFromText(contents[i], threadOpts);
+		};
+		// RunParallel propagates a potential exception (e.g. content not encodable) to the caller
+		RunParallel(maxThreads, worker);
+	}
+
+	for (size_t i = 0; i < contents.size(); ++i)
+		if (duplicateOf[i] != SIZE_MAX)
+			res[i] = res[duplicateOf[i]];
+
+	return res;
+}
+
 std::string WriteBarcodeToSVG(const Barcode& barcode, [[maybe_unused]] const WriterOptions& opts)
 {
 	auto zint = barcode.zint();
@@ -629,6 +705,95 @@ Image WriteBarcodeToImage(const Barcode& barcode, [[maybe_unused]] const WriterO
 #endif
 }
 
+void WriteBarcodeToBuffer(const Barcode& barcode, uint8_t* buffer, int width, int height, int rowStride,
+						  const WriterOptions& opts)
+{
+	auto iv = barcode.symbol();
+	if (!iv.data() || !buffer)
+		throw std::invalid_argument("WriteBarcodeToBuffer: missing symbol or buffer");
+
+	if (rowStride == 0)
+		rowStride = width;
+
+	const int quietZone = opts.withQuietZones() ? 10 : 0;
+	const int scale = std::min((width - 2 * quietZone) / iv.width(), (height - 2 * quietZone) / iv.height());
+	if (scale < 1)
+		throw std::invalid_argument("WriteBarcodeToBuffer: buffer too small for symbol (incl. quiet zones)");
+
+	const int leftPadding = (width - iv.width() * scale) / 2;
+	const int topPadding = (height - iv.height() * scale) / 2;
+
+	for (int y = 0; y < height; ++y)
+		std::memset(buffer + y * rowStride, 0xff, width);
+
+	// draw each module row once as memset runs of merged black modules, then replicate it scale-1
+	// times with plain row copies
+	for (int my = 0; my < iv.height(); ++my) {
+		uint8_t* row = buffer + (topPadding + my * scale) * rowStride + leftPadding;
+		for (int mx = 0; mx < iv.width();) {
+			if (*iv.data(mx, my) != 0) {
+				++mx;
+				continue;
+			}
+			int run = mx + 1;
+			while (run < iv.width() && *iv.data(run, my) == 0)
+				++run;
+			std::memset(row + mx * scale, 0, (run - mx) * scale);
+			mx = run;
+		}
+		for (int s = 1; s < scale; ++s)
+			std::memcpy(row + s * rowStride, row, iv.width() * scale);
+	}
+}
+
+void WriteBarcodeToRowBands(const Barcode& barcode, int width, int height, int bandHeight,
+							const std::function<void(ByteView, int)>& sink, const WriterOptions& opts)
+{
+	auto iv = barcode.symbol();
+	if (!iv.data() || !sink)
+		throw std::invalid_argument("WriteBarcodeToRowBands: missing symbol or sink");
+
+	bandHeight = bandHeight > 0 ? std::min(bandHeight, height) : height;
+
+	const int quietZone = opts.withQuietZones() ? 10 : 0;
+	const int scale = std::min((width - 2 * quietZone) / iv.width(), (height - 2 * quietZone) / iv.height());
+	if (scale < 1)
+		throw std::invalid_argument("WriteBarcodeToRowBands: output size too small for symbol (incl. quiet zones)");
+
+	const int leftPadding = (width - iv.width() * scale) / 2;
+	const int topPadding = (height - iv.height() * scale) / 2;
+
+	std::vector<uint8_t> band(width * bandHeight);
+	int filled = 0; // number of rows collected in the current band
+	int lastModuleRow = -2; // the module row rendered into the previous scanline, -1 for quiet zone rows
+
+	for (int y = 0; y < height; ++y) {
+		uint8_t* row = band.data() + filled * width;
+		int my = y >= topPadding && y < topPadding + iv.height() * scale ? (y - topPadding) / scale : -1;
+		if (my == lastModuleRow && filled > 0) {
+			std::memcpy(row, row - width, width); // repeated scanline of the same module row
+		} else {
+			std::memset(row, 0xff, width);
+			for (int mx = 0; my >= 0 && mx < iv.width();) {
+				if (*iv.data(mx, my) != 0) {
+					++mx;
+					continue;
+				}
+				int run = mx + 1;
+				while (run < iv.width() && *iv.data(run, my) == 0)
+					++run;
+				std::memset(row + leftPadding + mx * scale, 0, (run - mx) * scale);
+				mx = run;
+			}
+			lastModuleRow = my;
+		}
+		if (++filled == bandHeight || y == height - 1) {
+			sink(ByteView(band.data(), filled * width), y + 1 - filled);
+			filled = 0;
+		}
+	}
+}
+
 std::string WriteBarcodeToUtf8(const Barcode& barcode, [[maybe_unused]] const WriterOptions& options)
 {
 	auto iv = barcode.symbol();
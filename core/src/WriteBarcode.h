@@ -9,7 +9,9 @@
 
 #include "Barcode.h"
 #include "ImageView.h"
+#include "Range.h"
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -55,6 +57,7 @@ public:
 	ZX_RO_PROPERTY(bool, stacked);
 	ZX_RO_PROPERTY(int, version);
 	ZX_RO_PROPERTY(int, dataMask);
+	ZX_RO_PROPERTY(bool, optimalSegmentation);
 #undef ZX_RO_PROPERTY
 };
 
@@ -94,6 +97,19 @@ Barcode CreateBarcodeFromBytes(const R& contents, const CreatorOptions& options)
 }
 #endif
 
+/**
+ * Generate a batch of barcodes of one format, optionally using multiple worker threads.
+ *
+ * The per-format setup (symbology mapping, option parsing, encoder state) is shared across the
+ * whole batch instead of being paid per CreateBarcodeFromText call.
+ *
+ * @param contents  list of UTF-8 strings, each encoded into one barcode
+ * @param options  CreatorOptions (including BarcodeFormat)
+ * @param nThreads  number of worker threads, 0 (the default) means one per core
+ * @return one #Barcode per input string, in input order
+ */
+Barcodes CreateBarcodesFromText(ArrayView<std::string_view> contents, const CreatorOptions& options, int nThreads = 0);
+
 // =================================================================================
 
 class WriterOptions
@@ -150,6 +166,42 @@ std::string WriteBarcodeToUtf8(const Barcode& barcode, const WriterOptions& opti
  */
 Image WriteBarcodeToImage(const Barcode& barcode, const WriterOptions& options = {});
 
+/**
+ * Rasterize barcode symbol directly into a caller supplied grayscale (Lum) buffer
+ *
+ * The symbol is centered and scaled to the largest whole-module size that fits the buffer
+ * (including quiet zones if requested), without any intermediate image allocation.
+ * Throws if the buffer is too small to fit one pixel per module.
+ *
+ * @param barcode  Barcode to write
+ * @param buffer  destination buffer of at least height * rowStride bytes
+ * @param width  width of the destination region in pixels
+ * @param height  height of the destination region in pixels
+ * @param rowStride  number of bytes per buffer row, 0 (the default) means width
+ * @param options  WriterOptions to parameterize rendering
+ */
+void WriteBarcodeToBuffer(const Barcode& barcode, uint8_t* buffer, int width, int height, int rowStride = 0,
+						  const WriterOptions& options = {});
+
+/**
+ * Stream the rasterized barcode symbol into a sink callback, one band of rows at a time
+ *
+ * Same geometry as WriteBarcodeToBuffer (centered, integer module scale, optional quiet zones) but
+ * only a single band of bandHeight * width grayscale (Lum) pixels is ever allocated, so oversized
+ * symbols can be composed into a larger layout without a whole-symbol raster. The sink is called
+ * with consecutive bands (the last one possibly shorter) and the index of the band's first row.
+ *
+ * @param barcode  Barcode to write
+ * @param width  width of the rasterized symbol in pixels
+ * @param height  height of the rasterized symbol in pixels
+ * @param bandHeight  number of rows per sink call, 0 means all rows at once
+ * @param sink  callback receiving each band of rows and the index of its first row
+ * @param options  WriterOptions to parameterize rendering
+ */
+void WriteBarcodeToRowBands(const Barcode& barcode, int width, int height, int bandHeight,
+							const std::function<void(ByteView band, int firstRow)>& sink,
+							const WriterOptions& options = {});
+
 } // ZXing
 
 #endif // ZXING_EXPERIMENTAL_API
@@ -90,12 +90,18 @@ inline constexpr int Size(const char* s) noexcept {
 
 inline constexpr int Size(char) noexcept { return 1; }
 
+template <typename... Args>
+void StrAppend(std::string& res, Args&&... args)
+{
+	res.reserve(res.size() + (Size(args) + ...));
+	(res += ... += args);
+}
+
 template <typename... Args>
 std::string StrCat(Args&&... args)
 {
 	std::string res;
-	res.reserve((Size(args) + ...));
-	(res += ... += args);
+	StrAppend(res, std::forward<Args>(args)...);
 	return res;
 }
 
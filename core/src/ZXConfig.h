@@ -12,6 +12,30 @@
 // for Windows in Visual Studio 2019 on Intel 64-bit using thread_local causes a dependency to VCRUNTIME140_1.dll, so you need 2019 runtime DLLs instead of only 2015 version.
 #define ZX_THREAD_LOCAL thread_local // '' (nothing), 'thread_local' or 'static'
 
+// Explicit SIMD kernels (e.g. in ReadBarcode.cpp and HybridBinarizer.cpp) are guarded by the following
+// macro. SSE2 is part of the x86-64 baseline, so this only ever disables code on pre-2004 32 bit x86.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ZX_HAVE_SSE2
+#endif
+
 // The Galoir Field abstractions used in Reed-Solomon error correction code can use more memory to eliminate a modulo
 // operation. This improves performance but might not be the best option if RAM is scarce. The effect is a few kB big.
 #define ZX_REED_SOLOMON_USE_MORE_MEMORY_FOR_SPEED
+
+// Compile-time selection of the supported reader format families, see ZXING_READER_FORMATS in
+// core/CMakeLists.txt. A build that does not explicitly restrict the formats gets all of them.
+#if !defined(ZXING_READER_LINEARCODES) && !defined(ZXING_READER_QRCODE) && !defined(ZXING_READER_DATAMATRIX) \
+	&& !defined(ZXING_READER_AZTEC) && !defined(ZXING_READER_PDF417) && !defined(ZXING_READER_MAXICODE)
+#define ZXING_READER_LINEARCODES
+#define ZXING_READER_QRCODE
+#define ZXING_READER_DATAMATRIX
+#define ZXING_READER_AZTEC
+#define ZXING_READER_PDF417
+#define ZXING_READER_MAXICODE
+#endif
+
+// Per-stage timing instrumentation of the reading pipeline. When enabled, the accumulated wall-clock time
+// of each pipeline stage (grayscale conversion, downscaling, binarization, decoding, Reed-Solomon error
+// correction) is tracked per thread and can be queried/reset via ZXing::Profile()/ResetProfile(), see
+// Profiler.h. It is disabled by default and has no runtime cost whatsoever when disabled.
+// #define ZX_ENABLE_PROFILING
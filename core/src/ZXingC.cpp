@@ -325,6 +325,57 @@ ZXing_Barcodes* ZXing_ReadBarcodes(const ZXing_ImageView* iv, const ZXing_Reader
 	ZX_CATCH(NULL);
 }
 
+#ifdef ZXING_EXPERIMENTAL_API
+
+struct ZXing_ScanSession
+{
+	ScanContext context;
+	Barcodes results;
+	std::string text;
+};
+
+ZXing_ScanSession* ZXing_ScanSession_new(const ZXing_ReaderOptions* opts)
+{
+	ZX_TRY(new ZXing_ScanSession{ScanContext(opts ? *opts : ReaderOptions{}), {}, {}})
+}
+
+void ZXing_ScanSession_delete(ZXing_ScanSession* session)
+{
+	delete session;
+}
+
+void ZXing_ScanSession_setFrameDiffThreshold(ZXing_ScanSession* session, int threshold)
+{
+	if (session)
+		session->context.setFrameDiffThreshold(threshold);
+}
+
+const ZXing_Barcodes* ZXing_ScanSession_scan(ZXing_ScanSession* session, const ZXing_ImageView* iv)
+{
+	ZX_CHECK(session && iv, "ScanSession and/or ImageView param is NULL")
+	try {
+		// move-assigning into the session keeps the vector's capacity alive across frames
+		session->results = session->context.readBarcodes(*iv);
+		return &session->results;
+	}
+	ZX_CATCH(NULL);
+}
+
+const uint8_t* ZXing_Barcode_bytesView(const ZXing_Barcode* barcode, int* len)
+{
+	if (len)
+		*len = barcode ? Size(barcode->bytes()) : 0;
+	return barcode ? barcode->bytes().data() : NULL;
+}
+
+const char* ZXing_ScanSession_text(ZXing_ScanSession* session, const ZXing_Barcode* barcode)
+{
+	ZX_CHECK(session && barcode, "ScanSession and/or Barcode param is NULL")
+	ZX_TRY((session->text = barcode->text()).c_str())
+}
+
+#endif
+
 
 #ifdef ZXING_EXPERIMENTAL_API
 /*
@@ -270,6 +270,35 @@ ZXing_Barcodes* ZXing_ReadBarcodes(const ZXing_ImageView* iv, const ZXing_Reader
 
 #ifdef ZXING_EXPERIMENTAL_API
 
+/*
+ * Scan session: keeps the internal pipeline buffers (see ScanContext) and the result set alive
+ * frame to frame and returns results as views into session-owned memory, eliminating the per-call
+ * allocation and copy churn of ZXing_ReadBarcodes in video scanning loops.
+ */
+
+typedef struct ZXing_ScanSession ZXing_ScanSession;
+
+/** Note: opts is optional, i.e. it can be NULL, which will imply default settings.
+ * A session is not thread safe, use one session per scanning thread. */
+ZXing_ScanSession* ZXing_ScanSession_new(const ZXing_ReaderOptions* opts);
+void ZXing_ScanSession_delete(ZXing_ScanSession* session);
+
+/** See ScanContext::setFrameDiffThreshold() in ReadBarcode.h */
+void ZXing_ScanSession_setFrameDiffThreshold(ZXing_ScanSession* session, int threshold);
+
+/** Scan one frame. The returned result set is owned by the session and valid until the next
+ * ZXing_ScanSession_scan() call or ZXing_ScanSession_delete(); do not pass it to
+ * ZXing_Barcodes_delete(). Returns NULL in case of an error (see ZXing_LastErrorMsg()). */
+const ZXing_Barcodes* ZXing_ScanSession_scan(ZXing_ScanSession* session, const ZXing_ImageView* iv);
+
+/** View variant of ZXing_Barcode_bytes(): returns a pointer into the barcode itself, valid for the
+ * lifetime of the barcode (for session results: until the next scan); nothing to free. */
+const uint8_t* ZXing_Barcode_bytesView(const ZXing_Barcode* barcode, int* len);
+
+/** View variant of ZXing_Barcode_text(): the string lives in the session and is valid until the
+ * next ZXing_ScanSession_text() or ZXing_ScanSession_scan() call; nothing to free. */
+const char* ZXing_ScanSession_text(ZXing_ScanSession* session, const ZXing_Barcode* barcode);
+
 /*
  * ZXing/WriteBarcode.h
  */
@@ -15,6 +15,7 @@
 #include "ReedSolomonDecoder.h"
 #include "ZXTestSupport.h"
 #include "ZXAlgorithms.h"
+#include "ZXConfig.h"
 
 #include <cctype>
 #include <cstring>
@@ -66,14 +67,23 @@ static int TotalBitsInLayer(int layers, bool compact)
 }
 
 /**
-* Gets the array of bits from an Aztec Code matrix
-*
-* @return the array of bits
+* Table of matrix coordinates of each bit in the codeword spiral, in raw bit order. The table
+* depends only on (compact, layers), so it is memoized across decodes: the common video use case
+* sees the same symbol size frame after frame and the extraction below degenerates into a flat
+* gather with no per-bit coordinate math (the alignment line mapping is folded into the table).
 */
-static BitArray ExtractBits(const DetectorResult& ddata)
+static const std::vector<uint16_t>& SpiralCoords(bool compact, int layers)
 {
-	bool compact = ddata.isCompact();
-	int layers = ddata.nbLayers();
+	ZX_THREAD_LOCAL struct
+	{
+		int key = -1;
+		std::vector<uint16_t> coords;
+	} cache;
+
+	int key = 2 * layers + compact;
+	if (cache.key == key)
+		return cache.coords;
+
 	int baseMatrixSize = (compact ? 11 : 14) + layers * 4; // not including alignment lines
 	std::vector<int> map(baseMatrixSize, 0);
 
@@ -89,8 +99,13 @@ static BitArray ExtractBits(const DetectorResult& ddata)
 			map[origCenter + i] = center + newOffset + 1;
 		}
 	}
-	auto& matrix = ddata.bits();
-	BitArray rawbits(TotalBitsInLayer(layers, compact));
+
+	auto& coords = cache.coords;
+	coords.resize(2 * TotalBitsInLayer(layers, compact));
+	auto set = [&](int bit, int x, int y) {
+		coords[2 * bit + 0] = narrow_cast<uint16_t>(map[x]);
+		coords[2 * bit + 1] = narrow_cast<uint16_t>(map[y]);
+	};
 	for (int i = 0, rowOffset = 0; i < layers; i++) {
 		int rowSize = (layers - i) * 4 + (compact ? 9 : 12);
 		// The top-left most point of this layer is <low, low> (not including alignment lines)
@@ -102,17 +117,35 @@ static BitArray ExtractBits(const DetectorResult& ddata)
 			int colOffset = j * 2;
 			for (int k = 0; k < 2; k++) {
 				// left column
-				rawbits.set(rowOffset + 0 * rowSize + colOffset + k, matrix.get(map[low + k], map[low + j]));
+				set(rowOffset + 0 * rowSize + colOffset + k, low + k, low + j);
 				// bottom row
-				rawbits.set(rowOffset + 2 * rowSize + colOffset + k, matrix.get(map[low + j], map[high - k]));
+				set(rowOffset + 2 * rowSize + colOffset + k, low + j, high - k);
 				// right column
-				rawbits.set(rowOffset + 4 * rowSize + colOffset + k, matrix.get(map[high - k], map[high - j]));
+				set(rowOffset + 4 * rowSize + colOffset + k, high - k, high - j);
 				// top row
-				rawbits.set(rowOffset + 6 * rowSize + colOffset + k, matrix.get(map[high - j], map[low + k]));
+				set(rowOffset + 6 * rowSize + colOffset + k, high - j, low + k);
 			}
 		}
 		rowOffset += rowSize * 8;
 	}
+
+	cache.key = key;
+	return coords;
+}
+
+/**
+* Gets the array of bits from an Aztec Code matrix
+*
+* @return the array of bits
+*/
+static BitArray ExtractBits(const DetectorResult& ddata)
+{
+	auto& coords = SpiralCoords(ddata.isCompact(), ddata.nbLayers());
+	auto& matrix = ddata.bits();
+	BitArray rawbits(Size(coords) / 2);
+	const uint16_t* c = coords.data();
+	for (int i = 0; i < Size(rawbits); ++i, c += 2)
+		rawbits.set(i, matrix.get(c[0], c[1]));
 	return rawbits;
 }
 
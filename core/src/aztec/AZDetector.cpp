@@ -125,6 +125,42 @@ static std::vector<ConcentricPattern> FindPureFinderPattern(const BitMatrix& ima
 		return {};
 }
 
+void FindFinderPatternsInRow(const BitMatrix& image, const PatternRow& row, int y, std::vector<ConcentricPattern>& res)
+{
+	PatternView next = row;
+	next.shift(1); // the center pattern we are looking for starts with white and is 7 wide (compact code)
+
+	while (next = FindAztecCenterPattern(next), next.isValid()) {
+		PointF p(next.pixelsInFront() + next[0] + next[1] + next[2] + next[3] / 2.0, y + 0.5);
+
+		// make sure p is not 'inside' an already found pattern area
+		bool found = false;
+		for (auto old = res.rbegin(); old != res.rend(); ++old) {
+			// search from back to front, stop once we are out of range due to the y-coordinate
+			if (p.y - old->y > old->size / 2)
+				break;
+			if (distance(p, *old) < old->size / 2) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found) {
+			log(p, 1);
+
+			auto pattern = LocateAztecCenter(image, p, next.sum());
+			if (pattern) {
+				log(*pattern, 3);
+				assert(image.get(*pattern));
+				res.push_back(*pattern);
+			}
+		}
+
+		next.skipPair();
+		next.extend();
+	}
+}
+
 static std::vector<ConcentricPattern> FindFinderPatterns(const BitMatrix& image, bool tryHarder)
 {
 	std::vector<ConcentricPattern> res;
@@ -184,52 +220,14 @@ static std::vector<ConcentricPattern> FindFinderPatterns(const BitMatrix& image,
 
 	PatternRow row;
 
-	for (int y = margin; y < image.height() - margin; y += skip)
-	{
+	for (int y = margin; y < image.height() - margin; y += skip) {
 		GetPatternRow(image, y, row, false);
-		PatternView next = row;
-		next.shift(1); // the center pattern we are looking for starts with white and is 7 wide (compact code)
-
-#if 1
-		while (next = FindAztecCenterPattern(next), next.isValid()) {
-#else
-		constexpr auto PATTERN = FixedPattern<7, 7>{1, 1, 1, 1, 1, 1, 1};
-		while (next = FindLeftGuard(next, 0, PATTERN, 0.5), next.isValid()) {
-#endif
-			PointF p(next.pixelsInFront() + next[0] + next[1] + next[2] + next[3] / 2.0, y + 0.5);
-
-			// make sure p is not 'inside' an already found pattern area
-			bool found = false;
-			for (auto old = res.rbegin(); old != res.rend(); ++old) {
-				// search from back to front, stop once we are out of range due to the y-coordinate
-				if (p.y - old->y > old->size / 2)
-					break;
-				if (distance(p, *old) < old->size / 2) {
-					found = true;
-					break;
-				}
-			}
-
-			if (!found) {
-				++N;
-				log(p, 1);
-
-				auto pattern = LocateAztecCenter(image, p, next.sum());
-				if (pattern) {
-					log(*pattern, 3);
-					assert(image.get(*pattern));
-					res.push_back(*pattern);
-				}
-			}
-
-			next.skipPair();
-			next.extend();
-		}
+		FindFinderPatternsInRow(image, row, y, res);
 	}
 #endif
 
 #ifdef PRINT_DEBUG
-	printf("\n# checked centeres: %d, # found centers: %d\n", N, Size(res));
+	printf("\n# found centers: %d\n", Size(res));
 #endif
 	return res;
 }
@@ -343,19 +341,22 @@ static void ExtractParameters(int modeMessage, bool compact, int& nbLayers, int&
 	}
 }
 
-DetectorResult Detect(const BitMatrix& image, bool isPure, bool tryHarder)
+DetectorResult Detect(const BitMatrix& image, bool isPure, bool tryHarder, const std::vector<ConcentricPattern>* candidates)
 {
-	return FirstOrDefault(Detect(image, isPure, tryHarder, 1));
+	return FirstOrDefault(Detect(image, isPure, tryHarder, 1, candidates));
 }
 
-DetectorResults Detect(const BitMatrix& image, bool isPure, bool tryHarder, int maxSymbols)
+DetectorResults Detect(const BitMatrix& image, bool isPure, bool tryHarder, int maxSymbols,
+					   const std::vector<ConcentricPattern>* candidates)
 {
 #ifdef PRINT_DEBUG
 	LogMatrixWriter lmw(log, image, 5, "az-log.pnm");
 #endif
 
 	DetectorResults res;
-	auto fps = isPure ? FindPureFinderPattern(image) : FindFinderPatterns(image, tryHarder);
+	auto fps = isPure ? FindPureFinderPattern(image)
+			   : candidates ? *candidates
+							: FindFinderPatterns(image, tryHarder);
 	for (const auto& fp : fps) {
 		auto fpQuad = FindConcentricPatternCorners(image, fp, fp.size, 3);
 		if (!fpQuad)
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "ConcentricFinder.h"
+
 #include <vector>
 
 namespace ZXing {
@@ -16,10 +18,16 @@ namespace Aztec {
 
 class DetectorResult;
 
-DetectorResult Detect(const BitMatrix& image, bool isPure, bool tryHarder = true);
+// single-row part of the finder pattern sweep, also used by the shared candidate stage in ConcentricCandidates.cpp
+void FindFinderPatternsInRow(const BitMatrix& image, const PatternRow& row, int y, std::vector<ConcentricPattern>& res);
+
+// candidates, if given, replaces the (non-isPure) finder pattern sweep, see ConcentricCandidates.h
+DetectorResult Detect(const BitMatrix& image, bool isPure, bool tryHarder = true,
+					  const std::vector<ConcentricPattern>* candidates = nullptr);
 
 using DetectorResults = std::vector<DetectorResult>;
-DetectorResults Detect(const BitMatrix& image, bool isPure, bool tryHarder, int maxSymbols);
+DetectorResults Detect(const BitMatrix& image, bool isPure, bool tryHarder, int maxSymbols,
+					   const std::vector<ConcentricPattern>* candidates = nullptr);
 
 } // Aztec
 } // ZXing
@@ -60,6 +60,7 @@ static void GenerateCheckWords(const BitArray& bitArray, int totalBits, int word
 	std::vector<int> messageWords = ToInts(bitArray, wordSize, totalBits / wordSize);
 	ReedSolomonEncode(GetGFFromWordSize(wordSize), messageWords, (totalBits - bitArray.size()) / wordSize);
 	int startPad = totalBits % wordSize;
+	messageBits.reserve(totalBits);
 	messageBits = BitArray();
 	messageBits.appendBits(0, startPad);
 	for (int messageWord : messageWords)
@@ -139,6 +140,7 @@ void StuffBits(const BitArray& bits, int wordSize, BitArray& out)
 {
 	out = BitArray();
 	int n = bits.size();
+	out.reserve(n + n / (wordSize - 1) + wordSize); // worst case: one stuffing bit per word
 	int mask = (1 << wordSize) - 2;
 	for (int i = 0; i < n; i += wordSize) {
 		int word = 0;
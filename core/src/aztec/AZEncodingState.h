@@ -6,13 +6,9 @@
 
 #pragma once
 
-#include "AZToken.h"
-
-#include <vector>
-
 namespace ZXing::Aztec {
 
-class Token;
+struct TokenNode;
 
 /**
 * State represents all information about a sequence necessary to generate the current output.
@@ -21,9 +17,10 @@ class Token;
 class EncodingState
 {
 public:
-	// The list of tokens that we output.  If we are in Binary Shift mode, this
-	// token list does *not* yet included the token for those bytes
-	std::vector<Token> tokens;
+	// The chain of tokens that we output, linked back to front and shared between states (the
+	// nodes live in a per-encode arena).  If we are in Binary Shift mode, this chain does *not*
+	// yet include the token for those bytes
+	const TokenNode* tokens = nullptr;
 
 	// The current mode of the encoding (or the mode to which we'll return if
 	// we're in Binary Shift mode.
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <deque>
 #include <list>
 #include <vector>
 
@@ -120,52 +121,68 @@ static const std::array<std::array<int8_t, 6>, 6>& InitShiftTable()
 
 const std::array<std::array<int8_t, 6>, 6>& SHIFT_TABLE = InitShiftTable();
 
+// The token chains of all live states share their common prefixes: appending a token allocates a
+// single node in the per-encode arena and links it to the unmodified parent chain. This replaces
+// the former copy of a complete std::vector<Token> per explored state, which dominated the encode
+// profile with allocations quadratic in the payload length.
+struct TokenNode
+{
+	Token token;
+	const TokenNode* prev;
+};
+
+using TokenArena = std::deque<TokenNode>; // deque: stable addresses, chunked allocation
+
+static const TokenNode* Append(TokenArena& arena, const TokenNode* prev, Token token)
+{
+	return &arena.emplace_back(TokenNode{token, prev});
+}
+
 // Create a new state representing this state with a latch to a (not
 // necessary different) mode, and then a code.
-static EncodingState LatchAndAppend(const EncodingState& state, int mode, int value)
+static EncodingState LatchAndAppend(TokenArena& arena, const EncodingState& state, int mode, int value)
 {
 	//assert binaryShiftByteCount == 0;
 	int bitCount = state.bitCount;
 	auto tokens = state.tokens;
 	if (mode != state.mode) {
 		int latch = LATCH_TABLE[state.mode][mode];
-		tokens.push_back(Token::CreateSimple(latch & 0xFFFF, latch >> 16));
+		tokens = Append(arena, tokens, Token::CreateSimple(latch & 0xFFFF, latch >> 16));
 		bitCount += latch >> 16;
 	}
 	int latchModeBitCount = mode == MODE_DIGIT ? 4 : 5;
-	tokens.push_back(Token::CreateSimple(value, latchModeBitCount));
+	tokens = Append(arena, tokens, Token::CreateSimple(value, latchModeBitCount));
 	return EncodingState{ tokens, mode, 0, bitCount + latchModeBitCount };
 }
 
 // Create a new state representing this state, with a temporary shift
 // to a different mode to output a single value.
-static EncodingState ShiftAndAppend(const EncodingState& state, int mode, int value)
+static EncodingState ShiftAndAppend(TokenArena& arena, const EncodingState& state, int mode, int value)
 {
 	//assert binaryShiftByteCount == 0 && this.mode != mode;
 	int thisModeBitCount = state.mode == MODE_DIGIT ? 4 : 5;
 	// Shifts exist only to UPPER and PUNCT, both with tokens size 5.
 	auto tokens = state.tokens;
-	tokens.push_back(Token::CreateSimple(SHIFT_TABLE[state.mode][mode], thisModeBitCount));
-	tokens.push_back(Token::CreateSimple(value, 5));
+	tokens = Append(arena, tokens, Token::CreateSimple(SHIFT_TABLE[state.mode][mode], thisModeBitCount));
+	tokens = Append(arena, tokens, Token::CreateSimple(value, 5));
 	return EncodingState{ tokens, state.mode, 0, state.bitCount + thisModeBitCount + 5 };
 }
 
 // Create the state identical to this one, but we are no longer in
 // Binary Shift mode.
-static EncodingState EndBinaryShift(const EncodingState& state, int index)
+static EncodingState EndBinaryShift(TokenArena& arena, const EncodingState& state, int index)
 {
 	if (state.binaryShiftByteCount == 0) {
 		return state;
 	}
-	auto tokens = state.tokens;
-	tokens.push_back(Token::CreateBinaryShift(index - state.binaryShiftByteCount, state.binaryShiftByteCount));
+	auto tokens = Append(arena, state.tokens, Token::CreateBinaryShift(index - state.binaryShiftByteCount, state.binaryShiftByteCount));
 	//assert token.getTotalBitCount() == this.bitCount;
 	return EncodingState{ tokens, state.mode, 0, state.bitCount };
 }
 
 // Create a new state representing this state, but an additional character
 // output in Binary Shift mode.
-static EncodingState AddBinaryShiftChar(const EncodingState& state, int index)
+static EncodingState AddBinaryShiftChar(TokenArena& arena, const EncodingState& state, int index)
 {
 	auto tokens = state.tokens;
 	int mode = state.mode;
@@ -173,7 +190,7 @@ static EncodingState AddBinaryShiftChar(const EncodingState& state, int index)
 	if (state.mode == MODE_PUNCT || state.mode == MODE_DIGIT) {
 		//assert binaryShiftByteCount == 0;
 		int latch = LATCH_TABLE[mode][MODE_UPPER];
-		tokens.push_back(Token::CreateSimple(latch & 0xFFFF, latch >> 16));
+		tokens = Append(arena, tokens, Token::CreateSimple(latch & 0xFFFF, latch >> 16));
 		bitCount += latch >> 16;
 		mode = MODE_UPPER;
 	}
@@ -181,7 +198,7 @@ static EncodingState AddBinaryShiftChar(const EncodingState& state, int index)
 	EncodingState result{ tokens, mode, state.binaryShiftByteCount + 1, bitCount + deltaBitCount };
 	if (result.binaryShiftByteCount == 2047 + 31) {
 		// The string is as long as it's allowed to be.  We should end it.
-		result = EndBinaryShift(result, index + 1);
+		result = EndBinaryShift(arena, result, index + 1);
 	}
 	return result;
 }
@@ -216,37 +233,42 @@ static bool IsBetterThanOrEqualTo(const EncodingState& state, const EncodingStat
 	return newModeBitCount <= other.bitCount;
 }
 
-static BitArray ToBitArray(const EncodingState& state, const std::string& text)
+static BitArray ToBitArray(TokenArena& arena, const EncodingState& state, const std::string& text)
 {
-	auto endState = EndBinaryShift(state, Size(text));
+	auto endState = EndBinaryShift(arena, state, Size(text));
+	// The chain is linked back to front, collect and reverse it.
+	std::vector<Token> symbols;
+	for (const TokenNode* node = endState.tokens; node != nullptr; node = node->prev) {
+		symbols.push_back(node->token);
+	}
 	BitArray bits;
 	// Add each token to the result.
-	for (const Token& symbol : endState.tokens) {
-		symbol.appendTo(bits, text);
+	for (auto symbol = symbols.rbegin(); symbol != symbols.rend(); ++symbol) {
+		symbol->appendTo(bits, text);
 	}
 	//assert bitArray.getSize() == this.bitCount;
 	return bits;
 }
 
-static void UpdateStateForPair(const EncodingState& state, int index, int pairCode, std::list<EncodingState>& result)
+static void UpdateStateForPair(TokenArena& arena, const EncodingState& state, int index, int pairCode, std::list<EncodingState>& result)
 {
-	EncodingState stateNoBinary = EndBinaryShift(state, index);
+	EncodingState stateNoBinary = EndBinaryShift(arena, state, index);
 	// Possibility 1.  Latch to MODE_PUNCT, and then append this code
-	result.push_back(LatchAndAppend(stateNoBinary, MODE_PUNCT, pairCode));
+	result.push_back(LatchAndAppend(arena, stateNoBinary, MODE_PUNCT, pairCode));
 	if (state.mode != MODE_PUNCT) {
 		// Possibility 2.  Shift to MODE_PUNCT, and then append this code.
 		// Every state except MODE_PUNCT (handled above) can shift
-		result.push_back(ShiftAndAppend(stateNoBinary, MODE_PUNCT, pairCode));
+		result.push_back(ShiftAndAppend(arena, stateNoBinary, MODE_PUNCT, pairCode));
 	}
 	if (pairCode == 3 || pairCode == 4) {
 		// both characters are in DIGITS.  Sometimes better to just add two digits
-		auto digitState = LatchAndAppend(stateNoBinary, MODE_DIGIT, 16 - pairCode);	// period or comma in DIGIT
-		result.push_back(LatchAndAppend(digitState, MODE_DIGIT, 1));				// space in DIGIT
+		auto digitState = LatchAndAppend(arena, stateNoBinary, MODE_DIGIT, 16 - pairCode);	// period or comma in DIGIT
+		result.push_back(LatchAndAppend(arena, digitState, MODE_DIGIT, 1));					// space in DIGIT
 	}
 	if (state.binaryShiftByteCount > 0) {
 		// It only makes sense to do the characters as binary if we're already
 		// in binary mode.
-		result.push_back(AddBinaryShiftChar(AddBinaryShiftChar(state, index), index + 1));
+		result.push_back(AddBinaryShiftChar(arena, AddBinaryShiftChar(arena, state, index), index + 1));
 	}
 }
 
@@ -276,11 +298,11 @@ static std::list<EncodingState> SimplifyStates(const std::list<EncodingState>& s
 	return result;
 }
 
-static std::list<EncodingState> UpdateStateListForPair(const std::list<EncodingState>& states, int index, int pairCode)
+static std::list<EncodingState> UpdateStateListForPair(TokenArena& arena, const std::list<EncodingState>& states, int index, int pairCode)
 {
 	std::list<EncodingState> result;
 	for (auto& state : states) {
-		UpdateStateForPair(state, index, pairCode, result);
+		UpdateStateForPair(arena, state, index, pairCode, result);
 	}
 	return SimplifyStates(result);
 }
@@ -290,7 +312,7 @@ static std::list<EncodingState> UpdateStateListForPair(const std::list<EncodingS
 // Return a set of states that represent the possible ways of updating this
 // state for the next character.  The resulting set of states are added to
 // the "result" list.
-static void UpdateStateForChar(const EncodingState& state, const std::string& text, int index, std::list<EncodingState>& result)
+static void UpdateStateForChar(TokenArena& arena, const EncodingState& state, const std::string& text, int index, std::list<EncodingState>& result)
 {
 	int ch = text[index] & 0xff;
 	bool charInCurrentTable = CHAR_MAP[state.mode][ch] > 0;
@@ -301,7 +323,7 @@ static void UpdateStateForChar(const EncodingState& state, const std::string& te
 		if (charInMode > 0) {
 			if (firstTime) {
 				// Only create stateNoBinary the first time it's required.
-				stateNoBinary = EndBinaryShift(state, index);
+				stateNoBinary = EndBinaryShift(arena, state, index);
 				firstTime = false;
 			}
 			// Try generating the character by latching to its mode
@@ -310,13 +332,13 @@ static void UpdateStateForChar(const EncodingState& state, const std::string& te
 				// any other mode except possibly digit (which uses only 4 bits).  Any
 				// other latch would be equally successful *after* this character, and
 				// so wouldn't save any bits.
-				result.push_back(LatchAndAppend(stateNoBinary, mode, charInMode));
+				result.push_back(LatchAndAppend(arena, stateNoBinary, mode, charInMode));
 			}
 			// Try generating the character by switching to its mode.
 			if (!charInCurrentTable && SHIFT_TABLE[state.mode][mode] >= 0) {
 				// It never makes sense to temporarily shift to another mode if the
 				// character exists in the current mode.  That can never save bits.
-				result.push_back(ShiftAndAppend(stateNoBinary, mode, charInMode));
+				result.push_back(ShiftAndAppend(arena, stateNoBinary, mode, charInMode));
 			}
 		}
 	}
@@ -324,18 +346,18 @@ static void UpdateStateForChar(const EncodingState& state, const std::string& te
 		// It's never worthwhile to go into binary shift mode if you're not already
 		// in binary shift mode, and the character exists in your current mode.
 		// That can never save bits over just outputting the char in the current mode.
-		result.push_back(AddBinaryShiftChar(state, index));
+		result.push_back(AddBinaryShiftChar(arena, state, index));
 	}
 }
 
 // We update a set of states for a new character by updating each state
 // for the new character, merging the results, and then removing the
 // non-optimal states.
-static std::list<EncodingState> UpdateStateListForChar(const std::list<EncodingState>& states, const std::string& text, int index)
+static std::list<EncodingState> UpdateStateListForChar(TokenArena& arena, const std::list<EncodingState>& states, const std::string& text, int index)
 {
 	std::list<EncodingState> result;
 	for (auto& state : states) {
-		UpdateStateForChar(state, text, index, result);
+		UpdateStateForChar(arena, state, text, index, result);
 	}
 	return result.size() > 1 ? SimplifyStates(result) : result;
 }
@@ -346,8 +368,9 @@ static std::list<EncodingState> UpdateStateListForChar(const std::list<EncodingS
 BitArray
 HighLevelEncoder::Encode(const std::string& text)
 {
+	TokenArena arena;
 	std::list<EncodingState> states;
-	states.push_back(EncodingState{ std::vector<Token>(), MODE_UPPER, 0, 0 });
+	states.push_back(EncodingState{ nullptr, MODE_UPPER, 0, 0 });
 	for (int index = 0; index < Size(text); index++) {
 		int pairCode;
 		int nextChar = index + 1 < Size(text) ? text[index + 1] : 0;
@@ -361,17 +384,17 @@ HighLevelEncoder::Encode(const std::string& text)
 		if (pairCode > 0) {
 			// We have one of the four special PUNCT pairs.  Treat them specially.
 			// Get a new set of states for the two new characters.
-			states = UpdateStateListForPair(states, index, pairCode);
+			states = UpdateStateListForPair(arena, states, index, pairCode);
 			index++;
 		} else {
 			// Get a new set of states for the new character.
-			states = UpdateStateListForChar(states, text, index);
+			states = UpdateStateListForChar(arena, states, text, index);
 		}
 	}
 	// We are left with a set of states.  Find the shortest one.
 	EncodingState minState = *std::min_element(states.begin(), states.end(), [](const EncodingState& a, const EncodingState& b) { return a.bitCount < b.bitCount; });
 	// Convert it to a bit array, and return.
-	return ToBitArray(minState, text);
+	return ToBitArray(arena, minState, text);
 }
 
 } // namespace ZXing::Aztec
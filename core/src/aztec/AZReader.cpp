@@ -17,15 +17,30 @@
 
 #include <utility>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include "ConcentricCandidates.h"
+#endif
+
 namespace ZXing::Aztec {
 
+// see ConcentricCandidates.h: if a QR reader ran on this bitmap before, it left the Aztec
+// candidate set of the shared sweep behind, saving this reader its own full-frame row scan
+static const std::vector<ConcentricPattern>* SharedCandidates(const BinaryBitmap& image [[maybe_unused]])
+{
+#ifdef ZXING_EXPERIMENTAL_API
+	if (const auto* shared = image.concentricCandidates())
+		return &shared->aztec;
+#endif
+	return nullptr;
+}
+
 Barcode Reader::decode(const BinaryBitmap& image) const
 {
 	auto binImg = image.getBitMatrix();
 	if (binImg == nullptr)
 		return {};
 	
-	DetectorResult detectorResult = Detect(*binImg, _opts.isPure(), _opts.tryHarder());
+	DetectorResult detectorResult = Detect(*binImg, _opts.isPure(), _opts.tryHarder(), SharedCandidates(image));
 	if (!detectorResult.isValid())
 		return {};
 
@@ -43,7 +58,7 @@ Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 	if (binImg == nullptr)
 		return {};
 	
-	auto detRess = Detect(*binImg, _opts.isPure(), _opts.tryHarder(), maxSymbols);
+	auto detRess = Detect(*binImg, _opts.isPure(), _opts.tryHarder(), maxSymbols, SharedCandidates(image));
 
 	Barcodes baracodes;
 	for (auto&& detRes : detRess) {
@@ -11,9 +11,13 @@
 #include "BitMatrix.h"
 #include "ByteArray.h"
 #include "DMVersion.h"
+#include "ZXAlgorithms.h"
+#include "ZXConfig.h"
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace ZXing::DataMatrix {
 
@@ -148,19 +152,32 @@ BitMatrix BitMatrixFromCodewords(const ByteArray& codewords, int width, int heig
 	return result;
 }
 
-// Extracts the data bits from a BitMatrix that contains alignment patterns.
-static BitMatrix ExtractDataBits(const Version& version, const BitMatrix& bits)
+// The x,y module position of every codeword bit in the sampled symbol matrix: 8 positions (16
+// bytes) per codeword. The placement arithmetic of VisitMatrix and the alignment pattern removal
+// of the former ExtractDataBits depend on nothing but the symbol size, so the table is computed
+// once per size and cached. The Version objects are statics, a pointer comparison suffices as key.
+static const std::vector<uint8_t>& PlacementTable(const Version& version)
 {
-	BitMatrix res(version.dataWidth(), version.dataHeight());
-
-	for (int y = 0; y < res.height(); ++y)
-		for (int x = 0; x < res.width(); ++x) {
-			int ix = x + 1 + (x / version.dataBlockWidth) * 2;
-			int iy = y + 1 + (y / version.dataBlockHeight) * 2;
-			res.set(x, y, bits.get(ix, iy));
-		}
+	ZX_THREAD_LOCAL struct
+	{
+		const Version* version = nullptr;
+		std::vector<uint8_t> coords;
+	} cache;
+
+	if (cache.version != &version) {
+		std::vector<uint8_t> coords;
+		coords.reserve(16 * version.totalCodewords());
+		VisitMatrix(version.dataHeight(), version.dataWidth(), [&](const BitPosArray& bitPos) {
+			for (auto& p : bitPos) {
+				coords.push_back(narrow_cast<uint8_t>(p.col + 1 + (p.col / version.dataBlockWidth) * 2));
+				coords.push_back(narrow_cast<uint8_t>(p.row + 1 + (p.row / version.dataBlockHeight) * 2));
+			}
+		});
+		cache.version = &version;
+		cache.coords = std::move(coords);
+	}
 
-	return res;
+	return cache.coords;
 }
 
 /**
@@ -172,21 +189,19 @@ static BitMatrix ExtractDataBits(const Version& version, const BitMatrix& bits)
 */
 ByteArray CodewordsFromBitMatrix(const BitMatrix& bits, const Version& version)
 {
-	BitMatrix dataBits = ExtractDataBits(version, bits);
+	const auto& table = PlacementTable(version);
+	if (Size(table) != 16 * version.totalCodewords())
+		return {};
 
 	ByteArray result(version.totalCodewords());
-	auto codeword = result.begin();
+	const uint8_t* c = table.data();
 
-	VisitMatrix(dataBits.height(), dataBits.width(), [&codeword, &dataBits](const BitPosArray& bitPos) {
-		// Read the 8 bits of one of the special corner/utah symbols into the current codeword
-		*codeword = 0;
-		for (auto& p : bitPos)
-			AppendBit(*codeword, dataBits.get(p.col, p.row));
-		++codeword;
-	});
-
-	if (codeword != result.end())
-		return {};
+	for (auto& codeword : result) {
+		uint8_t b = 0;
+		for (int i = 0; i < 8; ++i, c += 2)
+			AppendBit(b, bits.get(c[0], c[1]));
+		codeword = b;
+	}
 
 	return result;
 }
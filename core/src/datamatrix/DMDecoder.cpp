@@ -14,6 +14,7 @@
 #include "DecoderResult.h"
 #include "GenericGF.h"
 #include "ReedSolomonDecoder.h"
+#include "ThreadPool.h"
 #include "ZXAlgorithms.h"
 #include "ZXTestSupport.h"
 
@@ -24,6 +25,11 @@
 #include <utility>
 #include <vector>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include <atomic>
+#include <thread>
+#endif
+
 namespace ZXing::DataMatrix {
 
 /**
@@ -391,7 +397,7 @@ CorrectErrors(ByteArray& codewordBytes, int numDataCodewords)
 	return true;
 }
 
-static DecoderResult DoDecode(const BitMatrix& bits)
+static DecoderResult DoDecode(const BitMatrix& bits, int maxThreads [[maybe_unused]])
 {
 	// Construct a parser and read version, error-correction level
 	const Version* version = VersionForDimensionsOf(bits);
@@ -415,6 +421,35 @@ retry:
 
 	// Error-correct and copy data blocks together into a stream of bytes
 	const int dataBlocksCount = Size(dataBlocks);
+#ifdef ZXING_EXPERIMENTAL_API
+	// The block corrections are fully independent: dispatch them to worker threads when the caller
+	// grants a thread budget (see the analogous code in QRDecoder). Only the 144x144 symbol has
+	// enough blocks (10) to pass the 4-blocks-per-thread bar.
+	int nThreads = std::clamp(maxThreads ? maxThreads : int(std::thread::hardware_concurrency()), 1, dataBlocksCount / 4);
+	if (nThreads > 1) {
+		std::atomic<int> next = 0;
+		std::atomic<bool> failed = false;
+		auto worker = [&]() {
+			for (int i = next++; i < dataBlocksCount; i = next++)
+				if (!CorrectErrors(dataBlocks[i].codewords, dataBlocks[i].numDataCodewords))
+					failed = true;
+		};
+		RunParallel(nThreads, worker);
+
+		if (failed) {
+			if (version->versionNumber == 24 && !fix259) {
+				fix259 = true;
+				goto retry;
+			}
+			return ChecksumError();
+		}
+		for (int j = 0; j < dataBlocksCount; j++)
+			for (int i = 0; i < dataBlocks[j].numDataCodewords; i++) {
+				// De-interlace data blocks.
+				resultBytes[i * dataBlocksCount + j] = dataBlocks[j].codewords[i];
+			}
+	} else
+#endif
 	for (int j = 0; j < dataBlocksCount; j++) {
 		auto& [numDataCodewords, codewords] = dataBlocks[j];
 		if (!CorrectErrors(codewords, numDataCodewords)) {
@@ -449,16 +484,16 @@ static BitMatrix FlippedL(const BitMatrix& bits)
 	return res;
 }
 
-DecoderResult Decode(const BitMatrix& bits)
+DecoderResult Decode(const BitMatrix& bits, int maxThreads)
 {
-	auto res = DoDecode(bits);
+	auto res = DoDecode(bits, maxThreads);
 	if (res.isValid())
 		return res;
 
 	//TODO:
 	// * unify bit mirroring helper code with QRReader?
 	// * rectangular symbols with the a size of 8 x Y are not supported a.t.m.
-	if (auto mirroredRes = DoDecode(FlippedL(bits)); mirroredRes.error().type() != Error::Checksum) {
+	if (auto mirroredRes = DoDecode(FlippedL(bits), maxThreads); mirroredRes.error().type() != Error::Checksum) {
 		mirroredRes.setIsMirrored(true);
 		return mirroredRes;
 	}
@@ -13,7 +13,11 @@ class BitMatrix;
 
 namespace DataMatrix {
 
-DecoderResult Decode(const BitMatrix& bits);
+/**
+ * @param maxThreads thread budget for correcting the data blocks of large symbols in parallel
+ *  (0 means hardware concurrency); pass 1 when the caller runs on a worker thread itself
+ */
+DecoderResult Decode(const BitMatrix& bits, int maxThreads = 1);
 
 } // DataMatrix
 } // ZXing
@@ -567,9 +567,15 @@ class EdgeTracer : public BitMatrixCursorF
 public:
 	ByteMatrix* history = nullptr;
 	int state = 0;
+	// shared per-frame work budget: bounds the total number of trace iterations spent on a single
+	// image so that cluttered bin images with hundreds of dead-end edge chains don't blow up the
+	// worst case run time. nullptr means unlimited.
+	int* traceBudget = nullptr;
 
 	using BitMatrixCursorF::BitMatrixCursor;
 
+	bool budgetExhausted() const { return traceBudget && *traceBudget < 0; }
+
 	bool updateDirectionFromOrigin(PointF origin)
 	{
 		auto old_d = d;
@@ -600,6 +606,8 @@ public:
 	{
 		line.setDirectionInward(dEdge);
 		do {
+			if (traceBudget && --*traceBudget < 0)
+				return false;
 			log(p);
 			line.add(p);
 			if (line.points().size() % 50 == 10 && !updateDirectionFromLineCentroid(line))
@@ -620,6 +628,8 @@ public:
 			// this fixes a deadlock in falsepositives-1/#570.png and the regression in #574
 			if (p == std::exchange(lastP, p) || steps++ > (gaps == 0 ? 2 : gaps + 1) * maxStepsPerGap)
 				return false;
+			if (traceBudget && --*traceBudget < 0)
+				return false;
 			log(p);
 
 			// if we drifted too far outside of the code, break
@@ -717,9 +727,40 @@ public:
 	}
 };
 
+// arc-length parametrized lookup into a traced edge point chain: returns the point at the fraction
+// f in [0..1] of the total chain length, linearly interpolated between the two neighboring points
+static PointF PointOnChain(const std::vector<PointF>& points, double f)
+{
+	double length = 0;
+	for (size_t i = 1; i < points.size(); ++i)
+		length += distance(points[i], points[i - 1]);
+
+	double target = f * length, sum = 0;
+	for (size_t i = 1; i < points.size(); ++i) {
+		auto d = distance(points[i], points[i - 1]);
+		if (sum + d >= target && d > 0)
+			return points[i - 1] + (target - sum) / d * (points[i] - points[i - 1]);
+		sum += d;
+	}
+	return points.back();
+}
+
+// number of adjacent same-colored module pairs in the clock tracks (top row and right column),
+// which are supposed to strictly alternate. a high count means the grid placement missed the
+// modules, e.g. because the symbol is on a curved surface.
+static int TimingDefects(const BitMatrix& bits)
+{
+	int res = 0;
+	for (int x = 1; x < bits.width(); ++x)
+		res += bits.get(x, 0) == bits.get(x - 1, 0);
+	for (int y = 1; y < bits.height(); ++y)
+		res += bits.get(bits.width() - 1, y) == bits.get(bits.width() - 1, y - 1);
+	return res;
+}
+
 static DetectorResult Scan(EdgeTracer& startTracer, std::array<DMRegressionLine, 4>& lines)
 {
-	while (startTracer.moveToNextWhiteAfterBlack()) {
+	while (!startTracer.budgetExhausted() && startTracer.moveToNextWhiteAfterBlack()) {
 		log(startTracer.p);
 
 		PointF tl, bl, br, tr;
@@ -809,6 +850,10 @@ static DetectorResult Scan(EdgeTracer& startTracer, std::array<DMRegressionLine,
 		tr = intersect(lineT, lineR);
 		br = intersect(lineB, lineR);
 
+		// modules() below filters the traced points against the straight line fit. keep a copy of
+		// the full chains: the curved surface fall back after sampling needs the unfiltered trace.
+		auto chainT = lineT.points(), chainR = lineR.points();
+
 		int dimT, dimR;
 		double fracT, fracR;
 		auto splitDouble = [](double d, int* i, double* f) {
@@ -850,6 +895,70 @@ static DetectorResult Scan(EdgeTracer& startTracer, std::array<DMRegressionLine,
 
 		auto res = SampleGrid(*startTracer.img, dimT, dimR, PerspectiveTransform(Rectangle(dimT, dimR, 0), sourcePoints));
 
+		// A single perspective transform cannot follow a symbol on a curved surface (cylindrical
+		// bottles etc.). If the clock tracks of the sampled grid don't alternate the way they are
+		// supposed to, re-determine the dimension by counting transitions along the traced clock
+		// edge chains and re-sample the grid in vertical bands whose transforms are fitted to the
+		// traced top and bottom chains. The chains follow the actual (curved) edges, in contrast to
+		// the fitted straight border lines and their projection based module count used above.
+		if (int defects = res.isValid() ? TimingDefects(res.bits()) : INT_MAX; defects * 16 > dimT + dimR) {
+			auto& img = *startTracer.img;
+			auto orientedChain = [](const std::vector<PointF>& points, PointF dir) {
+				auto chain = points;
+				if (dot(chain.back() - chain.front(), dir) < 0)
+					std::reverse(chain.begin(), chain.end());
+				return chain;
+			};
+			chainT = orientedChain(chainT, br - bl);
+			chainR = orientedChain(chainR, tl - bl);
+			auto chainB = orientedChain(lineB.points(), br - bl), chainL = orientedChain(lineL.points(), tl - bl);
+
+			// count the b/w transitions just inside the symbol while walking along a clock edge
+			// chain in ~1 pixel steps. the sampling position is offset from the (white) chain
+			// points towards the opposite edge so it crosses the alternating modules.
+			auto clockDim = [&img](const std::vector<PointF>& chain, const std::vector<PointF>& opposite, int lo, int hi) {
+				int steps = std::max(2, int(distance(chain.front(), chain.back())));
+				int transitions = 0;
+				bool last = false;
+				for (int i = 0; i <= steps; ++i) {
+					auto f = double(i) / steps;
+					auto c = PointOnChain(chain, f);
+					auto p = c + 1.5f * normalized(PointOnChain(opposite, f) - c);
+					bool v = img.isIn(p) && img.get(p);
+					transitions += i && v != last;
+					last = v;
+				}
+				int dim = transitions + 1;
+				dim += dim & 1;
+				return lo <= dim && dim <= hi ? dim : 0;
+			};
+
+			int dimT2 = clockDim(chainT, chainB, 10, 144), dimR2 = clockDim(chainR, chainL, 8, 144);
+			if (dimT2 && dimR2) {
+				if (std::abs(dimT2 - dimR2) < 10)
+					dimT2 = dimR2 = std::max(dimT2, dimR2);
+
+				int nBands = std::clamp(dimT2 / 4, 2, 8);
+				ROIs rois;
+				for (int k = 0; k < nBands; ++k) {
+					int x0 = k * dimT2 / nBands, x1 = (k + 1) * dimT2 / nBands;
+					auto t0 = PointOnChain(chainT, double(x0) / dimT2), t1 = PointOnChain(chainT, double(x1) / dimT2);
+					auto b0 = PointOnChain(chainB, double(x0) / dimT2), b1 = PointOnChain(chainB, double(x1) / dimT2);
+					// shift the chain points (centers of white pixels outside the code) by half a
+					// pixel onto the edge between white and black, same as the corner treatment above
+					auto d0 = 0.5f * normalized(b0 - t0), d1 = 0.5f * normalized(b1 - t1);
+					rois.push_back({x0, x1, 0, dimR2,
+									PerspectiveTransform(Rectangle(x0, x1, 0, dimR2, 0.),
+														 {t0 + d0, t1 + d1, b1 - d1, b0 - d0})});
+				}
+				auto curved = SampleGrid(img, dimT2, dimR2, rois);
+				// compare defects per clock track module to stay meaningful across differing dimensions
+				if (curved.isValid() && (!res.isValid() || double(TimingDefects(curved.bits())) / (dimT2 + dimR2)
+															   < double(defects) / (dimT + dimR)))
+					res = std::move(curved);
+			}
+		}
+
 		CHECK(res.isValid());
 
 		return res;
@@ -878,6 +987,11 @@ static DetectorResults DetectNew(const BitMatrix& image, bool tryHarder, bool tr
 	// instantiate RegressionLine objects outside of Scan function to prevent repetitive std::vector allocations
 	std::array<DMRegressionLine, 4> lines;
 
+	// per-frame budget of trace iterations, shared between all start positions and directions. generous
+	// enough to not cut short any successful detection but bounds the tail of the run time distribution
+	// on cluttered images where lots of dead-end edge chains get traced. see EdgeTracer::traceBudget.
+	int traceBudget = std::max(100'000, image.width() * image.height() / 4);
+
 	constexpr int minSymbolSize = 8 * 2; // minimum realistic size in pixel: 8 modules x 2 pixels per module
 
 	for (auto dir : {PointF{-1, 0}, {1, 0}, {0, -1}, {0, 1}}) {
@@ -891,8 +1005,9 @@ static DetectorResults DetectNew(const BitMatrix& image, bool tryHarder, bool tr
 			tracer.p += i / 2 * minSymbolSize * (i & 1 ? -1 : 1) * tracer.right();
 			if (tryHarder)
 				tracer.history = &history;
+			tracer.traceBudget = &traceBudget;
 
-			if (!tracer.isIn())
+			if (!tracer.isIn() || tracer.budgetExhausted())
 				break;
 
 #ifdef __cpp_impl_coroutine
@@ -70,7 +70,7 @@ static const uint8_t LOG[] = {
 	214, 250, 168,  71, 201, 156,  64,  60, 237, 130, 111,  20,  93, 122, 177, 150,
 };
 
-static const uint8_t ALOG[] = {
+static constexpr uint8_t ALOG[] = {
 	  1,   2,   4,   8,  16,  32,  64, 128,  45,  90, 180,  69, 138,  57, 114, 228,
 	229, 231, 227, 235, 251, 219, 155,  27,  54, 108, 216, 157,  23,  46,  92, 184,
 	 93, 186,  89, 178,  73, 146,   9,  18,  36,  72, 144,  13,  26,  52, 104, 208,
@@ -89,12 +89,15 @@ static const uint8_t ALOG[] = {
 	  3,   6,  12,  24,  48,  96, 192, 173, 119, 238, 241, 207, 179,  75, 150,   1,
 };
 
-static uint8_t mult(uint8_t a, uint8_t b)
-{
-	if(a == 0 || b == 0)
-		return 0;
-	return ALOG[(LOG[a] + LOG[b]) % 255];
-}
+// ALOG doubled once at compile time, so that a product of two non-zero field elements is a single
+// lookup of the log sum without the modulo reduction. Note that LOG above maps 1 to 255 rather
+// than 0, so the sum of two logs ranges up to 510 inclusive.
+static constexpr auto ALOG2 = [] {
+	std::array<uint8_t, 511> res{};
+	for (int i = 0; i < 511; ++i)
+		res[i] = ALOG[i % 255];
+	return res;
+}();
 
 //TODO: replace this duplicated code with ReedSolomonEncoder
 static void CreateECCBlock(ByteArray& data, int codeOffset, int codeLength, int eccOffset, int eccLength, int stride)
@@ -106,12 +109,25 @@ static void CreateECCBlock(ByteArray& data, int codeOffset, int codeLength, int
 		throw std::invalid_argument("Illegal number of error correction codewords specified: " + std::to_string(eccLength));
 
 	auto& poly = *iter;
+	// All generator coefficients are non-zero, so their logs can be hoisted out of the division
+	// loop. The remaining per-word work is then one contiguous xor/lookup sweep without the zero
+	// tests and modulo reduction the former mult() helper performed per coefficient.
+	std::array<uint8_t, 68> logPoly;
+	for (int k = 0; k < eccLength; ++k)
+		logPoly[k] = LOG[poly[k]];
+
 	ByteArray ecc(eccLength);
 	for (int i = 0; i < codeLength; ++i) {
 		const auto m = ecc.back() ^ data[codeOffset + i * stride];
-		for (size_t k = ecc.size() - 1; k > 0; k--)
-			ecc[k] = ecc[k - 1] ^ mult(m, poly[k]);
-		ecc[0] = mult(m, poly[0]);
+		if (m) {
+			const int logM = LOG[m];
+			for (size_t k = ecc.size() - 1; k > 0; k--)
+				ecc[k] = ecc[k - 1] ^ ALOG2[logM + logPoly[k]];
+			ecc[0] = ALOG2[logM + logPoly[0]];
+		} else {
+			std::copy_backward(ecc.begin(), ecc.end() - 1, ecc.end());
+			ecc[0] = 0;
+		}
 	}
 	for (int i = 0; i < eccLength; ++i)
 		data[eccOffset + i * stride] = ecc[eccLength - 1 - i];
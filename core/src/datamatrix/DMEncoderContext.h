@@ -29,6 +29,7 @@ class EncoderContext
 	int _newEncoding = -1;
 	const SymbolInfo* _symbolInfo = nullptr;
 	int _skipAtEnd = 0;
+	std::pair<int, int> _x12ScanRange = {0, 0};
 
 public:
 	explicit EncoderContext(std::string&& msg) : _msg(std::move(msg)) { _codewords.reserve(_msg.length()); }
@@ -123,6 +124,12 @@ public:
 	const SymbolInfo* symbolInfo() const {
 		return _symbolInfo;
 	}
+
+	// Memo for the C40-vs-X12 tie-break scan in LookAheadTest: the characters in [first, second)
+	// are known to be native X12 without a terminator/separator, so re-scans can resume at second.
+	std::pair<int, int>& x12ScanRange() {
+		return _x12ScanRange;
+	}
 };
 
 } // namespace ZXing::DataMatrix
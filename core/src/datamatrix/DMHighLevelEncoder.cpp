@@ -92,6 +92,34 @@ static bool IsSpecialB256(int /*ch*/)
 	return false; //TODO NOT IMPLEMENTED YET!!!
 }
 
+// The per-character cost tallies of steps L to Q depend only on the character itself, so they are
+// precomputed once instead of being re-derived from the classification predicates at every position
+// of every look-ahead window. The float values are the same ones the steps used to add, keeping the
+// accumulated counts (and thereby all mode decisions) bit-identical.
+struct CharCosts
+{
+	float ascii, c40, text, x12, edifact, b256;
+	bool asciiCeil; // non-digits round the ASCII tally up before adding
+};
+
+static const std::array<CharCosts, 256>& InitCharCosts()
+{
+	static std::array<CharCosts, 256> costs = {};
+	for (int c = 0; c < 256; c++) {
+		auto& e = costs[c];
+		e.asciiCeil = !IsDigit(c);
+		e.ascii     = IsDigit(c)         ? 0.5f        : IsExtendedASCII(c) ? 2.0f         : 1.0f;
+		e.c40       = IsNativeC40(c)     ? 2.0f / 3.0f : IsExtendedASCII(c) ? 8.0f / 3.0f  : 4.0f / 3.0f;
+		e.text      = IsNativeText(c)    ? 2.0f / 3.0f : IsExtendedASCII(c) ? 8.0f / 3.0f  : 4.0f / 3.0f;
+		e.x12       = IsNativeX12(c)     ? 2.0f / 3.0f : IsExtendedASCII(c) ? 13.0f / 3.0f : 10.0f / 3.0f;
+		e.edifact   = IsNativeEDIFACT(c) ? 3.0f / 4.0f : IsExtendedASCII(c) ? 17.0f / 4.0f : 13.0f / 4.0f;
+		e.b256      = IsSpecialB256(c)   ? 4.0f        : 1.0f;
+	}
+	return costs;
+}
+
+static const std::array<CharCosts, 256>& CHAR_COSTS = InitCharCosts();
+
 
 /*
 * Converts the message to a byte array using the default encoding (cp437) as defined by the
@@ -130,7 +158,7 @@ static int FindMinimums(const std::array<int, 6>& intCharCounts, int min, std::a
 	return min;
 }
 
-static int LookAheadTest(const std::string& msg, size_t startpos, int currentMode)
+static int LookAheadTest(const std::string& msg, size_t startpos, int currentMode, std::pair<int, int>& x12ScanRange)
 {
 	if (startpos >= msg.length()) {
 		return currentMode;
@@ -178,70 +206,17 @@ static int LookAheadTest(const std::string& msg, size_t startpos, int currentMod
 		int c = (uint8_t)msg.at(startpos + charsProcessed);
 		charsProcessed++;
 
-		//step L
-		if (IsDigit(c)) {
-			charCounts[ASCII_ENCODATION] += 0.5f;
-		}
-		else if (IsExtendedASCII(c)) {
+		//steps L to Q, with the per-character tallies looked up instead of re-derived
+		const CharCosts& cost = CHAR_COSTS[c];
+		if (cost.asciiCeil) {
 			charCounts[ASCII_ENCODATION] = std::ceil(charCounts[ASCII_ENCODATION]);
-			charCounts[ASCII_ENCODATION] += 2.0f;
-		}
-		else {
-			charCounts[ASCII_ENCODATION] = std::ceil(charCounts[ASCII_ENCODATION]);
-			charCounts[ASCII_ENCODATION] += 1.0f;
-		}
-
-		//step M
-		if (IsNativeC40(c)) {
-			charCounts[C40_ENCODATION] += 2.0f / 3.0f;
-		}
-		else if (IsExtendedASCII(c)) {
-			charCounts[C40_ENCODATION] += 8.0f / 3.0f;
-		}
-		else {
-			charCounts[C40_ENCODATION] += 4.0f / 3.0f;
-		}
-
-		//step N
-		if (IsNativeText(c)) {
-			charCounts[TEXT_ENCODATION] += 2.0f / 3.0f;
-		}
-		else if (IsExtendedASCII(c)) {
-			charCounts[TEXT_ENCODATION] += 8.0f / 3.0f;
-		}
-		else {
-			charCounts[TEXT_ENCODATION] += 4.0f / 3.0f;
-		}
-
-		//step O
-		if (IsNativeX12(c)) {
-			charCounts[X12_ENCODATION] += 2.0f / 3.0f;
-		}
-		else if (IsExtendedASCII(c)) {
-			charCounts[X12_ENCODATION] += 13.0f / 3.0f;
-		}
-		else {
-			charCounts[X12_ENCODATION] += 10.0f / 3.0f;
-		}
-
-		//step P
-		if (IsNativeEDIFACT(c)) {
-			charCounts[EDIFACT_ENCODATION] += 3.0f / 4.0f;
-		}
-		else if (IsExtendedASCII(c)) {
-			charCounts[EDIFACT_ENCODATION] += 17.0f / 4.0f;
-		}
-		else {
-			charCounts[EDIFACT_ENCODATION] += 13.0f / 4.0f;
-		}
-
-		// step Q
-		if (IsSpecialB256(c)) {
-			charCounts[BASE256_ENCODATION] += 4.0f;
-		}
-		else {
-			charCounts[BASE256_ENCODATION] += 1.0f;
 		}
+		charCounts[ASCII_ENCODATION] += cost.ascii;
+		charCounts[C40_ENCODATION] += cost.c40;
+		charCounts[TEXT_ENCODATION] += cost.text;
+		charCounts[X12_ENCODATION] += cost.x12;
+		charCounts[EDIFACT_ENCODATION] += cost.edifact;
+		charCounts[BASE256_ENCODATION] += cost.b256;
 
 		//step R
 		if (charsProcessed >= 4) {
@@ -278,16 +253,24 @@ static int LookAheadTest(const std::string& msg, size_t startpos, int currentMod
 					return C40_ENCODATION;
 				}
 				if (intCharCounts[C40_ENCODATION] == intCharCounts[X12_ENCODATION]) {
+					// This tie-break used to rescan the same stretch of native X12 characters from
+					// every message position, going quadratic on long native payloads. The memo
+					// records the stretch already verified to contain neither a terminator/separator
+					// nor a non-native character, so repeated scans resume where the last one ended.
 					size_t p = startpos + charsProcessed + 1;
-					while (p < msg.length()) {
-						int tc = msg.at(p);
-						if (IsX12TermSep(tc)) {
-							return X12_ENCODATION;
-						}
-						if (!IsNativeX12(tc)) {
+					auto& [scanStart, scanEnd] = x12ScanRange;
+					size_t q = (p >= (size_t)scanStart && p <= (size_t)scanEnd) ? (size_t)scanEnd : p;
+					while (q < msg.length()) {
+						int tc = msg.at(q);
+						if (IsX12TermSep(tc) || !IsNativeX12(tc)) {
 							break;
 						}
-						p++;
+						q++;
+					}
+					scanStart = narrow_cast<int>(p);
+					scanEnd = narrow_cast<int>(q);
+					if (q < msg.length() && IsX12TermSep(msg.at(q))) {
+						return X12_ENCODATION;
 					}
 					return C40_ENCODATION;
 				}
@@ -339,7 +322,7 @@ namespace ASCIIEncoder {
 		}
 		else {
 			int c = context.currentChar();
-			int newMode = LookAheadTest(context.message(), context.currentPos(), ASCII_ENCODATION);
+			int newMode = LookAheadTest(context.message(), context.currentPos(), ASCII_ENCODATION, context.x12ScanRange());
 			if (newMode != ASCII_ENCODATION)
 			{
 				// the order here is the same as ENCODATION;
@@ -507,7 +490,7 @@ namespace C40Encoder {
 			}
 
 			if ((buffer.length() % 3) == 0) {
-				int newMode = LookAheadTest(context.message(), context.currentPos(), encodingMode);
+				int newMode = LookAheadTest(context.message(), context.currentPos(), encodingMode, context.x12ScanRange());
 				if (newMode != encodingMode) {
 					// Return to ASCII encodation, which will actually handle latch to new mode
 					context.setNewEncoding(ASCII_ENCODATION);
@@ -637,7 +620,7 @@ namespace X12Encoder {
 			if ((count % 3) == 0) {
 				C40Encoder::WriteNextTriplet(context, buffer);
 
-				int newMode = LookAheadTest(context.message(), context.currentPos(), X12_ENCODATION);
+				int newMode = LookAheadTest(context.message(), context.currentPos(), X12_ENCODATION, context.x12ScanRange());
 				if (newMode != X12_ENCODATION) {
 					// Return to ASCII encodation, which will actually handle latch to new mode
 					context.setNewEncoding(ASCII_ENCODATION);
@@ -771,7 +754,7 @@ namespace EdifactEncoder {
 				}
 				buffer.erase(0, 4);
 
-				int newMode = LookAheadTest(context.message(), context.currentPos(), EDIFACT_ENCODATION);
+				int newMode = LookAheadTest(context.message(), context.currentPos(), EDIFACT_ENCODATION, context.x12ScanRange());
 				if (newMode != EDIFACT_ENCODATION) {
 					// Return to ASCII encodation, which will actually handle latch to new mode
 					context.setNewEncoding(ASCII_ENCODATION);
@@ -809,7 +792,7 @@ namespace Base256Encoder {
 
 			context.setCurrentPos(context.currentPos() + 1);
 
-			int newMode = LookAheadTest(context.message(), context.currentPos(), BASE256_ENCODATION);
+			int newMode = LookAheadTest(context.message(), context.currentPos(), BASE256_ENCODATION, context.x12ScanRange());
 			if (newMode != BASE256_ENCODATION) {
 				// Return to ASCII encodation, which will actually handle latch to new mode
 				context.setNewEncoding(ASCII_ENCODATION);
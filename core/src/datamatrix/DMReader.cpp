@@ -7,15 +7,27 @@
 #include "DMReader.h"
 
 #include "BinaryBitmap.h"
+#include "BitMatrix.h"
 #include "DMDecoder.h"
 #include "DMDetector.h"
 #include "ReaderOptions.h"
 #include "DecoderResult.h"
 #include "DetectorResult.h"
 #include "Barcode.h"
+#include "ThreadPool.h"
+#include "ZXAlgorithms.h"
 
 #include <utility>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include "DecodeCache.h"
+#endif
+
+#if defined(ZXING_EXPERIMENTAL_API) && defined(__cpp_impl_coroutine)
+#include <atomic>
+#include <thread>
+#endif
+
 namespace ZXing::DataMatrix {
 
 Barcode Reader::decode(const BinaryBitmap& image) const
@@ -28,23 +40,115 @@ Barcode Reader::decode(const BinaryBitmap& image) const
 		return {};
 	
 	auto detectorResult = Detect(*binImg, _opts.tryHarder(), _opts.tryRotate(), _opts.isPure());
+	bool isInverted = false;
+	if (!detectorResult.isValid() && _opts.tryInvert() && !image.inverted()) {
+		auto inverted = binImg->copy();
+		inverted.flipAll();
+		detectorResult = Detect(inverted, _opts.tryHarder(), _opts.tryRotate(), _opts.isPure());
+		isInverted = detectorResult.isValid();
+	}
 	if (!detectorResult.isValid())
 		return {};
 
-	return Barcode(Decode(detectorResult.bits()), std::move(detectorResult), BarcodeFormat::DataMatrix);
+#ifdef ZXING_EXPERIMENTAL_API
+	auto decoderResult = DecodeCache::FindOrDecode(image.decodeCache(), BarcodeFormat::DataMatrix, detectorResult.bits(),
+												   [&] { return Decode(detectorResult.bits()); });
+#else
+	auto decoderResult = Decode(detectorResult.bits());
+#endif
+	return Barcode(std::move(decoderResult).setIsInverted(isInverted), std::move(detectorResult),
+				   BarcodeFormat::DataMatrix);
 #endif
 }
 
 #ifdef __cpp_impl_coroutine
+
+#ifdef ZXING_EXPERIMENTAL_API
+/**
+* Partition the frame into a 2x2 grid of overlapping tiles that are detected and decoded by worker
+* threads. This targets the readMultiple use case of many small symbols spread over a large frame
+* (parts trays, totes). Each tile extends half a tile width/height into its neighbors, so every
+* symbol up to a quarter of the frame size is fully contained in at least one tile; symbols found
+* in more than one tile are deduplicated by position. The caller falls back to the serial full
+* frame scan when this finds nothing (e.g. one big, frame-filling symbol).
+*/
+static Barcodes DetectTiled(const BitMatrix& image, const ReaderOptions& opts, int maxSymbols, DecodeCache* cache)
+{
+	constexpr int nx = 2, ny = 2;
+	const int tileW = image.width() / nx + image.width() / (2 * nx);
+	const int tileH = image.height() / ny + image.height() / (2 * ny);
+
+	std::array<Barcodes, nx * ny> tileRes;
+	std::atomic<int> nextTile = 0;
+	auto worker = [&]() {
+		for (int i = nextTile++; i < nx * ny; i = nextTile++) {
+			const int x0 = std::min(i % nx * (image.width() / nx), image.width() - tileW);
+			const int y0 = std::min(i / nx * (image.height() / ny), image.height() - tileH);
+			BitMatrix tile(tileW, tileH);
+			for (int y = 0; y < tileH; ++y)
+				std::copy_n(image.row(y0 + y).begin() + x0, tileW, tile.row(y).begin());
+			for (auto&& detRes : Detect(tile, opts.tryHarder(), opts.tryRotate(), false)) {
+				auto decRes = DecodeCache::FindOrDecode(cache, BarcodeFormat::DataMatrix, detRes.bits(),
+														[&] { return Decode(detRes.bits()); });
+				if (decRes.isValid(opts.returnErrors())) {
+					auto& res = tileRes[i].emplace_back(std::move(decRes), std::move(detRes), BarcodeFormat::DataMatrix);
+					auto pos = res.position();
+					for (auto& p : pos)
+						p = p + PointI(x0, y0);
+					res.setPosition(pos);
+					if (maxSymbols > 0 && Size(tileRes[i]) >= maxSymbols)
+						break;
+				}
+			}
+		}
+	};
+
+	int nThreads = std::clamp(int(opts.maxNumberOfThreads() ? opts.maxNumberOfThreads() : std::thread::hardware_concurrency()),
+							  1, nx * ny);
+	RunParallel(nThreads, worker, opts.threadPriority());
+
+	// merge in tile order for deterministic results, dropping symbols found in more than one tile
+	Barcodes res;
+	for (auto& tile : tileRes)
+		for (auto& barcode : tile) {
+			auto isSame = [p = barcode.position()[0]](const Barcode& o) { return distance(p, o.position()[0]) < 8; };
+			if (FindIf(res, isSame) == res.end() && !(maxSymbols > 0 && Size(res) >= maxSymbols))
+				res.push_back(std::move(barcode));
+		}
+
+	return res;
+}
+#endif // ZXING_EXPERIMENTAL_API
+
 Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 {
 	auto binImg = image.getBitMatrix();
 	if (binImg == nullptr)
 		return {};
 
+#ifdef ZXING_EXPERIMENTAL_API
+	int maxThreads = _opts.maxNumberOfThreads();
+	// Skip the decode of any symbol whose sampled module grid is bit-identical to one successfully
+	// decoded in a previous frame of the same scan state, see DecodeCache.h.
+	auto cachedDecode = [cache = image.decodeCache()](const BitMatrix& bits, int nThreads) {
+		return DecodeCache::FindOrDecode(cache, BarcodeFormat::DataMatrix, bits, [&] { return Decode(bits, nThreads); });
+	};
+#else
+	int maxThreads = 1;
+	auto cachedDecode = [](const BitMatrix& bits, int nThreads) { return Decode(bits, nThreads); };
+#endif
+
+#ifdef ZXING_EXPERIMENTAL_API
+	if (maxSymbols != 1 && _opts.maxNumberOfThreads() != 1 && !_opts.isPure()
+		&& std::min(binImg->width(), binImg->height()) >= 256) {
+		if (auto res = DetectTiled(*binImg, _opts, maxSymbols, image.decodeCache()); !res.empty())
+			return res;
+	}
+#endif
+
 	Barcodes res;
 	for (auto&& detRes : Detect(*binImg, _opts.tryHarder(), _opts.tryRotate(), _opts.isPure())) {
-		auto decRes = Decode(detRes.bits());
+		auto decRes = cachedDecode(detRes.bits(), maxThreads);
 		if (decRes.isValid(_opts.returnErrors())) {
 			res.emplace_back(std::move(decRes), std::move(detRes), BarcodeFormat::DataMatrix);
 			if (maxSymbols > 0 && Size(res) >= maxSymbols)
@@ -52,6 +156,24 @@ Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 		}
 	}
 
+	// Speculative dual-polarity pass: laser-etched (DPM) marks are about as often light-on-dark as
+	// dark-on-light. The edge tracer only finds the L-finder of the polarity it was written for, but
+	// flipping the already binarized image is nearly free, so look for inverted symbols right away
+	// instead of leaving them to the tryInvert round of the surrounding pipeline, which re-runs the
+	// entire cascade.
+	if (res.empty() && _opts.tryInvert() && !image.inverted()) {
+		auto inverted = binImg->copy();
+		inverted.flipAll();
+		for (auto&& detRes : Detect(inverted, _opts.tryHarder(), _opts.tryRotate(), _opts.isPure())) {
+			auto decRes = cachedDecode(detRes.bits(), maxThreads).setIsInverted(true);
+			if (decRes.isValid(_opts.returnErrors())) {
+				res.emplace_back(std::move(decRes), std::move(detRes), BarcodeFormat::DataMatrix);
+				if (maxSymbols > 0 && Size(res) >= maxSymbols)
+					break;
+			}
+		}
+	}
+
 	return res;
 }
 #endif
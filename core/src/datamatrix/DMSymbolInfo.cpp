@@ -9,7 +9,10 @@
 #include "ZXAlgorithms.h"
 #include "ZXTestSupport.h"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 
 namespace ZXing::DataMatrix {
@@ -92,6 +95,28 @@ SymbolInfo::Lookup(int dataCodewords, bool allowRectangular)
 const SymbolInfo *
 SymbolInfo::Lookup(int dataCodewords, SymbolShape shape, int minWidth, int minHeight, int maxWidth, int maxHeight)
 {
+	// The common lookup selects by payload size alone against the production symbol set, once per
+	// encoded symbol. The data capacities in PROD_SYMBOLS are non-decreasing in table order (also
+	// within each shape), so the first fitting symbol can be found by a binary search in a
+	// compile-time per-shape index instead of the linear filter scan below.
+	if (minWidth < 0 && minHeight < 0 && maxWidth < 0 && maxHeight < 0 && s_symbols == PROD_SYMBOLS) {
+		static constexpr auto INDEX = [] {
+			// one row per SymbolShape, each holding the number of entries followed by the indices
+			std::array<std::array<uint8_t, Size(PROD_SYMBOLS) + 1>, 3> res{};
+			for (uint8_t i = 0; i < Size(PROD_SYMBOLS); ++i)
+				for (auto s : {SymbolShape::NONE, PROD_SYMBOLS[i]._rectangular ? SymbolShape::RECTANGLE : SymbolShape::SQUARE}) {
+					auto& row = res[static_cast<int>(s)];
+					row[++row[0]] = i;
+				}
+			return res;
+		}();
+		auto& row = INDEX[static_cast<int>(shape)];
+		auto begin = row.begin() + 1, end = begin + row[0];
+		auto it = std::lower_bound(begin, end, dataCodewords,
+								   [](uint8_t i, int size) { return PROD_SYMBOLS[i]._dataCapacity < size; });
+		return it != end ? &PROD_SYMBOLS[*it] : nullptr;
+	}
+
 	for (size_t i = 0; i < s_symbolCount; ++i) {
 		auto& symbol = s_symbols[i];
 		if (shape == SymbolShape::SQUARE && symbol._rectangular) {
@@ -14,6 +14,8 @@
 #include "MCDecoder.h"
 #include "Barcode.h"
 
+#include <array>
+
 namespace ZXing::MaxiCode {
 
 /**
@@ -28,13 +30,20 @@ static BitMatrix ExtractPureBits(const BitMatrix& image)
 	if (!image.findBoundingBox(left, top, width, height, BitMatrixParser::MATRIX_WIDTH))
 		return {};
 
+	// The sample x-coordinate depends only on the column and the row parity (odd rows of the hex
+	// grid are shifted by half a module), so the per-module divisions are hoisted into two
+	// per-decode coordinate tables.
+	std::array<std::array<int, BitMatrixParser::MATRIX_WIDTH>, 2> ixLUT;
+	for (int parity = 0; parity < 2; parity++)
+		for (int x = 0; x < BitMatrixParser::MATRIX_WIDTH; x++)
+			ixLUT[parity][x] = left + (x * width + width / 2 + parity * width / 2) / BitMatrixParser::MATRIX_WIDTH;
+
 	// Now just read off the bits
 	BitMatrix result(BitMatrixParser::MATRIX_WIDTH, BitMatrixParser::MATRIX_HEIGHT);
 	for (int y = 0; y < BitMatrixParser::MATRIX_HEIGHT; y++) {
 		int iy = top + (y * height + height / 2) / BitMatrixParser::MATRIX_HEIGHT;
 		for (int x = 0; x < BitMatrixParser::MATRIX_WIDTH; x++) {
-			int ix = left + (x * width + width / 2 + (y & 0x01) *  width / 2) / BitMatrixParser::MATRIX_WIDTH;
-			if (image.get(ix, iy)) {
+			if (image.get(ixLUT[y & 0x01][x], iy)) {
 				result.set(x, y);
 			}
 		}
@@ -11,8 +11,10 @@
 #include "Barcode.h"
 #include "ZXAlgorithms.h"
 
-#include <string>
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <string>
 
 namespace ZXing::OneD {
 
@@ -27,6 +29,20 @@ static constexpr int CHARACTER_ENCODINGS[] = {
 
 static_assert(Size(ALPHABET) == Size(CHARACTER_ENCODINGS), "table size mismatch");
 
+// direct decode table indexed by the 7 bit wide/narrow classification, 0 for invalid patterns: one
+// lookup instead of a search through CHARACTER_ENCODINGS per character
+static constexpr auto CHARACTER_TABLE = [] {
+	std::array<char, 128> res = {};
+	for (int i = 0; i < Size(CHARACTER_ENCODINGS); ++i)
+		res[CHARACTER_ENCODINGS[i]] = ALPHABET[i];
+	return res;
+}();
+
+static bool IsStartOrStopSymbol(char c)
+{
+	return 'A' <= c && c <= 'D';
+}
+
 // some industries use a checksum standard but this is not part of the original codabar standard
 // for more information see : http://www.mecsw.com/specs/codabar.html
 
@@ -41,8 +57,21 @@ constexpr float QUIET_ZONE_SCALE = 0.5f;
 
 bool IsLeftGuard(const PatternView& view, int spaceInPixel)
 {
-	return spaceInPixel > view.sum() * QUIET_ZONE_SCALE &&
-		   Contains({0x1A, 0x29, 0x0B, 0x0E}, RowReader::NarrowWideBitPattern(view));
+	if (spaceInPixel <= view.sum() * QUIET_ZONE_SCALE)
+		return false;
+
+	// All four start/stop characters have exactly 2 wide spaces out of 3. Reject candidate positions
+	// on that cheap structural property first, so the narrow/wide threshold (a min/max pass over all
+	// 7 runs) is only computed where the spaces alone already look like a start character. A space
+	// only classifies as wide if it exceeds 3/2 times the narrowest one, so this rejects no position
+	// the full classification would have accepted.
+	int s1 = view[1], s2 = view[3], s3 = view[5];
+	int minSpace = std::min({s1, s2, s3}), midSpace = s1 + s2 + s3 - minSpace - std::max({s1, s2, s3});
+	if (2 * midSpace < 3 * minSpace)
+		return false;
+
+	int pattern = RowReader::NarrowWideBitPattern(view);
+	return pattern > 0 && IsStartOrStopSymbol(CHARACTER_TABLE[pattern]);
 }
 
 Barcode CodabarReader::decodePattern(int rowNumber, PatternView& next, std::unique_ptr<DecodingState>&) const
@@ -51,7 +80,10 @@ Barcode CodabarReader::decodePattern(int rowNumber, PatternView& next, std::uniq
 	// absolute minimum would be 2 (meaning 0 'content'). everything below 4 produces too many false
 	// positives.
 	const int minCharCount = 4;
-	auto isStartOrStopSymbol = [](char c) { return 'A' <= c && c <= 'D'; };
+	auto decodeChar = [](const PatternView& view) {
+		int pattern = NarrowWideBitPattern(view);
+		return pattern == -1 ? char(0) : CHARACTER_TABLE[pattern];
+	};
 
 	next = FindLeftGuard<CHAR_LEN>(next, minCharCount * CHAR_LEN, IsLeftGuard);
 	if (!next.isValid())
@@ -62,9 +94,9 @@ Barcode CodabarReader::decodePattern(int rowNumber, PatternView& next, std::uniq
 
 	std::string txt;
 	txt.reserve(20);
-	txt += DecodeNarrowWidePattern(next, CHARACTER_ENCODINGS, ALPHABET); // read off the start pattern
+	txt += decodeChar(next); // read off the start pattern
 
-	if (!isStartOrStopSymbol(txt.back()))
+	if (!IsStartOrStopSymbol(txt.back()))
 		return {};
 
 	do {
@@ -72,10 +104,10 @@ Barcode CodabarReader::decodePattern(int rowNumber, PatternView& next, std::uniq
 		if (!next.skipSymbol() || !next.skipSingle(maxInterCharacterSpace))
 			return {};
 
-		txt += DecodeNarrowWidePattern(next, CHARACTER_ENCODINGS, ALPHABET);
+		txt += decodeChar(next);
 		if (txt.back() == 0)
 			return {};
-	} while (!isStartOrStopSymbol(txt.back()));
+	} while (!IsStartOrStopSymbol(txt.back()));
 
 	// next now points to the last decoded symbol
 	// check txt length and whitespace after the last char. See also FindStartPattern.
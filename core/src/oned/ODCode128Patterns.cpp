@@ -8,7 +8,8 @@
 
 namespace ZXing::OneD::Code128 {
 
-const std::array<std::array<int, 6>, 107> CODE_PATTERNS = { {
+// constexpr (re-)declaration to guarantee constant initialization into read-only data
+constexpr std::array<std::array<int, 6>, 107> CODE_PATTERNS = { {
 	{ 2, 1, 2, 2, 2, 2 }, // 0
 	{ 2, 2, 2, 1, 2, 2 },
 	{ 2, 2, 2, 2, 2, 1 },
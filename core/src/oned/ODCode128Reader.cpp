@@ -161,26 +161,42 @@ constexpr float QUIET_ZONE = 5;	// quiet zone spec is 10 modules, real world exa
 constexpr int CHAR_MODS = 11;
 
 //TODO: make this a constexpr variable initialization
-static auto E2E_PATTERNS = [] {
-	// This creates an array of ints for fast IndexOf lookup of the edge-2-edge patterns (ISO/IEC 15417:2007(E) Table 2)
-	// e.g. a code pattern of { 2, 1, 2, 2, 2, 2 } becomes the e2e pattern { 3, 3, 4, 4 } and the value 0b11100011110000.
-	std::array<int, 107> res;
-	for (int i = 0; i < Size(res); ++i) {
+static auto E2E_CODES = [] {
+	// This creates a direct lookup table for the edge-2-edge patterns (ISO/IEC 15417:2007(E) Table 2).
+	// Each of the 4 e2e distances of a code pattern is between 2 and 8 modules, so it fits into 3 bits
+	// after subtracting 2 and the whole pattern into a 12 bit key, e.g. a code pattern of
+	// { 2, 1, 2, 2, 2, 2 } becomes the e2e pattern { 3, 3, 4, 4 } and the key 0b001'001'010'010.
+	// This replaces a linear search over all 107 patterns with a single load.
+	std::array<int8_t, 1 << 12> res;
+	res.fill(-1);
+	for (int i = 0; i < Size(Code128::CODE_PATTERNS); ++i) {
 		const auto& a = Code128::CODE_PATTERNS[i];
-		std::array<int, 4> e2e;
+		int key = 0;
 		for (int j = 0; j < 4; j++)
-			e2e[j] = a[j] + a[j + 1];
-		res[i] = ToInt(e2e);
+			key = key << 3 | (a[j] + a[j + 1] - 2);
+		if (res[key] == -1) // keep the first match like the IndexOf based lookup did
+			res[key] = narrow_cast<int8_t>(i);
 	}
 	return res;
 }();
 
+static int LookupE2ECode(const PatternView& view)
+{
+	int key = 0;
+	for (int v : NormalizedE2EPattern<CHAR_LEN>(view, CHAR_MODS)) {
+		if (v < 2 || v > 8)
+			return -1;
+		key = key << 3 | (v - 2);
+	}
+	return E2E_CODES[key];
+}
+
 Barcode Code128Reader::decodePattern(int rowNumber, PatternView& next, std::unique_ptr<DecodingState>&) const
 {
 	int minCharCount = 4; // start + payload + checksum + stop
 	auto decodePattern = [](const PatternView& view, bool start = false) {
 		// This is basically the reference algorithm from the specification
-		int code = IndexOf(E2E_PATTERNS, ToInt(NormalizedE2EPattern<CHAR_LEN>(view, CHAR_MODS)));
+		int code = LookupE2ECode(view);
 		if (code == -1 && !start) // if the reference algo fails, give the original upstream version a try (required to decode a few samples)
 			code = DecodeDigit(view, Code128::CODE_PATTERNS, MAX_AVG_VARIANCE, MAX_INDIVIDUAL_VARIANCE);
 		return code;
@@ -10,8 +10,7 @@
 #include "ODWriterHelper.h"
 #include "Utf.h"
 
-#include <list>
-#include <numeric>
+#include <array>
 #include <stdexcept>
 #include <vector>
 
@@ -23,6 +22,7 @@ static const int CODE_START_C = 105;
 static const int CODE_CODE_A  = 101;
 static const int CODE_CODE_B  = 100;
 static const int CODE_CODE_C  = 99;
+static const int CODE_SHIFT   = 98;
 static const int CODE_STOP    = 106;
 
 // Dummy characters used to specify control characters in input
@@ -37,100 +37,35 @@ static const int CODE_FNC_3   = 96;  // Code A, Code B
 static const int CODE_FNC_4_A = 101; // Code A
 static const int CODE_FNC_4_B = 100; // Code B
 
-// Results of minimal lookahead for code C
-enum class CType
+// Internal code set indices of the codeword minimization below
+enum CodeSet { A = 0, B = 1, C = 2 };
+
+static bool CodableInA(wchar_t c)
 {
-	UNCODABLE,
-	ONE_DIGIT,
-	TWO_DIGITS,
-	FNC_1
-};
+	return c < '`' || (c >= ESCAPE_FNC_1 && c <= ESCAPE_FNC_4); // ASCII 0 to 95 or FNC1 to FNC4
+}
 
-static CType FindCType(const std::wstring& value, int start)
+static bool CodableInB(wchar_t c)
 {
-	int last = Size(value);
-	if (start >= last) {
-		return CType::UNCODABLE;
-	}
-	wchar_t c = value[start];
-	if (c == ESCAPE_FNC_1) {
-		return CType::FNC_1;
-	}
-	if (c < '0' || c > '9') {
-		return CType::UNCODABLE;
-	}
-	if (start + 1 >= last) {
-		return CType::ONE_DIGIT;
-	}
-	c = value[start + 1];
-	if (c < '0' || c > '9') {
-		return CType::ONE_DIGIT;
-	}
-	return CType::TWO_DIGITS;
+	return (c >= ' ' && c <= 127) || (c >= ESCAPE_FNC_1 && c <= ESCAPE_FNC_4); // ASCII 32 to 127 or FNC1 to FNC4
 }
 
-static int ChooseCode(const std::wstring& value, int start, int oldCode)
+static bool IsDigit(wchar_t c)
 {
-	CType lookahead = FindCType(value, start);
-	if (lookahead == CType::ONE_DIGIT) {
-		if (oldCode == CODE_CODE_A) {
-			return CODE_CODE_A;
-		}
-		return CODE_CODE_B;
-	}
-	if (lookahead == CType::UNCODABLE) {
-		if (start < Size(value)) {
-			int c = value[start];
-			if (c < ' ' || (oldCode == CODE_CODE_A && (c < '`' || (c >= ESCAPE_FNC_1 && c <= ESCAPE_FNC_4)))) {
-				// can continue in code A, encodes ASCII 0 to 95 or FNC1 to FNC4
-				return CODE_CODE_A;
-			}
-		}
-		return CODE_CODE_B; // no choice
-	}
-	if (oldCode == CODE_CODE_A && lookahead == CType::FNC_1) {
-		return CODE_CODE_A;
-	}
-	if (oldCode == CODE_CODE_C) { // can continue in code C
-		return CODE_CODE_C;
-	}
-	if (oldCode == CODE_CODE_B) {
-		if (lookahead == CType::FNC_1) {
-			return CODE_CODE_B; // can continue in code B
-		}
-		// Seen two consecutive digits, see what follows
-		lookahead = FindCType(value, start + 2);
-		if (lookahead == CType::UNCODABLE || lookahead == CType::ONE_DIGIT) {
-			return CODE_CODE_B; // not worth switching now
-		}
-		if (lookahead == CType::FNC_1) { // two digits, then FNC_1...
-			lookahead = FindCType(value, start + 3);
-			if (lookahead == CType::TWO_DIGITS) { // then two more digits, switch
-				return CODE_CODE_C;
-			}
-			else {
-				return CODE_CODE_B; // otherwise not worth switching
-			}
-		}
-		// At this point, there are at least 4 consecutive digits.
-		// Look ahead to choose whether to switch now or on the next round.
-		int index = start + 4;
-		while ((lookahead = FindCType(value, index)) == CType::TWO_DIGITS) {
-			index += 2;
-		}
-		if (lookahead == CType::ONE_DIGIT) { // odd number of digits, switch later
-			return CODE_CODE_B;
-		}
-		return CODE_CODE_C; // even number of digits, switch now
-	}
-	// Here oldCode == 0, which means we are choosing the initial code
-	if (lookahead == CType::FNC_1) { // ignore FNC_1
-		lookahead = FindCType(value, start + 1);
-	}
-	if (lookahead == CType::TWO_DIGITS) { // at least two digits, start in code C
-		return CODE_CODE_C;
+	return c >= '0' && c <= '9';
+}
+
+static int PatternIndex(wchar_t c, int codeSet)
+{
+	switch (c) {
+	case ESCAPE_FNC_1: return CODE_FNC_1;
+	case ESCAPE_FNC_2: return CODE_FNC_2;
+	case ESCAPE_FNC_3: return CODE_FNC_3;
+	case ESCAPE_FNC_4: return codeSet == A ? CODE_FNC_4_A : CODE_FNC_4_B;
+	default:
+		// everything below a space character comes behind the underscore in the code patterns table
+		return c < ' ' ? c - ' ' + '`' : c - ' ';
 	}
-	return CODE_CODE_B;
 }
 
 BitMatrix
@@ -158,94 +93,100 @@ Code128Writer::encode(const std::wstring& contents, int width, int height) const
 		}
 	}
 
-	std::list<std::array<int, 6>> patterns; // temporary storage for patterns
-	int checkSum = 0;
-	int checkWeight = 1;
-	int codeSet = 0; // selected code (CODE_CODE_B or CODE_CODE_C)
-	int position = 0; // position in contents
-
-	while (position < length) {
-		//Select code to use
-		int newCodeSet = ChooseCode(contents, position, codeSet);
+	// Minimize the number of codewords with the standard dynamic program over the code set choice:
+	// cost[i][cs] is the minimal number of codewords for the suffix starting at character i while
+	// latched into code set cs. A transition either encodes the next character (or digit pair in
+	// code set C) directly, latches into another code set first, or encodes one character from the
+	// other of the code sets A/B behind a SHIFT.
+	constexpr int INF = 1 << 20;
+	std::vector<std::array<int, 3>> cost(length + 1, {0, 0, 0});
+
+	// encode contents[i] (or a digit pair) in code set cs and continue latched into cs
+	auto directCost = [&](int i, int cs) {
+		wchar_t c = contents[i];
+		switch (cs) {
+		case A: return CodableInA(c) ? 1 + cost[i + 1][A] : INF;
+		case B: return CodableInB(c) ? 1 + cost[i + 1][B] : INF;
+		default:
+			if (c == ESCAPE_FNC_1)
+				return 1 + cost[i + 1][C];
+			return IsDigit(c) && i + 1 < length && IsDigit(contents[i + 1]) ? 1 + cost[i + 2][C] : INF;
+		}
+	};
+
+	for (int i = length - 1; i >= 0; --i)
+		for (int cs : {A, B, C}) {
+			int best = directCost(i, cs);
+			for (int ns : {A, B, C}) // latch into another code set, then encode there
+				if (ns != cs)
+					best = std::min(best, 1 + directCost(i, ns));
+			if (cs == A && CodableInB(contents[i])) // single character shift into code set B
+				best = std::min(best, 2 + cost[i + 1][A]);
+			if (cs == B && CodableInA(contents[i])) // single character shift into code set A
+				best = std::min(best, 2 + cost[i + 1][B]);
+			cost[i][cs] = best;
+		}
 
-		//Get the pattern index
-		int patternIndex;
-		if (newCodeSet == codeSet) {
-			// Encode the current character
-			// First handle escapes
-			switch (contents[position]) {
-			case ESCAPE_FNC_1: patternIndex = CODE_FNC_1; break;
-			case ESCAPE_FNC_2: patternIndex = CODE_FNC_2; break;
-			case ESCAPE_FNC_3: patternIndex = CODE_FNC_3; break;
-			case ESCAPE_FNC_4: patternIndex = (codeSet == CODE_CODE_A) ? CODE_FNC_4_A : CODE_FNC_4_B; break;
-			default:
-				// Then handle normal characters otherwise
-				if (codeSet == CODE_CODE_A) {
-					patternIndex = contents[position] - ' ';
-					if (patternIndex < 0) {
-						// everything below a space character comes behind the underscore in the code patterns table
-						patternIndex += '`';
-					}
-				} else if (codeSet == CODE_CODE_B) {
-					patternIndex = contents[position] - ' ';
-				} else { // CODE_CODE_C
-					patternIndex =
-						(contents[position] - '0') * 10 + (position + 1 < length ? contents[position + 1] - '0' : 0);
-					position++; // Also incremented below
-				}
+	std::vector<int> codes; // the codeword stream: start code, data, code set latches and shifts
+	codes.reserve(length + 3);
+
+	// On a tie, prefer starting in code set C like the traditional GS1-128 layout and otherwise
+	// mirror the previous heuristic: code set A only for contents starting with a control character.
+	int codeSet;
+	if (cost[0][C] <= std::min(cost[0][A], cost[0][B]))
+		codeSet = C;
+	else if (contents[0] < ' ' ? cost[0][A] <= cost[0][B] : cost[0][A] < cost[0][B])
+		codeSet = A;
+	else
+		codeSet = B;
+	codes.push_back(std::array{CODE_START_A, CODE_START_B, CODE_START_C}[codeSet]);
+
+	for (int position = 0; position < length;) {
+		// append contents[position] (or a digit pair) encoded in code set cs
+		auto emit = [&](int cs) {
+			if (cs == C && contents[position] != ESCAPE_FNC_1) {
+				codes.push_back((contents[position] - '0') * 10 + (contents[position + 1] - '0'));
+				position += 2;
+			} else {
+				codes.push_back(PatternIndex(contents[position], cs));
+				position += 1;
 			}
-			position++;
+		};
+		// Walk the cheapest path, trying the transitions in a fixed order to keep ties stable:
+		// continue in the current code set, latch (preferring B like the previous heuristic), shift.
+		if (cost[position][codeSet] == directCost(position, codeSet)) {
+			emit(codeSet);
+			continue;
 		}
-		else {
-			// Should we change the current code?
-			// Do we have a code set?
-			if (codeSet == 0) {
-				// No, we don't have a code set
-				if (newCodeSet == CODE_CODE_A) {
-					patternIndex = CODE_START_A;
-				}
-				else if (newCodeSet == CODE_CODE_B) {
-					patternIndex = CODE_START_B;
-				}
-				else {
-					// CODE_CODE_C
-					patternIndex = CODE_START_C;
-				}
+		bool latched = false;
+		for (int ns : {B, A, C})
+			if (ns != codeSet && cost[position][codeSet] == 1 + directCost(position, ns)) {
+				codes.push_back(std::array{CODE_CODE_A, CODE_CODE_B, CODE_CODE_C}[ns]);
+				codeSet = ns;
+				emit(ns);
+				latched = true;
+				break;
 			}
-			else {
-				// Yes, we have a code set
-				patternIndex = newCodeSet;
-			}
-			codeSet = newCodeSet;
-		}
-
-		// Get the pattern
-		patterns.push_back(Code128::CODE_PATTERNS[patternIndex]);
-
-		// Compute checksum
-		checkSum += patternIndex * checkWeight;
-		if (position != 0) {
-			checkWeight++;
+		if (!latched) {
+			codes.push_back(CODE_SHIFT);
+			emit(codeSet == A ? B : A);
 		}
 	}
 
-	// Compute and append checksum
-	checkSum %= 103;
-	patterns.push_back(Code128::CODE_PATTERNS[checkSum]);
+	// Compute and append the checksum codeword, the start code has weight 1, the others their position
+	int checkSum = codes.front();
+	for (int k = 1; k < Size(codes); ++k)
+		checkSum += k * codes[k];
+	codes.push_back(checkSum % 103);
 
 	// Append stop code
-	patterns.push_back(Code128::CODE_PATTERNS[CODE_STOP]);
-
-	// Compute code width
-	int codeWidth = 2; // termination bar
-	for (const auto& pattern : patterns) {
-		codeWidth += Reduce(pattern);
-	}
+	codes.push_back(CODE_STOP);
 
-	// Compute result
-	std::vector<bool> result(codeWidth, false);
-	const auto op = [&result](auto pos, const auto& pattern){ return pos + WriterHelper::AppendPattern(result, pos, pattern, true);};
-	auto pos = std::accumulate(std::begin(patterns), std::end(patterns), int{}, op);
+	// Render the patterns into the result sized up front: 11 modules per codeword plus the termination bar
+	std::vector<bool> result(Size(codes) * 11 + 2, false);
+	int pos = 0;
+	for (int code : codes)
+		pos += WriterHelper::AppendPattern(result, pos, Code128::CODE_PATTERNS[code], true);
 	// Append termination bar
 	result[pos++] = true;
 	result[pos++] = true;
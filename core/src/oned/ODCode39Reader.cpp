@@ -33,6 +33,23 @@ static constexpr std::array CHARACTER_ENCODINGS = {
 
 static_assert(Size(ALPHABET) == Size(CHARACTER_ENCODINGS), "table size mismatch");
 
+// direct decode table indexed by the 9 bit wide/narrow classification, 0 for invalid patterns: one
+// lookup instead of a search through CHARACTER_ENCODINGS per character
+static constexpr auto CHARACTER_TABLE = [] {
+	std::array<char, 512> res = {};
+	for (int i = 0; i < Size(CHARACTER_ENCODINGS); ++i)
+		res[CHARACTER_ENCODINGS[i]] = ALPHABET[i];
+	return res;
+}();
+
+// checksum value (index in ALPHABET) per character, see TransformReduce below
+static constexpr auto CHARACTER_VALUES = [] {
+	std::array<uint8_t, 128> res = {};
+	for (int i = 0; i < Size(ALPHABET); ++i)
+		res[ALPHABET[i]] = static_cast<uint8_t>(i);
+	return res;
+}();
+
 static constexpr std::array<char, 26> PERCENTAGE_MAPPING = {
 	'A' - 38, 'B' - 38, 'C' - 38, 'D' - 38, 'E' - 38,	// %A to %E map to control codes ESC to USep
 	'F' - 11, 'G' - 11, 'H' - 11, 'I' - 11, 'J' - 11,	// %F to %J map to ; < = > ?
@@ -47,28 +64,42 @@ using CounterContainer = std::array<int, 9>;
 // each character has 5 bars and 4 spaces
 constexpr int CHAR_LEN = 9;
 
-/** Decode the full ASCII string. Return empty string if FormatError occurred.
- * ctrl is either "$%/+" for code39 or "abcd" for code93. */
-std::string DecodeCode39AndCode93FullASCII(std::string encoded, const char ctrl[4])
+/** Decode the full ASCII string in a single in-place pass. Return empty string if FormatError occurred.
+ * ctrl is either "$%/+" for code39 or "abcd" for code93. usedCtrl (optional) reports whether any
+ * shift character was consumed, i.e. whether the result differs from the input. */
+std::string DecodeCode39AndCode93FullASCII(std::string encoded, const char ctrl[4], bool* usedCtrl = nullptr)
 {
+	if (usedCtrl)
+		*usedCtrl = false;
+
 	auto out = encoded.begin();
-	for (auto in = encoded.cbegin(); in != encoded.cend(); ++in) {
-		char c = *in;
-		if (Contains(ctrl, c)) {
-			char next = *++in; // if in is one short of cend(), then next == 0
-			if (next < 'A' || next > 'Z')
+	int shift = -1; // pending shift character (index into ctrl), the single piece of state machine state
+	for (char c : encoded) {
+		if (shift == -1) {
+			int i = c == ctrl[0] ? 0 : c == ctrl[1] ? 1 : c == ctrl[2] ? 2 : c == ctrl[3] ? 3 : -1;
+			if (i == -1) {
+				*out++ = c;
+			} else {
+				shift = i;
+				if (usedCtrl)
+					*usedCtrl = true;
+			}
+		} else {
+			if (c < 'A' || c > 'Z')
 				return {};
-			if (c == ctrl[0])
-				c = next - 64; // $A to $Z map to control codes SH to SB
-			else if (c == ctrl[1])
-				c = PERCENTAGE_MAPPING[next - 'A'];
-			else if (c == ctrl[2])
-				c = next - 32; // /A to /O map to ! to , and /Z maps to :
-			else
-				c = next + 32; // +A to +Z map to a to z
+			switch (shift) {
+			case 0: c = c - 64; break; // $A to $Z map to control codes SH to SB
+			case 1: c = PERCENTAGE_MAPPING[c - 'A']; break;
+			case 2: c = c - 32; break; // /A to /O map to ! to , and /Z maps to :
+			default: c = c + 32; break; // +A to +Z map to a to z
+			}
+			*out++ = c;
+			shift = -1;
 		}
-		*out++ = c;
 	}
+	if (shift != -1) // dangling shift character at the end of the input
+		return {};
+
 	encoded.erase(out, encoded.end());
 	return encoded;
 }
@@ -78,6 +109,10 @@ Barcode Code39Reader::decodePattern(int rowNumber, PatternView& next, std::uniqu
 	// minimal number of characters that must be present (including start, stop and checksum characters)
 	int minCharCount = _opts.validateCode39CheckSum() ? 4 : 3;
 	auto isStartOrStopSymbol = [](char c) { return c == '*'; };
+	auto decodeChar = [](const PatternView& view) {
+		int pattern = NarrowWideBitPattern(view);
+		return pattern == -1 ? char(0) : CHARACTER_TABLE[pattern];
+	};
 
 	// provide the indices with the narrow bars/spaces which have to be equally wide
 	constexpr auto START_PATTERN = FixedSparcePattern<CHAR_LEN, 6>{0, 2, 3, 5, 7, 8};
@@ -88,7 +123,7 @@ Barcode Code39Reader::decodePattern(int rowNumber, PatternView& next, std::uniqu
 	if (!next.isValid())
 		return {};
 
-	if (!isStartOrStopSymbol(DecodeNarrowWidePattern(next, CHARACTER_ENCODINGS, ALPHABET))) // read off the start pattern
+	if (!isStartOrStopSymbol(decodeChar(next))) // read off the start pattern
 		return {};
 
 	int xStart = next.pixelsInFront();
@@ -102,7 +137,7 @@ Barcode Code39Reader::decodePattern(int rowNumber, PatternView& next, std::uniqu
 		if (!next.skipSymbol() || !next.skipSingle(maxInterCharacterSpace))
 			return {};
 
-		txt += DecodeNarrowWidePattern(next, CHARACTER_ENCODINGS, ALPHABET);
+		txt += decodeChar(next);
 		if (txt.back() == 0)
 			return {};
 	} while (!isStartOrStopSymbol(txt.back()));
@@ -115,16 +150,19 @@ Barcode Code39Reader::decodePattern(int rowNumber, PatternView& next, std::uniqu
 
 	auto lastChar = txt.back();
 	txt.pop_back();
-	int checksum = TransformReduce(txt, 0, [](char c) { return IndexOf(ALPHABET, c); });
+	int checksum = TransformReduce(txt, 0, [](char c) { return CHARACTER_VALUES[static_cast<uint8_t>(c)]; });
 	bool hasValidCheckSum = lastChar == ALPHABET[checksum % 43];
 	if (!hasValidCheckSum)
 		txt.push_back(lastChar);
 
-	const char shiftChars[] = "$%/+";
-	auto fullASCII = _opts.tryCode39ExtendedMode() ? DecodeCode39AndCode93FullASCII(txt, shiftChars) : "";
-	bool hasFullASCII = !fullASCII.empty() && std::find_first_of(txt.begin(), txt.end(), shiftChars, shiftChars + 4) != txt.end();
-	if (hasFullASCII)
-		txt = fullASCII;
+	bool hasFullASCII = false;
+	if (_opts.tryCode39ExtendedMode()) {
+		auto fullASCII = DecodeCode39AndCode93FullASCII(txt, "$%/+", &hasFullASCII);
+		if (fullASCII.empty())
+			hasFullASCII = false; // conversion failed, keep the raw text
+		else if (hasFullASCII)
+			txt = std::move(fullASCII);
+	}
 
 	if (hasValidCheckSum)
 		txt.push_back(lastChar);
@@ -36,6 +36,16 @@ static constexpr int CHARACTER_ENCODINGS[] = {
 
 static_assert(Size(ALPHABET) == Size(CHARACTER_ENCODINGS), "table size mismatch");
 
+// The encodings are 9 bit patterns with the first bit always set, so a direct 512 entry lookup table
+// replaces the linear search over the table above. Unused entries stay 0, the 'not found' value of
+// LookupBitPattern.
+static auto CHARACTER_TABLE = [] {
+	std::array<char, 1 << 9> res = {};
+	for (int i = 0; i < Size(CHARACTER_ENCODINGS); ++i)
+		res[CHARACTER_ENCODINGS[i]] = ALPHABET[i];
+	return res;
+}();
+
 static const int ASTERISK_ENCODING = 0x15E;
 
 using CounterContainer = std::array<int, 6>;
@@ -62,7 +72,7 @@ CheckChecksums(const std::string& result)
 }
 
 // forward declare here. see ODCode39Reader.cpp. Not put in header to not pollute the public facing API
-std::string DecodeCode39AndCode93FullASCII(std::string encoded, const char ctrl[4]);
+std::string DecodeCode39AndCode93FullASCII(std::string encoded, const char ctrl[4], bool* usedCtrl = nullptr);
 
 constexpr int CHAR_LEN = 6;
 constexpr int CHAR_SUM = 9;
@@ -99,7 +109,8 @@ Barcode Code93Reader::decodePattern(int rowNumber, PatternView& next, std::uniqu
 		if (!next.skipSymbol())
 			return {};
 
-		txt += LookupBitPattern(OneToFourBitPattern<CHAR_LEN, CHAR_SUM>(next), CHARACTER_ENCODINGS, ALPHABET);
+		int pattern = OneToFourBitPattern<CHAR_LEN, CHAR_SUM>(next);
+		txt += pattern < Size(CHARACTER_TABLE) ? CHARACTER_TABLE[pattern] : '\0';
 		if (txt.back() == 0)
 			return {};
 	} while (txt.back() != '*');
@@ -86,9 +86,29 @@ struct DXFEState : public RowReader::DecodingState
 
 std::optional<Clock> CheckForClock(int rowNumber, PatternView& view)
 {
+	// The clock signature is a long run of near-equal 1-module bars/spaces (15 without, 23 with
+	// frame number) following the 5-module start bar. Correlate against that signature first by
+	// counting how many consecutive runs stay mutually within the width tolerance of IsPattern
+	// (every accepted 1-module run lies within [0.5m - 0.5, 1.5m + 0.5], so two of them are at most
+	// a factor 3 plus rounding apart) and only evaluate the full pattern checks where this count
+	// reaches the signature length. On rows without a clock track this rejects nearly every 4x1
+	// candidate after a handful of comparisons instead of summing 17/25 run windows twice.
+	constexpr int RUNS_FN = CLOCK_PATTERN_FN.size() - 2, RUNS_NO_FN = CLOCK_PATTERN_NO_FN.size() - 2;
+	int n = 1, m = view[1], M = view[1];
+	while (n < RUNS_FN && view.isValid(n + 2)) {
+		int v = view[n + 1];
+		int nm = std::min(m, v), nM = std::max(M, v);
+		if (nM > 3 * nm + 2)
+			break;
+		m = nm, M = nM, ++n;
+	}
+	if (n < RUNS_NO_FN)
+		return {};
+
 	Clock clock;
 
-	if (IsPattern(view, CLOCK_PATTERN_FN, 0.5)) // On FN versions, the decimal number can be really close to the clock
+	// On FN versions, the decimal number can be really close to the clock
+	if (n >= RUNS_FN && IsPattern(view, CLOCK_PATTERN_FN, 0.5))
 		clock.hasFrameNr = true;
 	else if (IsPattern(view, CLOCK_PATTERN_NO_FN, 2.0))
 		clock.hasFrameNr = false;
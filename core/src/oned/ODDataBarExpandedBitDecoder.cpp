@@ -11,30 +11,110 @@
 #include "Error.h"
 #include "GTIN.h"
 
+#include <array>
+
 namespace ZXing::OneD::DataBar {
 
 constexpr char GS = 29; // FNC1
 
-static std::string DecodeGeneralPurposeBits(BitArrayView& bits)
+enum State { NUMERIC, ALPHA, ISO_IEC_646 };
+
+// One decode step of the general purpose field, precomputed per (state, 8 bit lookahead): how many
+// bits the first code consumes, up to two characters it emits and the state to continue in. The
+// original nested per-bit decisions (ported from the Java lineage) mispredict badly on in-order
+// cores; as a flat table walk, each step is one lookup plus a handful of predictable branches.
+struct Transition
 {
-	enum State { NUMERIC, ALPHA, ISO_IEC_646 };
-	State state = NUMERIC;
-	std::string res;
+	int8_t consume = 0;
+	char emit[2] = {0, 0};
+	int8_t next = NUMERIC;
+	bool error = false, fnc1 = false;
+};
+
+static constexpr Transition MakeTransition(State state, int look)
+{
+	Transition t;
+	t.next = static_cast<int8_t>(state);
+	auto bitsAt = [look](int n) { return look >> (8 - n); };
+	auto decode5Bits = [&]() {
+		int v = bitsAt(5);
+		t.consume = 5;
+		if (v == 4)
+			t.next = state == ALPHA ? ISO_IEC_646 : ALPHA;
+		else if (v == 15) { // FNC1 + latch to Numeric
+			t.emit[0] = GS;
+			t.next = NUMERIC;
+			t.fnc1 = true; // see the numeric latch quirk handling in the decode loop
+		} else
+			t.emit[0] = static_cast<char>(v + 43);
+	};
 
-	auto decode5Bits = [](State& state, std::string& res, BitArrayView& bits) {
-		int v = bits.readBits(5);
-		if (v == 4) {
-			state = state == ALPHA ? ISO_IEC_646 : ALPHA;
-		} else if (v == 15) { // FNC1 + latch to Numeric
-			res.push_back(GS);
-			state = NUMERIC;
-			// Allow for some generators incorrectly placing a numeric latch "000" after an FNC1
-			if (bits.size() >= 7 && bits.peakBits(7) < 8)
-				bits.skipBits(3);
+	switch (state) {
+	case NUMERIC:
+		if (bitsAt(4) == 0) {
+			t.consume = 4;
+			t.next = ALPHA;
 		} else {
-			res.push_back(v + 43);
+			int v = bitsAt(7);
+			t.consume = 7;
+			t.emit[0] = (v - 8) / 11 == 10 ? GS : static_cast<char>('0' + (v - 8) / 11);
+			t.emit[1] = (v - 8) % 11 == 10 ? GS : static_cast<char>('0' + (v - 8) % 11);
 		}
-	};
+		break;
+	case ALPHA:
+		if (bitsAt(1) == 1) {
+			constexpr char const* lut58to62 = R"(*,-./)";
+			int v = bitsAt(6);
+			t.consume = 6;
+			if (v < 58)
+				t.emit[0] = static_cast<char>(v + 33);
+			else if (v < 63)
+				t.emit[0] = lut58to62[v - 58];
+			else
+				t.error = true;
+		} else if (bitsAt(3) == 0) {
+			t.consume = 3;
+			t.next = NUMERIC;
+		} else {
+			decode5Bits();
+		}
+		break;
+	case ISO_IEC_646:
+		if (bitsAt(3) == 0) {
+			t.consume = 3;
+			t.next = NUMERIC;
+		} else if (bitsAt(5) < 16) {
+			decode5Bits();
+		} else if (bitsAt(5) < 29) {
+			int v = bitsAt(7);
+			t.consume = 7;
+			t.emit[0] = static_cast<char>(v < 90 ? v + 1 : v + 7);
+		} else {
+			constexpr char const* lut232to252 = R"(!"%&'()*+,-./:;<=>?_ )";
+			int v = bitsAt(8);
+			t.consume = 8;
+			if (v < 232 || 252 < v)
+				t.error = true;
+			else
+				t.emit[0] = lut232to252[v - 232];
+		}
+		break;
+	}
+	return t;
+}
+
+static constexpr auto TRANSITIONS = [] {
+	std::array<std::array<Transition, 256>, 3> res{};
+	for (State state : {NUMERIC, ALPHA, ISO_IEC_646})
+		for (int look = 0; look < 256; ++look)
+			res[state][look] = MakeTransition(state, look);
+	return res;
+}();
+
+static std::string DecodeGeneralPurposeBits(BitArrayView& bits)
+{
+	State state = NUMERIC;
+	std::string res;
 
 	auto isPadding = [](State state, BitArrayView& bits) {
 		bool res = (state == NUMERIC) ? bits.size() < 4
@@ -44,66 +124,28 @@ static std::string DecodeGeneralPurposeBits(BitArrayView& bits)
 		return res;
 	};
 
-	while(bits.size() >= 3) {
-		switch(state) {
-		case NUMERIC:
-			if (isPadding(state, bits))
-				break;
-			if (bits.size() < 7) {
-				int v = bits.readBits(4);
-				if (v > 0)
-					res.push_back(ToDigit(v - 1));
-			} else if (bits.peakBits(4) == 0) {
-				bits.skipBits(4);
-				state = ALPHA;
-			} else {
-				int v = bits.readBits(7);
-				for (int digit : {(v - 8) / 11, (v - 8) % 11})
-					res.push_back(digit == 10 ? GS : ToDigit(digit));
-			}
-			break;
-		case ALPHA:
-			if (isPadding(state, bits))
-				break;
-			if (bits.peakBits(1) == 1) {
-				constexpr char const* lut58to62 = R"(*,-./)";
-				int v = bits.readBits(6);
-				if (v < 58)
-					res.push_back(v + 33);
-				else if (v < 63)
-					res.push_back(lut58to62[v - 58]);
-				else
-					throw FormatError();
-			} else if (bits.peakBits(3) == 0) {
-				bits.skipBits(3);
-				state = NUMERIC;
-			} else {
-				decode5Bits(state, res, bits);
-			}
-			break;
-		case ISO_IEC_646:
-			if (isPadding(state, bits))
-				break;
-			if (bits.peakBits(3) == 0) {
-				bits.skipBits(3);
-				state = NUMERIC;
-			} else {
-				int v = bits.peakBits(5);
-				if (v < 16) {
-					decode5Bits(state, res, bits);
-				} else if (v < 29) {
-					v = bits.readBits(7);
-					res.push_back(v < 90 ? v + 1 : v + 7);
-				} else {
-					constexpr char const* lut232to252 = R"(!"%&'()*+,-./:;<=>?_ )";
-					v = bits.readBits(8);
-					if (v < 232 || 252 < v)
-						throw FormatError();
-					res.push_back(lut232to252[v - 232]);
-				}
-			}
-			break;
+	while (bits.size() >= 3) {
+		if (isPadding(state, bits))
+			continue;
+		if (state == NUMERIC && bits.size() < 7) {
+			// a trailing digit may be stuffed into the last 4 to 6 bits
+			if (int v = bits.readBits(4); v > 0)
+				res.push_back(ToDigit(v - 1));
+			continue;
 		}
+
+		int n = std::min(bits.size(), 8);
+		const Transition& t = TRANSITIONS[state][bits.peakBits(n) << (8 - n)];
+		if (t.error)
+			throw FormatError();
+		bits.skipBits(t.consume); // throws if the code crosses the end of the bit stream
+		for (char c : t.emit)
+			if (c)
+				res.push_back(c);
+		state = State(t.next);
+		// Allow for some generators incorrectly placing a numeric latch "000" after an FNC1
+		if (t.fnc1 && bits.size() >= 7 && bits.peakBits(7) < 8)
+			bits.skipBits(3);
 	}
 
 	// in NUMERIC encodation there might be a trailing FNC1 that needs to be ignored
@@ -14,8 +14,9 @@
 #include "ODDataBarExpandedBitDecoder.h"
 #include "Barcode.h"
 
+#include <array>
 #include <cmath>
-#include <map>
+#include <utility>
 #include <vector>
 
 namespace ZXing::OneD {
@@ -232,7 +233,34 @@ static Pairs ReadRowOfPairs(PatternView& next, int rowNumber)
 	return pairs;
 }
 
-using PairMap = std::map<int, Pairs>;
+// The finder ids are in {+-1 .. +-FINDER_F}, so instead of a std::map the pairs are accumulated in a
+// small flat array of buckets. The buckets keep their allocations alive over the hundreds of rows a
+// stacked symbol accumulation may touch, and size() reports the number of finder ids ever accessed,
+// matching the entry count of the former map.
+class PairMap
+{
+	std::array<Pairs, 2 * FINDER_F> _buckets;
+	std::array<bool, 2 * FINDER_F> _seen = {};
+	int _numSeen = 0;
+
+	static int BucketIndex(int finder) { return 2 * (std::abs(finder) - 1) + (finder < 0); }
+
+public:
+	Pairs& operator[](int finder)
+	{
+		int i = BucketIndex(finder);
+		_numSeen += !std::exchange(_seen[i], true);
+		return _buckets[i];
+	}
+
+	const Pairs* find(int finder) const
+	{
+		int i = BucketIndex(finder);
+		return _seen[i] ? &_buckets[i] : nullptr;
+	}
+
+	size_t size() const { return _numSeen; }
+};
 
 // inserts all pairs inside row into the PairMap or increases their count respectively.
 static bool Insert(PairMap& all, Pairs&& row)
@@ -260,12 +288,12 @@ static bool FindValidSequence(const PairMap& all, ITER begin, ITER end, Pairs& s
 	if (begin == end)
 		return ChecksumIsValid(stack);
 
-	if (auto ppairs = all.find(*begin); ppairs != all.end()) {
+	if (auto ppairs = all.find(*begin)) {
 		// only try the N most common pairs, this means the absolute maximum number of ChecksumIsValid() evaluations
 		// is N^11 (11 is the maximum sequence length).
 		constexpr int N = 2;
 		// TODO c++20 ranges::views::take()
-		auto& pairs = ppairs->second;
+		auto& pairs = *ppairs;
 		int n = 0;
 		for (auto p = pairs.begin(), pend = pairs.end(); p != pend && n < N; ++p, ++n) {
 			// skip p if it is a half-pair but not the last one in the sequence
@@ -11,8 +11,35 @@
 #include "Barcode.h"
 #include "ZXAlgorithms.h"
 
+#include <array>
+
 namespace ZXing::OneD {
 
+// Digit pair per packed wide/narrow classification of one 10 run window: bit i is set iff run i is
+// wide, even bits are bars, odd bits are spaces. The high nibble is the bar (first) digit, the low
+// nibble the space digit, 0xff marks a classification that is not a valid pair of 2-of-5 codes.
+static constexpr auto DIGIT_PAIRS = [] {
+	std::array<uint8_t, 1024> res = {};
+	constexpr int weights[] = {1, 2, 4, 7, 0};
+	auto digit = [&](int bits) {
+		int n = 0, d = 0;
+		for (int i = 0; i < 5; ++i)
+			if (bits >> i & 1)
+				++n, d += weights[i];
+		return n == 2 ? (d == 11 ? 0 : d) : -1;
+	};
+	for (int idx = 0; idx < 1024; ++idx) {
+		int barBits = 0, spaceBits = 0;
+		for (int i = 0; i < 5; ++i) {
+			barBits |= (idx >> (2 * i) & 1) << i;
+			spaceBits |= (idx >> (2 * i + 1) & 1) << i;
+		}
+		int b = digit(barBits), s = digit(spaceBits);
+		res[idx] = b < 0 || s < 0 ? 0xff : static_cast<uint8_t>(b << 4 | s);
+	}
+	return res;
+}();
+
 Barcode ITFReader::decodePattern(int rowNumber, PatternView& next, std::unique_ptr<DecodingState>&) const
 {
 	const int minCharCount = _opts.formats().count() == 1 ? 4 : 6; // if we are only looking for ITF, we accept shorter symbols
@@ -31,7 +58,6 @@ Barcode ITFReader::decodePattern(int rowNumber, PatternView& next, std::unique_p
 		if (next[i] > threshold[i])
 			return {};
 
-	constexpr int weights[] = {1, 2, 4, 7, 0};
 	int xStart = next.pixelsInFront();
 	bool startsAtFirstBar = next.isAtFirstBar();
 
@@ -45,19 +71,21 @@ Barcode ITFReader::decodePattern(int rowNumber, PatternView& next, std::unique_p
 		if (next[3] > threshold.space * 3)
 			break;
 
-		BarAndSpace<int> digits, numWide;
+		// classify all 10 runs against the per-symbol reference widths in one branchless (and auto
+		// vectorizable) pass and decode the digit pair with a single table lookup on the packed bits
+		int wideBits = 0;
 		bool bad = false;
 		for (int i = 0; i < 10; ++i) {
 			bad |= next[i] > threshold[i] * 3 || next[i] < threshold[i] / 3;
-			numWide[i] += next[i] > threshold[i];
-			digits[i] += weights[i/2] * (next[i] > threshold[i]);
+			wideBits |= static_cast<int>(next[i] > threshold[i]) << i;
 		}
 
-		if (bad || numWide.bar != 2 || numWide.space != 2)
+		auto pair = DIGIT_PAIRS[wideBits];
+		if (bad || pair == 0xff)
 			break;
 
-		for (int i = 0; i < 2; ++i)
-			txt.push_back(ToDigit(digits[i] == 11 ? 0 : digits[i]));
+		txt.push_back(ToDigit(pair >> 4));
+		txt.push_back(ToDigit(pair & 0xf));
 
 		// update threshold to support scanning slanted symbols (scanned non-perpendicular)
 		threshold = NarrowWideThreshold(next);
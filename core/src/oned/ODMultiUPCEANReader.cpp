@@ -42,15 +42,47 @@ constexpr float QUIET_ZONE_ADDON = 3;
 // There is a single sample (ean13-1/12.png) that fails to decode with these (new) settings because
 // it has a right-side quiet zone of only about 4.5 modules, which is clearly out of spec.
 
+// These two values are critical for determining how permissive the decoding will be.
+// We've arrived at these values through a lot of trial and error. Setting them any higher
+// lets false positives creep in quickly.
+static constexpr float MAX_AVG_VARIANCE = 0.48f;
+static constexpr float MAX_INDIVIDUAL_VARIANCE = 0.7f;
+
+// The 6 digit windows of the left half sit at the same positions for EAN-13, EAN-8 and UPC-E, but each
+// sub-format trial used to classify them again. The lattice holds the per-window best match over the
+// L-and-G table and over the L-only subset (computed in one pass over the 20 patterns), so falling
+// through from one sub-format to the next does not repeat the pattern matching.
+struct DigitLattice
+{
+	std::array<int8_t, 6> lg, l;
+	bool valid = false;
+};
+
+static const DigitLattice& Classify(const PatternView& begin, DigitLattice& res)
+{
+	if (!res.valid) {
+		auto next = begin.subView(END_PATTERN.size(), CHAR_LEN);
+		for (int i = 0; i < 6; ++i, next.skipSymbol()) {
+			float bestVarLG = MAX_AVG_VARIANCE, bestVarL = MAX_AVG_VARIANCE;
+			int8_t bestLG = -1, bestL = -1;
+			for (int j = 0; j < Size(UPCEANCommon::L_AND_G_PATTERNS); ++j) {
+				float v = RowReader::PatternMatchVariance(next, UPCEANCommon::L_AND_G_PATTERNS[j], MAX_INDIVIDUAL_VARIANCE);
+				if (v < bestVarLG)
+					bestVarLG = v, bestLG = narrow_cast<int8_t>(j);
+				if (j < 10 && v < bestVarL)
+					bestVarL = v, bestL = narrow_cast<int8_t>(j);
+			}
+			res.lg[i] = bestLG;
+			res.l[i] = bestL;
+		}
+		res.valid = true;
+	}
+	return res;
+}
+
 static bool DecodeDigit(const PatternView& view, std::string& txt, int* lgPattern = nullptr)
 {
 #if 1
-	// These two values are critical for determining how permissive the decoding will be.
-	// We've arrived at these values through a lot of trial and error. Setting them any higher
-	// lets false positives creep in quickly.
-	static constexpr float MAX_AVG_VARIANCE = 0.48f;
-	static constexpr float MAX_INDIVIDUAL_VARIANCE = 0.7f;
-
 	int bestMatch =
 		lgPattern ? RowReader::DecodeDigit(view, UPCEANCommon::L_AND_G_PATTERNS, MAX_AVG_VARIANCE, MAX_INDIVIDUAL_VARIANCE, false)
 				  : RowReader::DecodeDigit(view, UPCEANCommon::L_PATTERNS, MAX_AVG_VARIANCE, MAX_INDIVIDUAL_VARIANCE, false);
@@ -129,20 +161,23 @@ bool _ret_false_debug_helper()
 }
 #define CHECK(A) if(!(A)) return _ret_false_debug_helper();
 
-static bool EAN13(PartialResult& res, PatternView begin)
+static bool EAN13(PartialResult& res, PatternView begin, DigitLattice& lattice)
 {
 	auto mid = begin.subView(27, MID_PATTERN.size());
 	auto end = begin.subView(56, END_PATTERN.size());
 
 	CHECK(end.isValid() && IsRightGuard(end, END_PATTERN, QUIET_ZONE_RIGHT_EAN) && IsPattern(mid, MID_PATTERN));
 
-	auto next = begin.subView(END_PATTERN.size(), CHAR_LEN);
 	res.txt = " "; // make space for lgPattern character
 	int lgPattern = 0;
 
-	CHECK(DecodeDigits(6, next, res.txt, &lgPattern));
+	for (auto d : Classify(begin, lattice).lg) {
+		CHECK(d != -1);
+		res.txt += ToDigit(d % 10);
+		AppendBit(lgPattern, d >= 10);
+	}
 
-	next = next.subView(MID_PATTERN.size(), CHAR_LEN);
+	auto next = begin.subView(27 + MID_PATTERN.size(), CHAR_LEN);
 
 	CHECK(DecodeDigits(6, next, res.txt));
 
@@ -161,7 +196,7 @@ static bool PlausibleDigitModuleSize(PatternView begin, int start, int i, float
 	return std::abs(moduleSizeData / moduleSizeRef - 1) < 0.2f;
 }
 
-static bool EAN8(PartialResult& res, PatternView begin)
+static bool EAN8(PartialResult& res, PatternView begin, DigitLattice& lattice)
 {
 	auto mid = begin.subView(19, MID_PATTERN.size());
 	auto end = begin.subView(40, END_PATTERN.size());
@@ -175,12 +210,14 @@ static bool EAN8(PartialResult& res, PatternView begin)
 		for (int i = 0; i < 4; ++i)
 			CHECK(PlausibleDigitModuleSize(begin, start, i, moduleSizeGuard));
 
-	auto next = begin.subView(END_PATTERN.size(), CHAR_LEN);
 	res.txt.clear();
+	for (int i = 0; i < 4; ++i) {
+		int d = Classify(begin, lattice).l[i];
+		CHECK(d != -1);
+		res.txt += ToDigit(d);
+	}
 
-	CHECK(DecodeDigits(4, next, res.txt));
-
-	next = next.subView(MID_PATTERN.size(), CHAR_LEN);
+	auto next = begin.subView(19 + MID_PATTERN.size(), CHAR_LEN);
 
 	CHECK(DecodeDigits(4, next, res.txt));
 
@@ -189,7 +226,7 @@ static bool EAN8(PartialResult& res, PatternView begin)
 	return true;
 }
 
-static bool UPCE(PartialResult& res, PatternView begin)
+static bool UPCE(PartialResult& res, PatternView begin, DigitLattice& lattice)
 {
 	auto end = begin.subView(27, UPCE_END_PATTERN.size());
 
@@ -202,11 +239,14 @@ static bool UPCE(PartialResult& res, PatternView begin)
 	for (int i = 0; i < 6; ++i)
 		CHECK(PlausibleDigitModuleSize(begin, 3, i, moduleSizeGuard));
 
-	auto next = begin.subView(END_PATTERN.size(), CHAR_LEN);
 	int lgPattern = 0;
 	res.txt = " "; // make space for lgPattern character
 
-	CHECK(DecodeDigits(6, next, res.txt, &lgPattern));
+	for (auto d : Classify(begin, lattice).lg) {
+		CHECK(d != -1);
+		res.txt += ToDigit(d % 10);
+		AppendBit(lgPattern, d >= 10);
+	}
 
 	int i = IndexOf(UPCEANCommon::NUMSYS_AND_CHECK_DIGIT_PATTERNS, lgPattern);
 	CHECK(i != -1);
@@ -273,11 +313,12 @@ Barcode MultiUPCEANReader::decodePattern(int rowNumber, PatternView& next, std::
 		return {};
 
 	PartialResult res;
+	DigitLattice lattice;
 	auto begin = next;
-	
-	if (!(((_opts.hasFormat(BarcodeFormat::EAN13 | BarcodeFormat::UPCA)) && EAN13(res, begin)) ||
-		  (_opts.hasFormat(BarcodeFormat::EAN8) && EAN8(res, begin)) ||
-		  (_opts.hasFormat(BarcodeFormat::UPCE) && UPCE(res, begin))))
+
+	if (!(((_opts.hasFormat(BarcodeFormat::EAN13 | BarcodeFormat::UPCA)) && EAN13(res, begin, lattice)) ||
+		  (_opts.hasFormat(BarcodeFormat::EAN8) && EAN8(res, begin, lattice)) ||
+		  (_opts.hasFormat(BarcodeFormat::UPCE) && UPCE(res, begin, lattice))))
 		return {};
 
 	// ISO/IEC 15420:2009 (& GS1 General Specifications 5.1.3) states that the content for "]E0" should be 13 digits,
@@ -304,14 +345,23 @@ Barcode MultiUPCEANReader::decodePattern(int rowNumber, PatternView& next, std::
 
 	auto ext = res.end;
 	PartialResult addOnRes;
-	if (_opts.eanAddOnSymbol() != EanAddOnSymbol::Ignore && ext.skipSymbol()
-		&& ext.skipSingle(static_cast<int>(begin.sum() * 3.5)) && (AddOn(addOnRes, ext, 5) || AddOn(addOnRes, ext, 2))) {
-		res.txt += addOnRes.txt;
-		next = addOnRes.end;
-		// ISO/IEC 15420:2009 states that the content for "]E3" should be 15 or 18 digits, i.e. converted to EAN-13
-		// and extended with no separator, and that the content for "]E4" should be 8 digits, i.e. no add-on
-		// @gitlost and @axxel decided to extend the spec here to simply add an EAN-8 + add-on option
-		symbologyIdentifier.modifier = '3'; // Combined packet, EAN-13, UPC-A, UPC-E, with add-on
+	// With EanAddOnSymbol::Read, defer the add-on search until the main symbol passed its checksum:
+	// the row sweep produces plenty of candidates that fail it and get discarded anyway (unless
+	// returnErrors is set). Require keeps scanning so an error result still reports its add-on.
+	bool lookForAddOn = _opts.eanAddOnSymbol() == EanAddOnSymbol::Require
+						|| (_opts.eanAddOnSymbol() == EanAddOnSymbol::Read && !error);
+	if (lookForAddOn && ext.skipSymbol() && ext.skipSingle(static_cast<int>(begin.sum() * 3.5))) {
+		// the 5 and 2 digit trials share the start pattern, check it only once
+		auto extStart = ext.subView(0, EXT_START_PATTERN.size());
+		if (extStart.isValid() && IsPattern(extStart, EXT_START_PATTERN)
+			&& (AddOn(addOnRes, ext, 5) || AddOn(addOnRes, ext, 2))) {
+			res.txt += addOnRes.txt;
+			next = addOnRes.end;
+			// ISO/IEC 15420:2009 states that the content for "]E3" should be 15 or 18 digits, i.e. converted to EAN-13
+			// and extended with no separator, and that the content for "]E4" should be 8 digits, i.e. no add-on
+			// @gitlost and @axxel decided to extend the spec here to simply add an EAN-8 + add-on option
+			symbologyIdentifier.modifier = '3'; // Combined packet, EAN-13, UPC-A, UPC-E, with add-on
+		}
 	}
 
 	if (_opts.eanAddOnSymbol() == EanAddOnSymbol::Require && !addOnRes.isValid())
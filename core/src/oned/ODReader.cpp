@@ -8,6 +8,7 @@
 #include "ODReader.h"
 
 #include "BinaryBitmap.h"
+#include "DecodeCounters.h"
 #include "ReaderOptions.h"
 #include "ODCodabarReader.h"
 #include "ODCode128Reader.h"
@@ -22,8 +23,21 @@
 #include "Barcode.h"
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <utility>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include "GlobalHistogramBinarizer.h"
+#include "ReadBarcode.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 #ifdef PRINT_DEBUG
 #include "BitMatrix.h"
 #include "BitMatrixIO.h"
@@ -36,12 +50,18 @@ void IncrementLineCount(Barcode& r)
 	++r._lineCount;
 }
 
+void AddLineCount(Barcode& r, int n)
+{
+	r._lineCount += n;
+}
+
 } // namespace ZXing
 
 namespace ZXing::OneD {
 
-Reader::Reader(const ReaderOptions& opts) : ZXing::Reader(opts)
+static std::vector<std::unique_ptr<RowReader>> BuildRowReaders(const ReaderOptions& opts)
 {
+	std::vector<std::unique_ptr<RowReader>> _readers;
 	_readers.reserve(8);
 
 	auto formats = opts.formats().empty() ? BarcodeFormat::Any : opts.formats();
@@ -67,10 +87,32 @@ Reader::Reader(const ReaderOptions& opts) : ZXing::Reader(opts)
 		_readers.emplace_back(new DataBarLimitedReader(opts));
 	if (formats.testFlag(BarcodeFormat::DXFilmEdge))
 		_readers.emplace_back(new DXFilmEdgeReader(opts));
+
+	return _readers;
 }
 
+Reader::Reader(const ReaderOptions& opts) : ZXing::Reader(opts), _readers(BuildRowReaders(opts)) {}
+
 Reader::~Reader() = default;
 
+// Soft deadline for the row sweep, see ReaderOptions::timeBudgetMs. It is shared between the normal and
+// the rotated sweep of one image so the budget bounds the frame latency, not each sweep individually.
+struct ScanDeadline
+{
+	std::chrono::steady_clock::time_point half, end;
+	bool active = false;
+
+	explicit ScanDeadline(int budgetMs = 0)
+	{
+		if (budgetMs > 0) {
+			auto now = std::chrono::steady_clock::now();
+			half = now + std::chrono::milliseconds(budgetMs) / 2;
+			end = now + std::chrono::milliseconds(budgetMs);
+			active = true;
+		}
+	}
+};
+
 /**
 * We're going to examine rows from the middle outward, searching alternately above and below the
 * middle, and farther out each time. rowStep is the number of rows between each successive
@@ -80,8 +122,9 @@ Reader::~Reader() = default;
 * decided that moving up and down by about 1/16 of the image is pretty good; we try more of the
 * image if "trying harder".
 */
-static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers, const BinaryBitmap& image, bool tryHarder,
-						 bool rotate, bool isPure, int maxSymbols, int minLineCount, bool returnErrors)
+static Barcodes ScanRows(const std::vector<std::unique_ptr<RowReader>>& readers, const BinaryBitmap& image, bool tryHarder,
+						 bool rotate, bool isPure, int maxSymbols, int minLineCount, bool returnErrors, int rowBegin,
+						 int rowEnd, int centerRow, const ScanDeadline& deadline)
 {
 	Barcodes res;
 
@@ -93,18 +136,26 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 	if (rotate)
 		std::swap(width, height);
 
-	int middle = height / 2;
+	// start the middle-out sweep at the predicted symbol position if we have one (see BinaryBitmap::scanHint)
+	int middle = rowBegin <= centerRow && centerRow < rowEnd ? centerRow : (rowBegin + rowEnd) / 2;
 	// TODO: find a better heuristic/parameterization if maxSymbols != 1
 	int rowStep = std::max(1, height / ((tryHarder && !isPure) ? (maxSymbols == 1 ? 256 : 512) : 32));
 	int maxLines = tryHarder ?
-		height :	// Look at the whole image, not just the center
-		15;			// 15 rows spaced 1/32 apart is roughly the middle half of the image
+		rowEnd - rowBegin :	// Look at the whole row range, not just the center
+		std::max(1, 15 * (rowEnd - rowBegin) / height); // 15 rows spaced 1/32 apart is roughly the middle half of the image
 
-	if (isPure)
-		minLineCount = 1;
-	else
-		minLineCount = std::min(minLineCount, height);
 	std::vector<int> checkRows;
+	bool degraded = false;
+
+	// Bounding x-intervals (expanded by the symbol length) of the entries in res: a new line can only be
+	// merged into a symbol whose interval it overlaps (see Result::operator==), which spares the full
+	// equality comparison against every accumulated symbol when many symbols share the field of view.
+	std::vector<std::pair<int, int>> resSpans;
+	auto xSpanOf = [](const Position& pos) {
+		auto [xMin, xMax] = std::minmax({pos[0].x, pos[1].x, pos[2].x, pos[3].x});
+		int len = maxAbsComponent(pos.topLeft() - pos.bottomRight());
+		return std::pair{xMin - len, xMax + len};
+	};
 
 	PatternRow bars;
 	bars.reserve(128); // e.g. EAN-13 has 59 bars/spaces
@@ -120,7 +171,7 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 		bool isAbove = (i & 0x01) == 0; // i.e. is x even?
 		int rowNumber = middle + rowStep * (isAbove ? rowStepsAboveOrBelow : -rowStepsAboveOrBelow);
 		bool isCheckRow = false;
-		if (rowNumber < 0 || rowNumber >= height) {
+		if (rowNumber < rowBegin || rowNumber >= rowEnd) {
 			// Oops, if we run off the top or bottom, stop
 			break;
 		}
@@ -131,13 +182,32 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 			rowNumber = checkRows.back();
 			checkRows.pop_back();
 			isCheckRow = true;
-			if (rowNumber < 0 || rowNumber >= height)
+			if (rowNumber < rowBegin || rowNumber >= rowEnd)
 				continue;
 		}
 
+		if (deadline.active && !isCheckRow && (i & 0xf) == 0xf) {
+			auto now = std::chrono::steady_clock::now();
+			if (now >= deadline.end)
+				break;
+			// more than half the budget spent before half the sweep is done: double the row step to cover
+			// the remaining row range with fewer lines instead of truncating the sweep at the deadline
+			if (!degraded && now >= deadline.half) {
+				rowStep *= 2;
+				degraded = true;
+			}
+		}
+
 		if (!image.getPatternRow(rowNumber, rotate ? 90 : 0, bars))
 			continue;
 
+		// even the least demanding symbology (DXFilmEdge) needs at least 10 bars/spaces in a row, so skip
+		// the whole reader loop over e.g. blank rows right away
+		if (Size(bars) < 10)
+			continue;
+
+		++detail::decodeCounters.rowPatternsScanned;
+
 #ifdef PRINT_DEBUG
 		bool val = false;
 		int x = 0;
@@ -170,6 +240,12 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 				PatternView next(bars);
 				do {
 					Barcode result = readers[r]->decodePattern(rowNumber, next, decodingState[r]);
+					// Coarse-to-fine refinement: a result with an error means a guard/structure was found
+					// but the decode failed (e.g. blur or a local defect on this particular row). Bisect
+					// towards hopefully cleaner rows nearby instead of waiting for the next coarse step.
+					if (!result.isValid() && result.error() && !returnErrors && !isCheckRow && rowStep > 1
+						&& checkRows.empty())
+						checkRows = {rowNumber - rowStep / 2, rowNumber + rowStep / 2};
 					if (result.isValid() || (returnErrors && result.error())) {
 						IncrementLineCount(result);
 						if (upsideDown) {
@@ -189,7 +265,13 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 						}
 
 						// check if we know this code already
-						for (auto& other : res) {
+						auto [newMin, newMax] =
+							std::minmax({result.position()[0].x, result.position()[1].x, result.position()[2].x,
+										 result.position()[3].x});
+						for (int o = 0; o < Size(res); ++o) {
+							auto& other = res[o];
+							if (newMax < resSpans[o].first || newMin > resSpans[o].second)
+								continue;
 							if (result == other) {
 								// merge the position information
 								auto dTop = maxAbsComponent(other.position().topLeft() - result.position().topLeft());
@@ -204,6 +286,7 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 									points[3] = result.position()[3];
 								}
 								other.setPosition(points);
+								resSpans[o] = xSpanOf(other.position());
 								IncrementLineCount(other);
 								// clear the result, so we don't insert it again below
 								result = Barcode();
@@ -212,6 +295,7 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 						}
 
 						if (result.format() != BarcodeFormat::None) {
+							resSpans.push_back(xSpanOf(result.position()));
 							res.push_back(std::move(result));
 
 							// if we found a valid code we have not seen before but a minLineCount > 1,
@@ -238,6 +322,15 @@ static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers,
 	}
 
 out:
+#ifdef PRINT_DEBUG
+	SaveAsPBM(dbg, rotate ? "od-log-r.pnm" : "od-log.pnm");
+#endif
+
+	return res;
+}
+
+static Barcodes FilterResults(Barcodes&& res, int minLineCount)
+{
 	// remove all symbols with insufficient line count
 #ifdef __cpp_lib_erase_if
 	std::erase_if(res, [&](auto&& r) { return r.lineCount() < minLineCount; });
@@ -259,34 +352,256 @@ out:
 	res.erase(it, res.end());
 #endif
 
-#ifdef PRINT_DEBUG
-	SaveAsPBM(dbg, rotate ? "od-log-r.pnm" : "od-log.pnm");
+	return std::move(res);
+}
+
+#ifdef ZXING_EXPERIMENTAL_API
+// Merges the raw results of a band scan into res, accumulating line counts and extending the position
+// of symbols that span a band boundary (same merge logic as the in-band case in ScanRows).
+static void MergeBandResults(Barcodes& res, Barcodes&& band, bool rotate)
+{
+	for (auto& result : band) {
+		bool merged = false;
+		for (auto& other : res) {
+			if (result == other) {
+				auto dTop = maxAbsComponent(other.position().topLeft() - result.position().topLeft());
+				auto dBot = maxAbsComponent(other.position().bottomLeft() - result.position().topLeft());
+				auto points = other.position();
+				if (dTop < dBot ||
+					(dTop == dBot && rotate ^ (sumAbsComponent(points[0]) > sumAbsComponent(result.position()[0])))) {
+					points[0] = result.position()[0];
+					points[1] = result.position()[1];
+				} else {
+					points[2] = result.position()[2];
+					points[3] = result.position()[3];
+				}
+				other.setPosition(points);
+				AddLineCount(other, result.lineCount());
+				merged = true;
+				break;
+			}
+		}
+		if (!merged)
+			res.push_back(std::move(result));
+	}
+}
 #endif
 
-	return res;
+static Barcodes DoDecode(const std::vector<std::unique_ptr<RowReader>>& readers, const BinaryBitmap& image, bool tryHarder,
+						 bool rotate, bool isPure, int maxSymbols, int minLineCount, bool returnErrors, int maxThreads,
+						 const ScanDeadline& deadline)
+{
+	int height = rotate ? image.width() : image.height();
+	minLineCount = isPure ? 1 : std::min(minLineCount, height);
+#ifdef ZXING_EXPERIMENTAL_API
+	// for the rotated sweep 'rows' are columns of the image, so the relevant hint coordinate is x
+	int centerRow = rotate ? image.scanHint().x : image.scanHint().y;
+#else
+	int centerRow = -1;
+#endif
+
+#ifdef ZXING_EXPERIMENTAL_API
+	// Partitioned mode: contiguous bands of rows are scanned by worker threads, each with its own
+	// decoding state, and the per-band results are merged before the minLineCount filtering. Bands are
+	// kept at least 64 rows tall so that the line accumulation of a symbol rarely spans a boundary.
+	int nThreads = std::clamp(maxThreads ? maxThreads : int(std::thread::hardware_concurrency()), 1, std::max(1, height / 64));
+	if (nThreads > 1 && !isPure) {
+		int band = (height + nThreads - 1) / nThreads;
+		std::vector<Barcodes> bands(nThreads);
+		DecodeCounters workerCounters;
+		std::mutex countersMutex;
+		std::atomic<int> next = 0;
+		RunParallel(nThreads, [&] {
+			ResetDecodeCounters(); // the pool thread may still hold counts from a previous task
+			for (int i = next++; i < nThreads; i = next++)
+				bands[i] = ScanRows(readers, image, tryHarder, rotate, isPure, maxSymbols, minLineCount, returnErrors,
+									i * band, std::min((i + 1) * band, height), centerRow, deadline);
+			std::lock_guard lock(countersMutex);
+			workerCounters += LastDecodeCounters();
+		});
+		Barcodes res;
+		for (auto& bandRes : bands)
+			MergeBandResults(res, std::move(bandRes), rotate);
+		detail::decodeCounters += workerCounters;
+		return FilterResults(std::move(res), minLineCount);
+	}
+#else
+	(void)maxThreads;
+#endif
+
+	return FilterResults(
+		ScanRows(readers, image, tryHarder, rotate, isPure, maxSymbols, minLineCount, returnErrors, 0, height, centerRow,
+				 deadline),
+		minLineCount);
 }
 
 Barcode Reader::decode(const BinaryBitmap& image) const
 {
-	auto result =
-		DoDecode(_readers, image, _opts.tryHarder(), false, _opts.isPure(), 1, _opts.minLineCount(), _opts.returnErrors());
-	
+#ifdef ZXING_EXPERIMENTAL_API
+	int maxThreads = _opts.maxNumberOfThreads();
+	ScanDeadline deadline(_opts.timeBudgetMs());
+#else
+	int maxThreads = 1;
+	ScanDeadline deadline;
+#endif
+	bool rotateFirst = false;
+#ifdef ZXING_EXPERIMENTAL_API
+	// scan the orientation the sampled gradient estimate predicts first, so the (costly) sweep of
+	// the orientation that contains nothing is only paid when the predicted one missed
+	rotateFirst = _opts.tryRotate() && !_opts.isPure() && image.rotatedSweepFirst();
+#endif
+	auto result = DoDecode(_readers, image, _opts.tryHarder(), rotateFirst, _opts.isPure(), 1, _opts.minLineCount(),
+						   _opts.returnErrors(), maxThreads, deadline);
+
 	if (result.empty() && _opts.tryRotate())
-		result = DoDecode(_readers, image, _opts.tryHarder(), true, _opts.isPure(), 1, _opts.minLineCount(), _opts.returnErrors());
+		result = DoDecode(_readers, image, _opts.tryHarder(), !rotateFirst, _opts.isPure(), 1, _opts.minLineCount(),
+						  _opts.returnErrors(), maxThreads, deadline);
 
 	return FirstOrDefault(std::move(result));
 }
 
 Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 {
-	auto resH = DoDecode(_readers, image, _opts.tryHarder(), false, _opts.isPure(), maxSymbols, _opts.minLineCount(),
-						 _opts.returnErrors());
+#ifdef ZXING_EXPERIMENTAL_API
+	int maxThreads = _opts.maxNumberOfThreads();
+	ScanDeadline deadline(_opts.timeBudgetMs());
+#else
+	int maxThreads = 1;
+	ScanDeadline deadline;
+#endif
+	bool rotateFirst = false;
+#ifdef ZXING_EXPERIMENTAL_API
+	// see the single-symbol overload above; with maxSymbols set, starting with the predicted
+	// orientation lets the sweep of the likely empty one be skipped once the count is reached
+	rotateFirst = _opts.tryRotate() && !_opts.isPure() && image.rotatedSweepFirst();
+#endif
+	auto resH = DoDecode(_readers, image, _opts.tryHarder(), rotateFirst, _opts.isPure(), maxSymbols,
+						 _opts.minLineCount(), _opts.returnErrors(), maxThreads, deadline);
 	if ((!maxSymbols || Size(resH) < maxSymbols) && _opts.tryRotate()) {
-		auto resV = DoDecode(_readers, image, _opts.tryHarder(), true, _opts.isPure(), maxSymbols - Size(resH),
-							 _opts.minLineCount(), _opts.returnErrors());
-		resH.insert(resH.end(), resV.begin(), resV.end());
+		auto resV = DoDecode(_readers, image, _opts.tryHarder(), !rotateFirst, _opts.isPure(), maxSymbols - Size(resH),
+							 _opts.minLineCount(), _opts.returnErrors(), maxThreads, deadline);
+		resH.insert(resH.end(), std::move_iterator(resV.begin()), std::move_iterator(resV.end()));
 	}
 	return resH;
 }
 
 } // namespace ZXing::OneD
+
+#ifdef ZXING_EXPERIMENTAL_API
+
+namespace ZXing {
+
+struct RowFeedScanner::State
+{
+	ReaderOptions opts;
+	std::vector<std::unique_ptr<OneD::RowReader>> readers;
+	std::vector<std::unique_ptr<OneD::RowReader::DecodingState>> decodingState;
+	Barcodes res;
+	std::vector<std::pair<int, int>> resSpans;
+	PatternRow bars;
+};
+
+RowFeedScanner::RowFeedScanner(const ReaderOptions& opts) : _state(new State{})
+{
+	_state->opts = opts;
+	_state->readers = OneD::BuildRowReaders(opts);
+	_state->decodingState.resize(_state->readers.size());
+	_state->bars.reserve(128);
+}
+
+RowFeedScanner::~RowFeedScanner() = default;
+RowFeedScanner::RowFeedScanner(RowFeedScanner&&) noexcept = default;
+RowFeedScanner& RowFeedScanner::operator=(RowFeedScanner&&) noexcept = default;
+
+int RowFeedScanner::feedRow(const uint8_t* row, int width, int rowNumber)
+{
+	auto& s = *_state;
+	int minLineCount = s.opts.minLineCount();
+	auto countValid = [&] {
+		return Reduce(s.res, 0, [&](int n, const Barcode& r) { return n + (r.lineCount() >= minLineCount); });
+	};
+	// see the xSpanOf/resSpans merge acceleration in ScanRows
+	auto xSpanOf = [](const Position& pos) {
+		auto [xMin, xMax] = std::minmax({pos[0].x, pos[1].x, pos[2].x, pos[3].x});
+		int len = maxAbsComponent(pos.topLeft() - pos.bottomRight());
+		return std::pair{xMin - len, xMax + len};
+	};
+
+	// threshold the row against its own histogram, the line-scan equivalent of GlobalHistogram
+	GlobalHistogramBinarizer binarizer{ImageView(row, width, 1, ImageFormat::Lum)};
+	if (!binarizer.getPatternRow(0, 0, s.bars) || Size(s.bars) < 10)
+		return countValid();
+
+	for (bool upsideDown : {false, true}) {
+		if (upsideDown)
+			std::reverse(s.bars.begin(), s.bars.end());
+		for (size_t r = 0; r < s.readers.size(); ++r) {
+			PatternView next(s.bars);
+			do {
+				Barcode result = s.readers[r]->decodePattern(rowNumber, next, s.decodingState[r]);
+				if (result.isValid() || (s.opts.returnErrors() && result.error())) {
+					IncrementLineCount(result);
+					if (upsideDown) {
+						// update position (flip horizontally).
+						auto points = result.position();
+						for (auto& p : points)
+							p = {width - p.x - 1, p.y};
+						result.setPosition(std::move(points));
+					}
+
+					// check if we know this code already (same merge logic as in ScanRows)
+					auto [newMin, newMax] = std::minmax(
+						{result.position()[0].x, result.position()[1].x, result.position()[2].x, result.position()[3].x});
+					for (int o = 0; o < Size(s.res); ++o) {
+						auto& other = s.res[o];
+						if (newMax < s.resSpans[o].first || newMin > s.resSpans[o].second)
+							continue;
+						if (result == other) {
+							auto dTop = maxAbsComponent(other.position().topLeft() - result.position().topLeft());
+							auto dBot = maxAbsComponent(other.position().bottomLeft() - result.position().topLeft());
+							auto points = other.position();
+							if (dTop < dBot
+								|| (dTop == dBot && sumAbsComponent(points[0]) > sumAbsComponent(result.position()[0]))) {
+								points[0] = result.position()[0];
+								points[1] = result.position()[1];
+							} else {
+								points[2] = result.position()[2];
+								points[3] = result.position()[3];
+							}
+							other.setPosition(points);
+							s.resSpans[o] = xSpanOf(other.position());
+							IncrementLineCount(other);
+							result = Barcode();
+							break;
+						}
+					}
+
+					if (result.format() != BarcodeFormat::None) {
+						s.resSpans.push_back(xSpanOf(result.position()));
+						s.res.push_back(std::move(result));
+					}
+				}
+				// make sure we make progress and we start the next try on a bar
+				next.shift(2 - (next.index() % 2));
+				next.extend();
+			} while (s.opts.tryHarder() && next.size());
+		}
+	}
+
+	return countValid();
+}
+
+Barcodes RowFeedScanner::releaseBarcodes()
+{
+	auto& s = *_state;
+	auto res = OneD::FilterResults(std::move(s.res), s.opts.minLineCount());
+	s.res.clear();
+	s.resSpans.clear();
+	for (auto& state : s.decodingState)
+		state.reset();
+	return res;
+}
+
+} // namespace ZXing
+
+#endif // ZXING_EXPERIMENTAL_API
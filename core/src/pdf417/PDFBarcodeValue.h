@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include <map>
+#include <utility>
 #include <vector>
 
 namespace ZXing {
@@ -14,10 +14,14 @@ namespace Pdf417 {
 
 /**
 * @author Guenther Grau
+*
+* Implemented as a flat array of (value, count) pairs: a cell of the codeword voting grid sees only
+* a handful of distinct values, so a linear scan beats a node based map and the grid of these (one
+* per codeword cell) stops generating an allocation per vote.
 */
 class BarcodeValue
 {
-	std::map<int, int> _values;
+	std::vector<std::pair<int, int>> _values;
 
 public:
 	/**
@@ -451,6 +451,44 @@ static constexpr int getSymbol(int idx)
 	return SYMBOL_TABLE[idx] | 0x10000;
 }
 
+/**
+* Second exact-match tier: quantize the measured bar widths to their nearest 17-module pattern
+* (largest remainder rounding, so the widths always sum to 17 modules) and look that pattern up in
+* the sorted symbol table. This resolves most slightly blurred or scaled codewords that the sample
+* point counting above missed, before falling back to the O(SYMBOL_COUNT) nearest-ratio search
+* below. A dedicated hash table buys nothing over the existing binary search here: the table probe
+* is a dozen cache-warm comparisons vs. the 2787 row error sweep it replaces.
+*/
+static int GetQuantizedValue(const ModuleBitCountType& moduleBitCount)
+{
+	int bitCountSum = Reduce(moduleBitCount);
+	if (bitCountSum < CodewordDecoder::MODULES_IN_CODEWORD)
+		return -1;
+
+	ModuleBitCountType widths;
+	std::array<float, CodewordDecoder::BARS_IN_MODULE> fracs;
+	int widthSum = 0;
+	for (int i = 0; i < CodewordDecoder::BARS_IN_MODULE; i++) {
+		float w = CodewordDecoder::MODULES_IN_CODEWORD * moduleBitCount[i] / (float)bitCountSum;
+		widths[i] = std::max(1, int(w + 0.5f));
+		fracs[i] = w - widths[i];
+		widthSum += widths[i];
+	}
+	// distribute the rounding residue over the bars with the largest remainders
+	for (int d = widthSum < CodewordDecoder::MODULES_IN_CODEWORD ? 1 : -1;
+		 widthSum != CodewordDecoder::MODULES_IN_CODEWORD; widthSum += d) {
+		auto i = std::max_element(fracs.begin(), fracs.end(),
+								  [d](float a, float b) { return d * a < d * b; }) - fracs.begin();
+		if (widths[i] + d < 1 || widths[i] + d > 6)
+			return -1;
+		widths[i] += d;
+		fracs[i] -= d;
+	}
+
+	int decodedValue = GetBitValue(widths);
+	return CodewordDecoder::GetCodeword(decodedValue) == -1 ? -1 : decodedValue;
+}
+
 static int GetClosestDecodedValue(const ModuleBitCountType& moduleBitCount)
 {
 #if 1 // put 87kB on heap and calucate per process on first use -> 7% smaller binary
@@ -510,6 +548,10 @@ CodewordDecoder::GetDecodedValue(const std::array<int, BARS_IN_MODULE>& moduleBi
 	if (decodedValue != -1) {
 		return decodedValue;
 	}
+	decodedValue = GetQuantizedValue(moduleBitCount);
+	if (decodedValue != -1) {
+		return decodedValue;
+	}
 	return GetClosestDecodedValue(moduleBitCount);
 }
 
@@ -683,7 +683,7 @@ DecoderResult Decode(const std::vector<int>& codewords)
 			}
 		}
 	} catch (std::exception& e) {
-		return FormatError(e.what());
+		return FormatError(std::string(e.what())); // copy, what() does not outlive the catch block
 	} catch (Error e) {
 		return e;
 	}
@@ -10,11 +10,16 @@
 
 #include <algorithm>
 #include <array>
+#include <utility>
 
 namespace ZXing {
 namespace Pdf417 {
 
 static const int ADJUST_ROW_NUMBER_SKIP = 2;
+// Row numbers propagate at most two codeword rows per adjustment pass, so this many passes cover
+// even the tallest (90 row) symbol. Badly damaged symbols used to drive many more full-grid passes;
+// whatever is left unadjusted when the budget runs out is handled as erasures downstream.
+static const int MAX_ROW_NUMBER_ADJUSTMENT_PASSES = 45;
 
 DetectionResult::DetectionResult(const BarcodeMetadata& barcodeMetadata, const Nullable<BoundingBox>& boundingBox) :
 	_barcodeMetadata(barcodeMetadata),
@@ -206,25 +211,25 @@ static void AdjustRowNumbers(const std::vector<Nullable<DetectionResultColumn>>&
 * @return number of codewords which don't have a valid row number. Note that the count is not accurate as codewords
 * will be counted several times. It just serves as an indicator to see when we can stop adjusting row numbers
 */
-static int AdjustRowNumbers(std::vector<Nullable<DetectionResultColumn>>& detectionResultColumns) {
+static int AdjustRowNumbers(std::vector<Nullable<DetectionResultColumn>>& detectionResultColumns,
+							std::vector<std::pair<int, int>>& invalidCells) {
 	int unadjustedCount = AdjustRowNumbersByRow(detectionResultColumns);
 	if (unadjustedCount == 0) {
 		return 0;
 	}
-	for (int barcodeColumn = 1; barcodeColumn < Size(detectionResultColumns) - 1; barcodeColumn++) {
-		if (detectionResultColumns[barcodeColumn] == nullptr) {
-			continue;
-		}
-		auto& codewords = detectionResultColumns[barcodeColumn].value().allCodewords();
-		for (int codewordsRow = 0; codewordsRow < Size(codewords); codewordsRow++) {
-			if (codewords[codewordsRow] == nullptr) {
-				continue;
-			}
-			if (!codewords[codewordsRow].value().hasValidRowNumber()) {
-				AdjustRowNumbers(detectionResultColumns, barcodeColumn, codewordsRow, codewords);
-			}
+	// Only revisit the cells that were still missing a valid row number after the previous pass.
+	// A cell never turns invalid again once adjusted (the row indicator passes above either keep
+	// it valid or null it out), so the worklist only ever shrinks.
+	auto isAdjusted = [&](const std::pair<int, int>& cell) {
+		auto& codewords = detectionResultColumns[cell.first].value().allCodewords();
+		auto& codeword = codewords[cell.second];
+		if (codeword == nullptr || codeword.value().hasValidRowNumber()) {
+			return true;
 		}
-	}
+		AdjustRowNumbers(detectionResultColumns, cell.first, cell.second, codewords);
+		return false;
+	};
+	invalidCells.erase(std::remove_if(invalidCells.begin(), invalidCells.end(), isAdjusted), invalidCells.end());
 	return unadjustedCount;
 }
 
@@ -234,12 +239,28 @@ DetectionResult::allColumns()
 {
 	AdjustIndicatorColumnRowNumbers(_detectionResultColumns.front(), _barcodeMetadata);
 	AdjustIndicatorColumnRowNumbers(_detectionResultColumns.back(), _barcodeMetadata);
+
+	std::vector<std::pair<int, int>> invalidCells;
+	for (int barcodeColumn = 1; barcodeColumn < Size(_detectionResultColumns) - 1; barcodeColumn++) {
+		if (_detectionResultColumns[barcodeColumn] == nullptr) {
+			continue;
+		}
+		auto& codewords = _detectionResultColumns[barcodeColumn].value().allCodewords();
+		for (int codewordsRow = 0; codewordsRow < Size(codewords); codewordsRow++) {
+			if (codewords[codewordsRow] != nullptr && !codewords[codewordsRow].value().hasValidRowNumber()) {
+				invalidCells.emplace_back(barcodeColumn, codewordsRow);
+			}
+		}
+	}
+
 	int unadjustedCodewordCount = CodewordDecoder::MAX_CODEWORDS_IN_BARCODE;
 	int previousUnadjustedCount;
+	int passes = 0;
 	do {
 		previousUnadjustedCount = unadjustedCodewordCount;
-		unadjustedCodewordCount = AdjustRowNumbers(_detectionResultColumns);
-	} while (unadjustedCodewordCount > 0 && unadjustedCodewordCount < previousUnadjustedCount);
+		unadjustedCodewordCount = AdjustRowNumbers(_detectionResultColumns, invalidCells);
+	} while (unadjustedCodewordCount > 0 && unadjustedCodewordCount < previousUnadjustedCount
+			 && ++passes < MAX_ROW_NUMBER_ADJUSTMENT_PASSES);
 	return _detectionResultColumns;
 }
 
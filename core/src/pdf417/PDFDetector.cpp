@@ -41,17 +41,18 @@ static const int BARCODE_MIN_HEIGHT = 10;
 * the total variance from the expected pattern proportions across all
 * pattern elements, to the length of the pattern.
 *
-* @param counters observed counters
+* @param counters observed counters (run lengths)
 * @param pattern expected pattern
+* @param length number of counters/pattern elements
 * @param maxIndividualVariance The most any counter can differ before we give up
 * @return ratio of total variance between counters and pattern compared to total pattern size
 */
 static float
-PatternMatchVariance(const std::vector<int>& counters, const std::vector<int>& pattern, float maxIndividualVariance)
+PatternMatchVariance(const PatternRow::value_type* counters, const int* pattern, int length, float maxIndividualVariance)
 {
 	int total = 0;
 	int patternLength = 0;
-	for (size_t i = 0; i < counters.size(); i++) {
+	for (int i = 0; i < length; i++) {
 		total += counters[i];
 		patternLength += pattern[i];
 	}
@@ -67,7 +68,7 @@ PatternMatchVariance(const std::vector<int>& counters, const std::vector<int>& p
 	maxIndividualVariance *= unitBarWidth;
 
 	float totalVariance = 0.0f;
-	for (size_t x = 0; x < counters.size(); x++) {
+	for (int x = 0; x < length; x++) {
 		int counter = counters[x];
 		float scaledPattern = pattern[x] * unitBarWidth;
 		float variance = counter > scaledPattern ? counter - scaledPattern : scaledPattern - counter;
@@ -81,76 +82,69 @@ PatternMatchVariance(const std::vector<int>& counters, const std::vector<int>& p
 
 
 /**
-* @param matrix row of black/white values to search
-* @param column x position to start search
-* @param row y position to start search
-* @param width the number of pixels to search on this row
-* @param pattern pattern of counts of number of black and white pixels that are
-*                 being searched for as a pattern
-* @param counters array of counters, as long as pattern, to re-use
-* @return start/end horizontal offset of guard pattern, as an array of two ints.
+* Rows converted to their run length representation, lazily and at most once per detection. The
+* guard pattern search works on run lengths: converting a row with the block based transition
+* search in GetPatternRow() and sliding the pattern window run by run is considerably faster than
+* counting runs pixel by pixel, and both the start/stop tracking and the multiple symbol loop in
+* DetectBarcode() revisit the same rows several times.
+*/
+class RowPatternCache
+{
+	const BitMatrix& _matrix;
+	std::vector<PatternRow> _rows;
+
+public:
+	explicit RowPatternCache(const BitMatrix& matrix) : _matrix(matrix), _rows(matrix.height()) {}
+
+	int width() const { return _matrix.width(); }
+	int height() const { return _matrix.height(); }
+
+	const PatternRow& row(int r)
+	{
+		if (_rows[r].empty())
+			GetPatternRow(_matrix, r, _rows[r], false);
+		return _rows[r];
+	}
+};
+
+/**
+* @param row run lengths of the row to search, starting with the leading white run
+* @param column x position to start the search, the first black run ending behind it is considered first
+* @param pattern pattern of counts of number of black and white pixels that are being searched for
+* @return start/end horizontal offset of guard pattern
 */
 static bool
-FindGuardPattern(const BitMatrix& matrix, int column, int row, int width, bool whiteFirst, const std::vector<int>& pattern, std::vector<int>& counters, int& startPos, int& endPos)
+FindGuardPattern(const PatternRow& row, int column, const std::vector<int>& pattern, int& startPos, int& endPos)
 {
-	std::fill(counters.begin(), counters.end(), 0);
 	int patternLength = Size(pattern);
-	bool isWhite = whiteFirst;
-	int patternStart = column;
-	int pixelDrift = 0;
 
-	// if there are black pixels left of the current pixel shift to the left, but only for MAX_PIXEL_DRIFT pixels 
-	while (matrix.get(patternStart, row) && patternStart > 0 && pixelDrift++ < MAX_PIXEL_DRIFT) {
-		patternStart--;
-	}
-	int x = patternStart;
-	int counterPosition = 0;
-	for (; x < width; x++) {
-		bool pixel = matrix.get(x, row);
-		if (pixel != isWhite) {
-			counters[counterPosition]++;
-		}
-		else {
-			if (counterPosition == patternLength - 1) {
-				if (PatternMatchVariance(counters, pattern, MAX_INDIVIDUAL_VARIANCE) < MAX_AVG_VARIANCE) {
-					startPos = patternStart;
-					endPos = x;
-					return true;
-				}
-				patternStart += counters[0] + counters[1];
-				std::copy(counters.begin() + 2, counters.end(), counters.begin());
-				counters[patternLength - 2] = 0;
-				counters[patternLength - 1] = 0;
-				counterPosition--;
-			}
-			else {
-				counterPosition++;
-			}
-			counters[counterPosition] = 1;
-			isWhite = !isWhite;
-		}
-	}
-	if (counterPosition == patternLength - 1) {
-		if (PatternMatchVariance(counters, pattern, MAX_INDIVIDUAL_VARIANCE) < MAX_AVG_VARIANCE) {
-			startPos = patternStart;
-			endPos = x - 1;
+	// advance to the black run containing column (this replaces the MAX_PIXEL_DRIFT backup of the
+	// pixel based version) or the first black run behind it
+	int i = 0, x = 0;
+	while (i < Size(row) && (i % 2 == 0 || x + row[i] <= column))
+		x += row[i++];
+
+	// slide the pattern window one bar/space pair at a time
+	for (; i + patternLength <= Size(row); x += row[i] + row[i + 1], i += 2)
+		if (PatternMatchVariance(&row[i], pattern.data(), patternLength, MAX_INDIVIDUAL_VARIANCE) < MAX_AVG_VARIANCE) {
+			startPos = x;
+			endPos = x + Reduce(&row[i], &row[i] + patternLength, 0);
 			return true;
 		}
-	}
+
 	return false;
 }
 
 static std::array<Nullable<ResultPoint>, 4>&
-FindRowsWithPattern(const BitMatrix& matrix, int height, int width, int startRow, int startColumn, const std::vector<int>& pattern, std::array<Nullable<ResultPoint>, 4>& result)
+FindRowsWithPattern(RowPatternCache& rows, int height, int startRow, int startColumn, const std::vector<int>& pattern, std::array<Nullable<ResultPoint>, 4>& result)
 {
 	bool found = false;
 	int startPos, endPos;
 	int minStartRow = startRow;
-	std::vector<int> counters(pattern.size(), 0);
 	for (; startRow < height; startRow += ROW_STEP) {
-		if (FindGuardPattern(matrix, startColumn, startRow, width, false, pattern, counters, startPos, endPos)) {
+		if (FindGuardPattern(rows.row(startRow), startColumn, pattern, startPos, endPos)) {
 			while (startRow > minStartRow + 1) {
-				if (!FindGuardPattern(matrix, startColumn, --startRow, width, false, pattern, counters, startPos, endPos)) {
+				if (!FindGuardPattern(rows.row(--startRow), startColumn, pattern, startPos, endPos)) {
 					startRow++;
 					break;
 				}
@@ -169,7 +163,7 @@ FindRowsWithPattern(const BitMatrix& matrix, int height, int width, int startRow
 		int previousRowEnd = static_cast<int>(result[1].value().x());
 		for (; stopRow < height; stopRow++) {
 			int startPos, endPos;
-			found = FindGuardPattern(matrix, previousRowStart, stopRow, width, false, pattern, counters, startPos, endPos);
+			found = FindGuardPattern(rows.row(stopRow), previousRowStart, pattern, startPos, endPos);
 			// a found pattern is only considered to belong to the same barcode if the start and end positions
 			// don't differ too much. Pattern drift should be not bigger than two for consecutive rows. With
 			// a higher number of skipped rows drift could be larger. To keep it simple for now, we allow a slightly
@@ -219,7 +213,7 @@ CopyToResult(std::array<Nullable<ResultPoint>, 8>& result, const std::array<Null
 *           vertices[6] x, y top right codeword area
 *           vertices[7] x, y bottom right codeword area
 */
-static std::array<Nullable<ResultPoint>, 8> FindVertices(const BitMatrix& matrix, int startRow, int startColumn)
+static std::array<Nullable<ResultPoint>, 8> FindVertices(RowPatternCache& rows, int startRow, int startColumn)
 {
 	// B S B S B S B S Bar/Space pattern
 	// 11111111 0 1 0 1 0 1 000
@@ -227,22 +221,21 @@ static std::array<Nullable<ResultPoint>, 8> FindVertices(const BitMatrix& matrix
 	// 1111111 0 1 000 1 0 1 00 1
 	static const std::vector<int> STOP_PATTERN = { 7, 1, 1, 3, 1, 1, 1, 2, 1 };
 
-	int width = matrix.width();
-	int height = matrix.height();
+	int height = rows.height();
 
 	std::array<Nullable<ResultPoint>, 4> tmp;
 	std::array<Nullable<ResultPoint>, 8> result;
-	CopyToResult(result, FindRowsWithPattern(matrix, height, width, startRow, startColumn, START_PATTERN, tmp), INDEXES_START_PATTERN);
+	CopyToResult(result, FindRowsWithPattern(rows, height, startRow, startColumn, START_PATTERN, tmp), INDEXES_START_PATTERN);
 
 	if (result[4] != nullptr) {
 		startColumn = static_cast<int>(result[4].value().x());
 		startRow = static_cast<int>(result[4].value().y());
 #if 1 // 2x speed improvement for images with no PDF417 symbol by not looking for symbols without start guard (which are not conforming to spec anyway)
-		CopyToResult(result, FindRowsWithPattern(matrix, height, width, startRow, startColumn, STOP_PATTERN, tmp), INDEXES_STOP_PATTERN);
+		CopyToResult(result, FindRowsWithPattern(rows, height, startRow, startColumn, STOP_PATTERN, tmp), INDEXES_STOP_PATTERN);
 	}
 #else
 	}
-	CopyToResult(result, FindRowsWithPattern(matrix, height, width, startRow, startColumn, STOP_PATTERN, tmp), INDEXES_STOP_PATTERN);
+	CopyToResult(result, FindRowsWithPattern(rows, height, startRow, startColumn, STOP_PATTERN, tmp), INDEXES_STOP_PATTERN);
 #endif
 	return result;
 }
@@ -260,9 +253,10 @@ static std::list<std::array<Nullable<ResultPoint>, 8>> DetectBarcode(const BitMa
 	int column = 0;
 	bool foundBarcodeInRow = false;
 	std::list<std::array<Nullable<ResultPoint>, 8>> barcodeCoordinates;
+	RowPatternCache rows(bitMatrix);
 
 	while (row < bitMatrix.height()) {
-		auto vertices = FindVertices(bitMatrix, row, column);
+		auto vertices = FindVertices(rows, row, column);
 
 		if (vertices[0] == nullptr && vertices[3] == nullptr) {
 			if (!foundBarcodeInRow) {
@@ -346,17 +340,13 @@ Detector::Result Detector::Detect(const BinaryBitmap& image, bool multiple, bool
 			continue;
 
 		result.rotation = 90 * rotate90;
-		if (rotate90) {
-			auto newBits = std::make_shared<BitMatrix>(binImg->copy());
-			newBits->rotate90();
-			binImg = newBits;
-		}
+		if (rotate90)
+			binImg = std::make_shared<BitMatrix>(Rotated90(*binImg));
 
 		result.points = DetectBarcode(*binImg, multiple);
 		result.bits = binImg;
 		if (result.points.empty()) {
-			auto newBits = std::make_shared<BitMatrix>(binImg->copy());
-			newBits->rotate180();
+			auto newBits = std::make_shared<BitMatrix>(Rotated180(*binImg));
 			result.points = DetectBarcode(*newBits, multiple);
 			result.rotation += 180;
 			result.bits = newBits;
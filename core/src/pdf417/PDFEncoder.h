@@ -166,10 +166,19 @@ public:
 		_encoding = encoding;
 	}
 
+	/**
+	* @param enable if true, AUTO compaction chooses the mode boundaries by a codeword count
+	* minimizing dynamic program, see HighLevelEncoder
+	*/
+	void setOptimalSegmentation(bool enable) {
+		_optimalSegmentation = enable;
+	}
+
 	static int GetRecommendedMinimumErrorCorrectionLevel(int n);
 
 private:
 	bool _compact;
+	bool _optimalSegmentation = false;
 	Compaction _compaction = Compaction::AUTO;
 	CharacterSet _encoding = CharacterSet::ISO8859_1;
 	int _minCols = 2;
@@ -15,6 +15,8 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <array>
+#include <limits>
 #include <string>
 #include <stdexcept>
 
@@ -483,6 +485,161 @@ static int DetermineConsecutiveBinaryCount(const std::wstring& msg, int startpos
 	return static_cast<int>(idx - startpos);
 }
 
+
+/**
+* Optimal compaction mode selection for the AUTO mode: a dynamic program over (position, mode)
+* chooses the Text/Byte/Numeric run boundaries that minimize the total codeword count, instead of
+* the fixed lookahead thresholds of annex P (e.g. "13+ digits latch to numeric") which are off by
+* a few percent on mixed payloads like ID cards. The run costs mirror EncodeText/EncodeBinary/
+* EncodeNumeric: a text run is costed in half-codeword units with an inner dynamic program over the
+* four submodes, a byte run by its 6-byte packing and a numeric run by its 44-digit grouping. The
+* chosen runs are emitted with the very same Encode* routines as the heuristic path, the DP only
+* decides the segmentation. A few costs are conservative approximations (the text submode is
+* modeled as resetting to Alpha at every run start, the base-900 size of a digit group is value
+* dependent), so the caller compares against the heuristic encoding and keeps the shorter one.
+*/
+static std::vector<int> EncodeHighLevelOptimal(const std::wstring& msg, CharacterSet encoding,
+											   const std::vector<int>& head)
+{
+	constexpr int INF = std::numeric_limits<int>::max() / 2;
+	const int n = Size(msg);
+
+	// Per-character byte count. The supported encodings are stateless, so encoding a run equals the
+	// concatenation of its individually encoded characters.
+	std::vector<int> byteLen(n);
+	for (int i = 0; i < n; ++i)
+		byteLen[i] = Size(TextEncoder::FromUnicode(msg.substr(i, 1), encoding));
+
+	// Extend the per-submode half-codeword cost vector of a text run by one character, considering
+	// the same latches and shifts as EncodeText but exploring all of them.
+	auto stepText = [](std::array<int, 4>& cost, int ch) {
+		// relax the submode latch edges (al/ll/ml/pl, 1 unit each) to a fixed point
+		for (int it = 0; it < 3; ++it) {
+			cost[SUBMODE_LOWER] = std::min({cost[SUBMODE_LOWER], cost[SUBMODE_ALPHA] + 1, cost[SUBMODE_MIXED] + 1});
+			cost[SUBMODE_MIXED] = std::min({cost[SUBMODE_MIXED], cost[SUBMODE_ALPHA] + 1, cost[SUBMODE_LOWER] + 1});
+			cost[SUBMODE_ALPHA] = std::min({cost[SUBMODE_ALPHA], cost[SUBMODE_MIXED] + 1, cost[SUBMODE_PUNCTUATION] + 1});
+			cost[SUBMODE_PUNCTUATION] = std::min(cost[SUBMODE_PUNCTUATION], cost[SUBMODE_MIXED] + 1);
+		}
+		std::array<int, 4> next = {INF, INF, INF, INF};
+		const bool in[4] = {IsAlphaUpper(ch), IsAlphaLower(ch), IsMixed(ch), IsPunctuation(ch)};
+		for (int sm = 0; sm < 4; ++sm)
+			if (in[sm])
+				next[sm] = cost[sm] + 1;
+		if (in[SUBMODE_PUNCTUATION]) // ps shift from any non-punctuation submode
+			for (int sm : {SUBMODE_ALPHA, SUBMODE_LOWER, SUBMODE_MIXED})
+				next[sm] = std::min(next[sm], cost[sm] + 2);
+		if (in[SUBMODE_ALPHA] && ch != ' ') // as shift from lower
+			next[SUBMODE_LOWER] = std::min(next[SUBMODE_LOWER], cost[SUBMODE_LOWER] + 2);
+		cost = next;
+	};
+
+	// d digits fit into roughly d * log900(10) + 1 codewords per 44 digit group, see EncodeNumeric
+	auto numericCost = [](int d) { return d / 44 * 15 + (d % 44 ? d % 44 / 3 + 1 : 0); };
+
+	enum RunMode : int8_t { TEXT, BYTE, NUMERIC, SHIFTED_BYTE };
+	struct Node
+	{
+		int cost = INF;
+		int prevI = 0;
+		RunMode prevMode = TEXT, run = TEXT;
+	};
+	std::array<std::vector<Node>, 3> dp;
+	for (auto& v : dp)
+		v.resize(n + 1);
+	dp[TEXT][0].cost = 0; // the implicit start mode, see 4.4.2.1
+
+	auto relax = [&](RunMode toMode, int toI, int cost, int fromI, RunMode fromMode, RunMode run) {
+		Node& node = dp[toMode][toI];
+		if (cost < node.cost)
+			node = {cost, fromI, fromMode, run};
+	};
+
+	for (int i = 0; i < n; ++i) {
+		for (int m = 0; m < 3; ++m) {
+			const int base = dp[m][i].cost;
+			if (base >= INF)
+				continue;
+			const auto mode = RunMode(m);
+
+			if (IsText(msg[i])) {
+				const int latch = mode == TEXT ? 0 : 1;
+				std::array<int, 4> units = {0, INF, INF, INF}; // a text run starts in Alpha
+				for (int k = 1; i + k <= n && IsText(msg[i + k - 1]); ++k) {
+					stepText(units, msg[i + k - 1]);
+					int u = *std::min_element(units.begin(), units.end());
+					relax(TEXT, i + k, base + latch + (u + 1) / 2, i, mode, TEXT);
+				}
+			}
+
+			for (int k = 1, bytes = 0; i + k <= n; ++k) { // a latch (901/924) plus the packed bytes
+				bytes += byteLen[i + k - 1];
+				relax(BYTE, i + k, base + 1 + bytes / 6 * 5 + (bytes % 6), i, mode, BYTE);
+			}
+			if (mode == TEXT && byteLen[i] == 1) // 913 shift encodes one byte and stays in text mode
+				relax(TEXT, i + 1, base + 2, i, mode, SHIFTED_BYTE);
+
+			if (IsDigit(msg[i])) {
+				for (int k = 1; i + k <= n && IsDigit(msg[i + k - 1]); ++k)
+					relax(NUMERIC, i + k, base + 1 + numericCost(k), i, mode, NUMERIC);
+			}
+		}
+	}
+
+	// backtrack the chosen runs...
+	struct Run
+	{
+		int pos, len;
+		RunMode mode;
+	};
+	std::vector<Run> runs;
+	auto endMode = RunMode(std::min_element(dp.begin(), dp.end(),
+											[n](const auto& a, const auto& b) { return a[n].cost < b[n].cost; })
+						   - dp.begin());
+	for (int i = n, m = endMode; i > 0;) {
+		const Node& node = dp[m][i];
+		runs.push_back({node.prevI, i - node.prevI, node.run});
+		i = node.prevI;
+		m = node.prevMode;
+	}
+
+	// ... and emit them exactly like the heuristic path does
+	std::vector<int> highLevel = head;
+	int encodingMode = TEXT_COMPACTION;
+	int textSubMode = SUBMODE_ALPHA;
+	for (auto it = runs.rbegin(); it != runs.rend(); ++it) {
+		switch (it->mode) {
+		case TEXT:
+			if (encodingMode != TEXT_COMPACTION) {
+				highLevel.push_back(LATCH_TO_TEXT);
+				encodingMode = TEXT_COMPACTION;
+				textSubMode = SUBMODE_ALPHA;
+			}
+			textSubMode = EncodeText(msg, it->pos, it->len, textSubMode, highLevel);
+			break;
+		case SHIFTED_BYTE:
+			EncodeBinary(TextEncoder::FromUnicode(msg.substr(it->pos, 1), encoding), 0, 1, TEXT_COMPACTION, highLevel);
+			break;
+		case BYTE: {
+			std::string bytes = TextEncoder::FromUnicode(msg.substr(it->pos, it->len), encoding);
+			EncodeBinary(bytes, 0, Size(bytes), encodingMode, highLevel);
+			if (Size(bytes) > 1 || encodingMode != TEXT_COMPACTION) { // single byte from text is a shift
+				encodingMode = BYTE_COMPACTION;
+				textSubMode = SUBMODE_ALPHA;
+			}
+			break;
+		}
+		case NUMERIC:
+			highLevel.push_back(LATCH_TO_NUMERIC);
+			encodingMode = NUMERIC_COMPACTION;
+			textSubMode = SUBMODE_ALPHA;
+			EncodeNumeric(msg, it->pos, it->len, highLevel);
+			break;
+		}
+	}
+
+	return highLevel;
+}
+
 /**
 * Performs high-level encoding of a PDF417 message using the algorithm described in annex P
 * of ISO/IEC 15438:2001(E). If byte compaction has been selected, then only byte compaction
@@ -495,7 +652,8 @@ static int DetermineConsecutiveBinaryCount(const std::wstring& msg, int startpos
 * @return the encoded message (the char values range from 0 to 928)
 */
 std::vector<int>
-HighLevelEncoder::EncodeHighLevel(const std::wstring& msg, Compaction compaction, CharacterSet encoding)
+HighLevelEncoder::EncodeHighLevel(const std::wstring& msg, Compaction compaction, CharacterSet encoding,
+								  bool optimalSegmentation)
 {
 	std::vector<int> highLevel;
 	highLevel.reserve(highLevel.size() + msg.length());
@@ -565,6 +723,16 @@ HighLevelEncoder::EncodeHighLevel(const std::wstring& msg, Compaction compaction
 				}
 			}
 		}
+
+		if (optimalSegmentation) {
+			std::vector<int> head;
+			if (encoding != CharacterSet::ISO8859_1)
+				EncodingECI(ToInt(ToECI(encoding)), head);
+			// the DP result is optimal up to a few cost approximations, keep the shorter of the two
+			auto optimal = EncodeHighLevelOptimal(msg, encoding, head);
+			if (optimal.size() < highLevel.size())
+				return optimal;
+		}
 	}
 	return highLevel;
 }
@@ -20,12 +20,15 @@ enum class Compaction;
 
 /**
 * PDF417 high-level encoder following the algorithm described in ISO/IEC 15438:2001(E) in
-* annex P.
+* annex P. With optimalSegmentation requested, the Text/Byte/Numeric mode boundaries of the
+* AUTO mode are chosen by a codeword count minimizing dynamic program instead of the annex P
+* lookahead heuristic.
 */
 class HighLevelEncoder
 {
 public:
-	static std::vector<int> EncodeHighLevel(const std::wstring& msg, Compaction compaction, CharacterSet encoding);
+	static std::vector<int> EncodeHighLevel(const std::wstring& msg, Compaction compaction, CharacterSet encoding,
+											bool optimalSegmentation = false);
 };
 
 } // Pdf417
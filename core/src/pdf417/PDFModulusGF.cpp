@@ -12,6 +12,7 @@ namespace Pdf417 {
 
 ModulusGF::ModulusGF(int modulus, int generator) :
 	_modulus(modulus),
+	_barrett((1 << 21) / modulus),
 	_zero(*this, { 0 }),
 	_one(*this, { 1 })
 {
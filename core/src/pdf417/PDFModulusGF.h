@@ -24,6 +24,7 @@ namespace Pdf417 {
 class ModulusGF
 {
 	int _modulus;
+	int _barrett; // floor(2^21 / modulus), see reduce()
 	std::vector<short> _expTable;
 	std::vector<short> _logTable;
 	ModulusPoly _zero;
@@ -36,6 +37,14 @@ class ModulusGF
 public:
 	ModulusGF(int modulus, int generator);
 
+	// Barrett reduction of 0 <= x <= modulus^2 + modulus (i.e. any a * b + c over field elements),
+	// valid for modulus <= 1022 (x * _barrett stays below 2^31): the quotient estimate
+	// (x * _barrett) >> 21 is off by at most one, which the fast_mod fixes up. One multiply and
+	// shift instead of a division or the exp/log table lookups plus zero-checks in multiply(), and
+	// branchless enough for the compiler to vectorize it in a loop (see the batched polynomial
+	// evaluation in the error correction).
+	int reduce(int x) const { return fast_mod(x - ((x * _barrett) >> 21) * _modulus, _modulus); }
+
 	const ModulusPoly& zero() const {
 		return _zero;
 	}
@@ -49,7 +49,7 @@ ModulusPoly::evaluateAt(int a) const
 		return Reduce(_coefficients, 0, [this](auto res, auto coef) { return _field->add(res, coef); });
 
 	return std::accumulate(_coefficients.begin(), _coefficients.end(), 0,
-						   [this, a](auto res, auto coef) { return _field->add(_field->multiply(a, res), coef); });
+						   [this, a](auto res, auto coef) { return _field->reduce(a * res + coef); });
 }
 
 ModulusPoly
@@ -110,7 +110,7 @@ ModulusPoly::multiply(const ModulusPoly& other) const
 	for (size_t i = 0; i < aLength; i++) {
 		int aCoeff = aCoefficients[i];
 		for (size_t j = 0; j < bLength; j++) {
-			product[i + j] = _field->add(product[i + j], _field->multiply(aCoeff, bCoefficients[j]));
+			product[i + j] = _field->reduce(aCoeff * bCoefficients[j] + product[i + j]);
 		}
 	}
 	return ModulusPoly(*_field, product);
@@ -139,7 +139,7 @@ ModulusPoly::multiply(int scalar) const
 	size_t size = _coefficients.size();
 	std::vector<int> product(size);
 	for (size_t i = 0; i < size; i++) {
-		product[i] = _field->multiply(_coefficients[i], scalar);
+		product[i] = _field->reduce(_coefficients[i] * scalar);
 	}
 	return ModulusPoly(*_field, product);
 }
@@ -156,7 +156,7 @@ ModulusPoly::multiplyByMonomial(int degree, int coefficient) const
 	size_t size = _coefficients.size();
 	std::vector<int> product(size + degree, 0);
 	for (size_t i = 0; i < size; i++) {
-		product[i] = _field->multiply(_coefficients[i], coefficient);
+		product[i] = _field->reduce(_coefficients[i] * coefficient);
 	}
 	return ModulusPoly(*_field, product);
 }
@@ -98,16 +98,23 @@ static Barcodes DoDecode(const BinaryBitmap& image, bool multiple, bool tryRotat
 					return p;
 				}
 			};
+#ifdef ZXING_EXPERIMENTAL_API
+			std::string extra;
+			JsonAppendValue(extra, "Sender", customData->sender);
+			JsonAppendValue(extra, "Addresse", customData->addressee);
+			JsonAppendValue(extra, "FileId", customData->fileId);
+			JsonAppendValue(extra, "FileName", customData->fileName);
+			if (customData->fileSize != -1)
+				JsonAppendValue(extra, "FileSize", customData->fileSize);
+			if (customData->timestamp != -1)
+				JsonAppendValue(extra, "Timestamp", customData->timestamp);
+			if (customData->checksum != -1)
+				JsonAppendValue(extra, "Checksum", customData->checksum);
+#endif
 			auto barcode =
 				Barcode(std::move(decoderResult), DetectorResult{{}, {point(0), point(2), point(3), point(1)}}, BarcodeFormat::PDF417)
 #ifdef ZXING_EXPERIMENTAL_API
-					.addExtra(JsonValue("Sender", customData->sender))
-					.addExtra(JsonValue("Addresse", customData->addressee))
-					.addExtra(JsonValue("FileId", customData->fileId))
-					.addExtra(JsonValue("FileName", customData->fileName))
-					.addExtra(customData->fileSize != -1 ? JsonValue("FileSize", customData->fileSize) : "")
-					.addExtra(customData->timestamp != -1 ? JsonValue("Timestamp", customData->timestamp) : "")
-					.addExtra(customData->checksum != -1 ? JsonValue("Checksum", customData->checksum) : "")
+					.addExtra(std::move(extra))
 #endif
 					;
 			res.push_back(std::move(barcode));
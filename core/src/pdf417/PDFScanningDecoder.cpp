@@ -14,11 +14,14 @@
 #include "PDFDetectionResult.h"
 #include "PDFDecoder.h"
 #include "PDFCustomData.h"
+#include "Matrix.h"
 #include "PDFModulusGF.h"
 #include "ZXAlgorithms.h"
 #include "ZXTestSupport.h"
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 
 namespace ZXing {
 namespace Pdf417 {
@@ -305,12 +308,11 @@ static int GetStartColumn(const DetectionResult& detectionResult, int barcodeCol
 	return leftToRight ? detectionResult.getBoundingBox().value().minX() : detectionResult.getBoundingBox().value().maxX();
 }
 
-static std::vector<std::vector<BarcodeValue>> CreateBarcodeMatrix(DetectionResult& detectionResult)
+// The voting grid is backed by one contiguous Matrix allocation instead of a vector of row vectors:
+// a large symbol has several hundred cells and the grid is rebuilt for every decode attempt.
+static Matrix<BarcodeValue> CreateBarcodeMatrix(DetectionResult& detectionResult)
 {
-	std::vector<std::vector<BarcodeValue>> barcodeMatrix(detectionResult.barcodeRowCount());
-	for (auto& row : barcodeMatrix) {
-		row.resize(detectionResult.barcodeColumnCount() + 2);
-	}
+	Matrix<BarcodeValue> barcodeMatrix(detectionResult.barcodeColumnCount() + 2, detectionResult.barcodeRowCount());
 
 	int column = 0;
 	for (auto& resultColumn : detectionResult.allColumns()) {
@@ -319,11 +321,11 @@ static std::vector<std::vector<BarcodeValue>> CreateBarcodeMatrix(DetectionResul
 				if (codeword != nullptr) {
 					int rowNumber = codeword.value().rowNumber();
 					if (rowNumber >= 0) {
-						if (rowNumber >= Size(barcodeMatrix)) {
+						if (rowNumber >= barcodeMatrix.height()) {
 							// We have more rows than the barcode metadata allows for, ignore them.
 							continue;
 						}
-						barcodeMatrix[rowNumber][column].setValue(codeword.value().value());
+						barcodeMatrix(column, rowNumber).setValue(codeword.value().value());
 					}
 				}
 			}
@@ -338,20 +340,20 @@ static int GetNumberOfECCodeWords(int barcodeECLevel)
 	return 2 << barcodeECLevel;
 }
 
-static bool AdjustCodewordCount(const DetectionResult& detectionResult, std::vector<std::vector<BarcodeValue>>& barcodeMatrix)
+static bool AdjustCodewordCount(const DetectionResult& detectionResult, Matrix<BarcodeValue>& barcodeMatrix)
 {
-	auto numberOfCodewords = barcodeMatrix[0][1].value();
+	auto numberOfCodewords = barcodeMatrix(1, 0).value();
 	int calculatedNumberOfCodewords = detectionResult.barcodeColumnCount() * detectionResult.barcodeRowCount() - GetNumberOfECCodeWords(detectionResult.barcodeECLevel());
 	if (calculatedNumberOfCodewords < 1 || calculatedNumberOfCodewords > CodewordDecoder::MAX_CODEWORDS_IN_BARCODE)
 		calculatedNumberOfCodewords = 0;
 	if (numberOfCodewords.empty()) {
 		if (!calculatedNumberOfCodewords)
 			return false;
-		barcodeMatrix[0][1].setValue(calculatedNumberOfCodewords);
+		barcodeMatrix(1, 0).setValue(calculatedNumberOfCodewords);
 	}
 	else if (calculatedNumberOfCodewords && numberOfCodewords[0] != calculatedNumberOfCodewords) {
 		// The calculated one is more reliable as it is derived from the row indicator columns
-		barcodeMatrix[0][1].setValue(calculatedNumberOfCodewords);
+		barcodeMatrix(1, 0).setValue(calculatedNumberOfCodewords);
 	}
 	return true;
 }
@@ -363,6 +365,26 @@ static const ModulusGF& GetModulusGF()
 	return field;
 }
 
+/**
+* Evaluate the polynomial at a batch of points. The Horner recurrence per point is a loop carried
+* dependency but the points are independent of each other, so with the points in the inner loop
+* the compiler can vectorize the multiply plus Barrett reduction over 32 bit lanes. This serves
+* the syndrome computation and the Chien search below, where the scalar per-coefficient exp/log
+* table lookups dominated the error correction cost on high-ECC symbols.
+*/
+static std::vector<int> EvaluatePolyAt(const ModulusPoly& poly, const std::vector<int>& points)
+{
+	const ModulusGF& field = GetModulusGF();
+	auto& coefficients = poly.coefficients();
+	std::vector<int> results(points.size(), coefficients.front());
+	for (size_t j = 1; j < coefficients.size(); j++) {
+		int coef = coefficients[j];
+		for (size_t i = 0; i < points.size(); i++)
+			results[i] = field.reduce(points[i] * results[i] + coef);
+	}
+	return results;
+}
+
 static bool RunEuclideanAlgorithm(ModulusPoly a, ModulusPoly b, int R, ModulusPoly& sigma, ModulusPoly& omega)
 {
 	const ModulusGF& field = GetModulusGF();
@@ -417,17 +439,19 @@ static bool RunEuclideanAlgorithm(ModulusPoly a, ModulusPoly b, int R, ModulusPo
 static bool FindErrorLocations(const ModulusPoly& errorLocator, std::vector<int>& result)
 {
 	const ModulusGF& field = GetModulusGF();
-	// This is a direct application of Chien's search
+	// This is a direct application of Chien's search, with all candidate locations evaluated in one
+	// vectorizable batch
 	int numErrors = errorLocator.degree();
-	result.resize(numErrors);
-	int e = 0;
-	for (int i = 1; i < field.size() && e < numErrors; i++) {
-		if (errorLocator.evaluateAt(i) == 0) {
-			result[e] = field.inverse(i);
-			e++;
-		}
-	}
-	return e == numErrors;
+	std::vector<int> points(field.size() - 1);
+	std::iota(points.begin(), points.end(), 1);
+	auto evals = EvaluatePolyAt(errorLocator, points);
+	result.clear();
+	result.reserve(numErrors);
+	for (int i = 1; i < field.size() && Size(result) < numErrors; i++) {
+		if (evals[i - 1] == 0)
+			result.push_back(field.inverse(i));
+	}
+	return Size(result) == numErrors;
 }
 
 static std::vector<int> FindErrorMagnitudes(const ModulusPoly& errorEvaluator, const ModulusPoly& errorLocator, const std::vector<int>& errorLocations)
@@ -462,17 +486,12 @@ bool DecodeErrorCorrection(std::vector<int>& received, int numECCodewords, const
 {
 	const ModulusGF& field = GetModulusGF();
 	ModulusPoly poly(field, received);
-	std::vector<int> S(numECCodewords);
-	bool error = false;
-	for (int i = numECCodewords; i > 0; i--) {
-		int eval = poly.evaluateAt(field.exp(i));
-		S[numECCodewords - i] = eval;
-		if (eval != 0) {
-			error = true;
-		}
-	}
+	std::vector<int> points(numECCodewords);
+	for (int i = 0; i < numECCodewords; i++)
+		points[i] = field.exp(numECCodewords - i);
+	std::vector<int> S = EvaluatePolyAt(poly, points);
 
-	if (!error) {
+	if (std::all_of(S.begin(), S.end(), [](int eval) { return eval == 0; })) {
 		nbErrors = 0;
 		return true;
 	}
@@ -654,7 +673,7 @@ static DecoderResult CreateDecoderResult(DetectionResult& detectionResult)
 	std::vector<int> ambiguousIndexesList;
 	for (int row = 0; row < detectionResult.barcodeRowCount(); row++) {
 		for (int column = 0; column < detectionResult.barcodeColumnCount(); column++) {
-			auto values = barcodeMatrix[row][column + 1].value();
+			auto values = barcodeMatrix(column + 1, row).value();
 			int codewordIndex = row * detectionResult.barcodeColumnCount() + column;
 			if (values.empty()) {
 				erasures.push_back(codewordIndex);
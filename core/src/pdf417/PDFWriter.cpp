@@ -167,6 +167,13 @@ Writer::setEncoding(CharacterSet encoding)
 	return *this;
 }
 
+Writer&
+Writer::setOptimalSegmentation(bool enable)
+{
+	_encoder->setOptimalSegmentation(enable);
+	return *this;
+}
+
 
 } // Pdf417
 } // ZXing
@@ -60,6 +60,12 @@ public:
 	*/
 	Writer& setEncoding(CharacterSet encoding);
 
+	/**
+	* @param enable if true, AUTO compaction chooses the Text/Byte/Numeric boundaries by a codeword
+	* count minimizing dynamic program instead of the annex P lookahead heuristic
+	*/
+	Writer& setOptimalSegmentation(bool enable);
+
 
 	BitMatrix encode(const std::wstring& contents, int width, int height) const;
 	BitMatrix encode(const std::string& contents, int width, int height) const;
@@ -13,8 +13,9 @@
 #include "QRDataMask.h"
 #include "QRFormatInformation.h"
 #include "QRVersion.h"
+#include "ZXConfig.h"
 
-#include <utility>
+#include <vector>
 
 namespace ZXing::QRCode {
 
@@ -23,6 +24,19 @@ static bool getBit(const BitMatrix& bitMatrix, int x, int y, bool mirrored = fal
 	return mirrored ? bitMatrix.get(y, x) : bitMatrix.get(x, y);
 }
 
+// The function pattern mask only depends on the (static) Version object. When scanning a video stream,
+// the same symbol is decoded over and over again for many consecutive frames, so remember the last one
+// instead of building a fresh BitMatrix for every decode attempt.
+static const BitMatrix& FunctionPattern(const Version& version)
+{
+	ZX_THREAD_LOCAL struct { const Version* version = nullptr; BitMatrix pattern; } cache;
+	if (cache.version != &version) {
+		cache.pattern = version.buildFunctionPattern();
+		cache.version = &version;
+	}
+	return cache.pattern;
+}
+
 const Version* ReadVersion(const BitMatrix& bitMatrix, Type type)
 {
 	assert(Version::HasValidSize(bitMatrix));
@@ -95,19 +109,76 @@ FormatInformation ReadFormatInformation(const BitMatrix& bitMatrix)
 	for (int x = dimension - 8; x < dimension; x++)
 		AppendBit(formatInfoBits2, getBit(bitMatrix, x, 8));
 
-	return FormatInformation::DecodeQR(formatInfoBits1, formatInfoBits2);
+	// Same frame-to-frame reasoning as in FunctionPattern above: remember the last raw format info bits
+	// and skip the BCH matching when they did not change. Since the key is the complete raw input of
+	// DecodeQR, a cache hit is indistinguishable from a fresh decode.
+	ZX_THREAD_LOCAL struct { int bits1 = -1, bits2 = -1; FormatInformation fi; } cache;
+	if (cache.bits1 != formatInfoBits1 || cache.bits2 != formatInfoBits2) {
+		cache.fi = FormatInformation::DecodeQR(formatInfoBits1, formatInfoBits2);
+		cache.bits1 = formatInfoBits1;
+		cache.bits2 = formatInfoBits2;
+	}
+	return cache.fi;
 }
 
-static ByteArray ReadQRCodewords(const BitMatrix& bitMatrix, const Version& version, const FormatInformation& formatInfo)
+// Flat per-Version extraction table for Model2 symbols: the byte packed coordinates of all data
+// modules in zigzag reading order and the data mask bits packed into bytes in the same order. With
+// this, reading one codeword is 8 unchecked BitMatrix::get calls plus one XOR, with no per-module
+// function pattern test or mask computation left. Cached like FunctionPattern above, since decoding a
+// video stream or a Structured Append sheet extracts many symbols of the same version in a row.
+struct ExtractionTable
 {
-	BitMatrix functionPattern = version.buildFunctionPattern();
+	std::vector<uint8_t> coords; // x,y pairs, 16 bytes per codeword (dimension is at most 177)
+	std::vector<uint8_t> maskBytes;
+};
 
+static void FillMaskBytes(ExtractionTable& t, int dataMask, bool isMicro = false)
+{
+	t.maskBytes.clear();
+	t.maskBytes.reserve(t.coords.size() / 16);
+	for (int i = 0; i < Size(t.coords); i += 16) {
+		uint8_t b = 0;
+		for (int j = 0; j < 16; j += 2)
+			AppendBit(b, GetDataMaskBit(dataMask, t.coords[i + j], t.coords[i + j + 1], isMicro));
+		t.maskBytes.push_back(b);
+	}
+}
+
+static ByteArray ReadCodewordsViaTable(const BitMatrix& bitMatrix, const ExtractionTable& table, bool mirrored)
+{
 	ByteArray result;
-	result.reserve(version.totalCodewords());
-	uint8_t currentByte = 0;
+	result.reserve(Size(table.maskBytes));
+	const uint8_t* c = table.coords.data();
+	if (mirrored)
+		for (uint8_t mask : table.maskBytes) {
+			uint8_t b = 0;
+			for (int j = 0; j < 8; ++j, c += 2)
+				AppendBit(b, bitMatrix.get(c[1], c[0]));
+			result.push_back(b ^ mask);
+		}
+	else
+		for (uint8_t mask : table.maskBytes) {
+			uint8_t b = 0;
+			for (int j = 0; j < 8; ++j, c += 2)
+				AppendBit(b, bitMatrix.get(c[0], c[1]));
+			result.push_back(b ^ mask);
+		}
+
+	return result;
+}
+
+static const ExtractionTable& Model2ExtractionTable(const Version& version, int dataMask)
+{
+	ZX_THREAD_LOCAL struct { const Version* version = nullptr; int dataMask = -1; ExtractionTable table; } cache;
+	if (cache.version == &version && cache.dataMask == dataMask)
+		return cache.table;
+
+	const BitMatrix& functionPattern = FunctionPattern(version);
+	auto& t = cache.table;
+	int dimension = version.dimension();
+	t.coords.clear();
+	t.coords.reserve(2 * 8 * version.totalCodewords());
 	bool readingUp = true;
-	int bitsRead = 0;
-	int dimension = bitMatrix.height();
 	// Read columns in pairs, from right to left
 	for (int x = dimension - 1; x > 0; x -= 2) {
 		// Skip whole column with vertical timing pattern.
@@ -120,21 +191,29 @@ static ByteArray ReadQRCodewords(const BitMatrix& bitMatrix, const Version& vers
 				int xx = x - col;
 				// Ignore bits covered by the function pattern
 				if (!functionPattern.get(xx, y)) {
-					// Read a bit
-					AppendBit(currentByte,
-							  GetDataMaskBit(formatInfo.dataMask, xx, y) != getBit(bitMatrix, xx, y, formatInfo.isMirrored));
-					// If we've made a whole byte, save it off
-					if (++bitsRead % 8 == 0)
-						result.push_back(std::exchange(currentByte, 0));
+					t.coords.push_back(narrow_cast<uint8_t>(xx));
+					t.coords.push_back(narrow_cast<uint8_t>(y));
 				}
 			}
 		}
 		readingUp = !readingUp; // switch directions
 	}
-	if (Size(result) != version.totalCodewords())
+	// drop the remainder bits that never make it into a full codeword
+	t.coords.resize(2 * 8 * version.totalCodewords());
+
+	FillMaskBytes(t, dataMask);
+
+	cache.version = &version;
+	cache.dataMask = dataMask;
+	return t;
+}
+
+static ByteArray ReadQRCodewords(const BitMatrix& bitMatrix, const Version& version, const FormatInformation& formatInfo)
+{
+	if (bitMatrix.height() != version.dimension())
 		return {};
 
-	return result;
+	return ReadCodewordsViaTable(bitMatrix, Model2ExtractionTable(version, formatInfo.dataMask), formatInfo.isMirrored);
 }
 
 static ByteArray ReadQRCodewordsModel1(const BitMatrix& bitMatrix, const Version& version, const FormatInformation& formatInfo)
@@ -196,23 +275,27 @@ static ByteArray ReadQRCodewordsModel1(const BitMatrix& bitMatrix, const Version
 	return result;
 }
 
-static ByteArray ReadMQRCodewords(const BitMatrix& bitMatrix, const QRCode::Version& version, const FormatInformation& formatInfo)
+// Micro QR variant of the Model2 table: codewords have individual bit counts, since D3 in a
+// Version M1 symbol, D11 in a Version M3-L symbol and D9 in a Version M3-M symbol is a 2x2 square
+// 4-module block (see ISO 18004:2006 6.7.3) whose index depends on the error correction level.
+struct MQRExtractionTable
 {
-	BitMatrix functionPattern = version.buildFunctionPattern();
-
-	// D3 in a Version M1 symbol, D11 in a Version M3-L symbol and D9
-	// in a Version M3-M symbol is a 2x2 square 4-module block.
-	// See ISO 18004:2006 6.7.3.
-	bool hasD4mBlock = version.versionNumber() % 2 == 1;
-	int d4mBlockIndex =
-		version.versionNumber() == 1 ? 3 : (formatInfo.ecLevel == QRCode::ErrorCorrectionLevel::Low ? 11 : 9);
+	std::vector<uint8_t> coords;
+	std::vector<uint8_t> maskBytes;
+	std::vector<uint8_t> codewordBits;
+};
 
-	ByteArray result;
-	result.reserve(version.totalCodewords());
-	uint8_t currentByte = 0;
+static const MQRExtractionTable& MicroExtractionTable(const Version& version, const FormatInformation& formatInfo)
+{
+	ZX_THREAD_LOCAL struct { const Version* version = nullptr; int dataMask = -1; int ecLevel = -1; MQRExtractionTable table; } cache;
+	if (cache.version == &version && cache.dataMask == formatInfo.dataMask && cache.ecLevel == (int)formatInfo.ecLevel)
+		return cache.table;
+
+	const BitMatrix& functionPattern = FunctionPattern(version);
+	auto& t = cache.table;
+	int dimension = version.dimension();
+	t.coords.clear();
 	bool readingUp = true;
-	int bitsRead = 0;
-	int dimension = bitMatrix.height();
 	// Read columns in pairs, from right to left
 	for (int x = dimension - 1; x > 0; x -= 2) {
 		// Read alternatingly from bottom to top then top to bottom
@@ -222,37 +305,72 @@ static ByteArray ReadMQRCodewords(const BitMatrix& bitMatrix, const QRCode::Vers
 				int xx = x - col;
 				// Ignore bits covered by the function pattern
 				if (!functionPattern.get(xx, y)) {
-					// Read a bit
-					AppendBit(currentByte,
-							  GetDataMaskBit(formatInfo.dataMask, xx, y, true) != getBit(bitMatrix, xx, y, formatInfo.isMirrored));
-					++bitsRead;
-					// If we've made a whole byte, save it off; save early if 2x2 data block.
-					if (bitsRead == 8 || (bitsRead == 4 && hasD4mBlock && Size(result) == d4mBlockIndex - 1)) {
-						result.push_back(std::exchange(currentByte, 0));
-						bitsRead = 0;
-					}
+					t.coords.push_back(narrow_cast<uint8_t>(xx));
+					t.coords.push_back(narrow_cast<uint8_t>(y));
 				}
 			}
 		}
 		readingUp = !readingUp; // switch directions
 	}
-	if (Size(result) != version.totalCodewords())
-		return {};
 
-	return result;
+	bool hasD4mBlock = version.versionNumber() % 2 == 1;
+	int d4mBlockIndex = version.versionNumber() == 1 ? 3 : (formatInfo.ecLevel == ErrorCorrectionLevel::Low ? 11 : 9);
+
+	t.maskBytes.clear();
+	t.codewordBits.clear();
+	const uint8_t* c = t.coords.data();
+	const uint8_t* cEnd = c + t.coords.size();
+	for (int i = 0; i < version.totalCodewords(); ++i) {
+		int bits = hasD4mBlock && i == d4mBlockIndex - 1 ? 4 : 8;
+		if (c + 2 * bits > cEnd) { // not enough data modules for all codewords, mark the table invalid
+			t.maskBytes.clear();
+			break;
+		}
+		uint8_t b = 0;
+		for (int j = 0; j < bits; ++j, c += 2)
+			AppendBit(b, GetDataMaskBit(formatInfo.dataMask, c[0], c[1], true));
+		t.maskBytes.push_back(b);
+		t.codewordBits.push_back(narrow_cast<uint8_t>(bits));
+	}
+
+	cache.version = &version;
+	cache.dataMask = formatInfo.dataMask;
+	cache.ecLevel = (int)formatInfo.ecLevel;
+	return t;
 }
 
-static ByteArray ReadRMQRCodewords(const BitMatrix& bitMatrix, const Version& version, const FormatInformation& formatInfo)
+static ByteArray ReadMQRCodewords(const BitMatrix& bitMatrix, const QRCode::Version& version, const FormatInformation& formatInfo)
 {
-	BitMatrix functionPattern = version.buildFunctionPattern();
+	if (bitMatrix.height() != version.dimension())
+		return {};
+
+	const auto& table = MicroExtractionTable(version, formatInfo);
 
 	ByteArray result;
-	result.reserve(version.totalCodewords());
-	uint8_t currentByte = 0;
+	result.reserve(Size(table.maskBytes));
+	const uint8_t* c = table.coords.data();
+	for (int i = 0; i < Size(table.maskBytes); ++i) {
+		uint8_t b = 0;
+		for (int j = 0; j < table.codewordBits[i]; ++j, c += 2)
+			AppendBit(b, formatInfo.isMirrored ? bitMatrix.get(c[1], c[0]) : bitMatrix.get(c[0], c[1]));
+		result.push_back(b ^ table.maskBytes[i]);
+	}
+	return result;
+}
+
+static const ExtractionTable& RMQRExtractionTable(const Version& version, int dataMask)
+{
+	ZX_THREAD_LOCAL struct { const Version* version = nullptr; int dataMask = -1; ExtractionTable table; } cache;
+	if (cache.version == &version && cache.dataMask == dataMask)
+		return cache.table;
+
+	const BitMatrix& functionPattern = FunctionPattern(version);
+	auto& t = cache.table;
+	const int width = functionPattern.width();
+	const int height = functionPattern.height();
+	t.coords.clear();
+	t.coords.reserve(2 * 8 * version.totalCodewords());
 	bool readingUp = true;
-	int bitsRead = 0;
-	const int width = bitMatrix.width();
-	const int height = bitMatrix.height();
 	// Read columns in pairs, from right to left
 	for (int x = width - 1 - 1; x > 0; x -= 2) { // Skip right edge alignment
 		// Read alternatingly from bottom to top then top to bottom
@@ -262,21 +380,30 @@ static ByteArray ReadRMQRCodewords(const BitMatrix& bitMatrix, const Version& ve
 				int xx = x - col;
 				// Ignore bits covered by the function pattern
 				if (!functionPattern.get(xx, y)) {
-					// Read a bit
-					AppendBit(currentByte,
-							  GetDataMaskBit(formatInfo.dataMask, xx, y) != getBit(bitMatrix, xx, y, formatInfo.isMirrored));
-					// If we've made a whole byte, save it off
-					if (++bitsRead % 8 == 0)
-						result.push_back(std::exchange(currentByte, 0));
+					t.coords.push_back(narrow_cast<uint8_t>(xx));
+					t.coords.push_back(narrow_cast<uint8_t>(y));
 				}
 			}
 		}
 		readingUp = !readingUp; // switch directions
 	}
-	if (Size(result) != version.totalCodewords())
+	// drop the remainder bits that never make it into a full codeword
+	t.coords.resize(2 * 8 * version.totalCodewords());
+
+	FillMaskBytes(t, dataMask);
+
+	cache.version = &version;
+	cache.dataMask = dataMask;
+	return t;
+}
+
+static ByteArray ReadRMQRCodewords(const BitMatrix& bitMatrix, const Version& version, const FormatInformation& formatInfo)
+{
+	const BitMatrix& functionPattern = FunctionPattern(version);
+	if (bitMatrix.width() != functionPattern.width() || bitMatrix.height() != functionPattern.height())
 		return {};
 
-	return result;
+	return ReadCodewordsViaTable(bitMatrix, RMQRExtractionTable(version, formatInfo.dataMask), formatInfo.isMirrored);
 }
 
 ByteArray ReadCodewords(const BitMatrix& bitMatrix, const Version& version, const FormatInformation& formatInfo)
@@ -19,6 +19,7 @@
 #include "QRVersion.h"
 #include "ReedSolomonDecoder.h"
 #include "StructuredAppend.h"
+#include "ThreadPool.h"
 #include "ZXAlgorithms.h"
 #include "ZXTestSupport.h"
 
@@ -27,6 +28,13 @@
 #include <utility>
 #include <vector>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include "DetectorResult.h"
+
+#include <atomic>
+#include <thread>
+#endif
+
 namespace ZXing::QRCode {
 
 /**
@@ -35,16 +43,19 @@ namespace ZXing::QRCode {
 *
 * @param codewordBytes data and error correction codewords
 * @param numDataCodewords number of codewords that are data bytes
+* @param nbErrors incremented by the number of corrected codewords, feeds the print quality grade
 * @return false if error correction fails
 */
-static bool CorrectErrors(ByteArray& codewordBytes, int numDataCodewords)
+static bool CorrectErrors(ByteArray& codewordBytes, int numDataCodewords, int& nbErrors)
 {
 	// First read into an array of ints
 	std::vector<int> codewordsInts(codewordBytes.begin(), codewordBytes.end());
 
 	int numECCodewords = Size(codewordBytes) - numDataCodewords;
-	if (!ReedSolomonDecode(GenericGF::QRCodeField256(), codewordsInts, numECCodewords))
+	int nbBlockErrors = 0;
+	if (!ReedSolomonDecode(GenericGF::QRCodeField256(), codewordsInts, numECCodewords, {}, &nbBlockErrors))
 		return false;
+	nbErrors += nbBlockErrors;
 
 	// Copy back into array of bytes -- only need to worry about the bytes that were data
 	// We don't care about errors in the error-correction codewords
@@ -317,7 +328,7 @@ DecoderResult DecodeBitStream(ByteArray&& bytes, const Version& version, ErrorCo
 		.setStructuredAppend(structuredAppend);
 }
 
-DecoderResult Decode(const BitMatrix& bits)
+DecoderResult Decode(const BitMatrix& bits, int maxThreads [[maybe_unused]])
 {
 	if (!Version::HasValidSize(bits))
 		return FormatError("Invalid symbol size");
@@ -350,27 +361,104 @@ DecoderResult Decode(const BitMatrix& bits)
 
 	// Error-correct and copy data blocks together into a stream of bytes
 	Error error;
+	int ecErrors = 0; // total number of corrected codewords, feeds the print quality grade below
+#ifdef ZXING_EXPERIMENTAL_API
+	// The block corrections are fully independent and large high-ECC symbols are the worst
+	// single-symbol latency case (a version 40 QR code has up to 81 blocks). Dispatch them to worker
+	// threads when the caller grants a thread budget, i.e. when it is not running whole candidates
+	// on worker threads already (see QRReader). At least 4 blocks per thread keep the dispatch
+	// overhead small; the copy into the result stream stays in block order on this thread.
+	int nThreads = std::clamp(maxThreads ? maxThreads : int(std::thread::hardware_concurrency()), 1, Size(dataBlocks) / 4);
+	if (nThreads > 1) {
+		std::atomic<int> next = 0, corrected = 0;
+		std::atomic<bool> failed = false;
+		auto worker = [&]() {
+			int nbErrors = 0;
+			for (int i = next++; i < Size(dataBlocks); i = next++)
+				if (!CorrectErrors(dataBlocks[i].codewords(), dataBlocks[i].numDataCodewords(), nbErrors))
+					failed = true;
+			corrected += nbErrors;
+		};
+		RunParallel(nThreads, worker);
+
+		ecErrors = corrected;
+		if (failed)
+			error = ChecksumError();
+		for (auto& dataBlock : dataBlocks)
+			resultIterator = std::copy_n(dataBlock.codewords().begin(), dataBlock.numDataCodewords(), resultIterator);
+	} else
+#endif
 	for (auto& dataBlock : dataBlocks)
 	{
 		ByteArray& codewordBytes = dataBlock.codewords();
 		int numDataCodewords = dataBlock.numDataCodewords();
 
-		if (!CorrectErrors(codewordBytes, numDataCodewords))
+		// Fast-fail gate: misdetected candidates (e.g. false finder pattern sets on textured
+		// background) virtually never fail in just a single block. Once one block is beyond repair,
+		// the result carries a ChecksumError either way, so don't burn Reed-Solomon time on the
+		// remaining blocks and pass their data codewords through uncorrected - which is exactly what
+		// a failed correction attempt leaves behind as well.
+		if (error || !CorrectErrors(codewordBytes, numDataCodewords, ecErrors))
 			error = ChecksumError();
 
 		resultIterator = std::copy_n(codewordBytes.begin(), numDataCodewords, resultIterator);
 	}
 
+	// Decode the contents of that stream of bytes
+	auto ret = DecodeBitStream(std::move(resultBytes), version, formatInfo.ecLevel).setIsMirrored(formatInfo.isMirrored);
+#ifdef ZXING_EXPERIMENTAL_API
+	// The json extras are only consumed by the experimental Barcode::extra() API; keep the string
+	// formatting and allocations out of the per-symbol hot path otherwise.
 	auto versionStr = version.isRMQR() ? "R" + ToString(Version::SymbolSize(version.versionNumber(), version.type()), true)
 									   : (version.isMicro() ? "M" : "") + std::to_string(version.versionNumber());
-
-	// Decode the contents of that stream of bytes
-	auto ret = DecodeBitStream(std::move(resultBytes), version, formatInfo.ecLevel)
-		.setIsMirrored(formatInfo.isMirrored)
-		.setJson(JsonValue("DataMask", formatInfo.dataMask) + JsonValue("Version", versionStr));
+	std::string json;
+	JsonAppendValue(json, "DataMask", formatInfo.dataMask);
+	JsonAppendValue(json, "Version", versionStr);
+	// ISO/IEC 15415 style "unused error correction" grade, computed from the Reed-Solomon
+	// correction counts the decode produced anyway. This is no substitute for a full verifier (no
+	// reflectance measurements are involved), but it grades how much of the error budget the
+	// symbol consumed and thereby flags degrading print quality before reading starts to fail.
+	if (int numECCodewords = Size(codewords) - totalBytes; !error && numECCodewords) {
+		float uec = 1.0f - 2.0f * ecErrors / numECCodewords;
+		JsonAppendValue(json, "ECErrorsCorrected", ecErrors);
+		JsonAppendValue(json, "UECGrade", uec >= 0.62f ? 4 : uec >= 0.50f ? 3 : uec >= 0.37f ? 2 : uec >= 0.25f ? 1 : 0);
+	}
+	ret.setJson(std::move(json));
+#endif
 	if (error)
 		ret.setError(error);
 	return ret;
 }
 
+#ifdef ZXING_EXPERIMENTAL_API
+DecoderResult Decode(const DetectorResult& detectorResult, int maxThreads)
+{
+	auto res = Decode(detectorResult.bits(), maxThreads);
+
+	// Soft-decision retry: the sampler recorded the modules whose binarized neighborhood was not
+	// unanimous (see SampleGrid), i.e. the ones most likely sampled wrong. Flipping them one more per
+	// attempt (least confident first) walks the grid towards the neighborhood majority vote and costs
+	// a handful of decode attempts at worst - two orders of magnitude less than the re-binarize +
+	// re-detect cycle of the invert/close/other-pyramid-layer escalation it tries to avoid. Format or
+	// version failures are not retried, those grids are misdetections rather than marginal samples.
+	if (res.error().type() == Error::Type::Checksum && !detectorResult.weakModules().empty()) {
+		auto bits = detectorResult.bits().copy();
+		for (auto& p : detectorResult.weakModules()) {
+			bits.flip(p.x, p.y);
+			if (auto retry = Decode(bits, maxThreads); retry.isValid()) {
+				res = std::move(retry);
+				break;
+			}
+		}
+	}
+
+	// the number of marginally sampled modules (see SampleGrid) doubles as a cheap modulation proxy
+	// next to the UECGrade of the plain Decode() above
+	if (res.isValid() && !detectorResult.weakModules().empty())
+		res.setJson(std::move(res).json() + JsonValue("WeakModules", Size(detectorResult.weakModules())));
+
+	return res;
+}
+#endif
+
 } // namespace ZXing::QRCode
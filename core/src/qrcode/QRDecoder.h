@@ -10,10 +10,28 @@ namespace ZXing {
 
 class DecoderResult;
 class BitMatrix;
+#ifdef ZXING_EXPERIMENTAL_API
+class DetectorResult;
+#endif
 
 namespace QRCode {
 
-DecoderResult Decode(const BitMatrix& bits);
+/**
+ * @param maxThreads thread budget for correcting the data blocks of large symbols in parallel
+ *  (0 means hardware concurrency); pass 1 when the caller runs on a worker thread itself
+ */
+DecoderResult Decode(const BitMatrix& bits, int maxThreads = 1);
+
+#ifdef ZXING_EXPERIMENTAL_API
+/**
+ * Soft-decision variant: on a checksum failure, retries with the least confident modules of the
+ * sampled grid (see DetectorResult::weakModules) flipped one more per attempt before the pipeline
+ * escalates to the much more expensive invert/close/other-pyramid-layer passes.
+ *
+ * WARNING: this API is experimental and may change/disappear
+ */
+DecoderResult Decode(const DetectorResult& detectorResult, int maxThreads = 1);
+#endif
 
 } // QRCode
 } // ZXing
@@ -12,22 +12,32 @@
 #include "BitMatrix.h"
 #include "BitMatrixCursor.h"
 #include "ConcentricFinder.h"
+#include "DecodeCounters.h"
 #include "GridSampler.h"
 #include "LogMatrix.h"
 #include "Pattern.h"
 #include "QRFormatInformation.h"
 #include "QRVersion.h"
 #include "Quadrilateral.h"
+#include "BitHacks.h"
 #include "RegressionLine.h"
+#include "ThreadPool.h"
 
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <map>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include <atomic>
+#include <thread>
+#endif
+
 #ifdef PRINT_DEBUG
 #include "BitMatrixIO.h"
 #else
@@ -49,57 +59,91 @@ PatternView FindPattern(const PatternView& view)
 	});
 }
 
-std::vector<ConcentricPattern> FindFinderPatterns(const BitMatrix& image, bool tryHarder)
+void FindFinderPatternsInRow(const BitMatrix& image, const PatternRow& row, int y, FinderPatterns& res)
+{
+	PatternView next = row;
+
+	while (next = FindPattern(next), next.isValid()) {
+		PointF p(next.pixelsInFront() + next[0] + next[1] + next[2] / 2.0, y + 0.5);
+
+		// make sure p is not 'inside' an already found pattern area
+		if (FindIf(res, [p](const auto& old) { return distance(p, old) < old.size / 2; }) == res.end()) {
+			log(p);
+			auto pattern = LocateConcentricPattern<E2E>(image, PATTERN, p,
+														next.sum() * 3); // 3 for very skewed samples
+			if (pattern) {
+				log(*pattern, 3);
+				log(*pattern + PointF(.2, 0), 3);
+				log(*pattern - PointF(.2, 0), 3);
+				log(*pattern + PointF(0, .2), 3);
+				log(*pattern - PointF(0, .2), 3);
+				assert(image.get(pattern->x, pattern->y));
+				res.push_back(*pattern);
+			}
+		}
+
+		next.skipPair();
+		next.skipPair();
+		next.extend();
+	}
+}
+
+static FinderPatterns FindFinderPatternsInRows(const BitMatrix& image, int skip, int rowBegin, int rowEnd)
 {
-	constexpr int MIN_SKIP         = 3;           // 1 pixel/module times 3 modules/center
-	constexpr int MAX_MODULES_FAST = 20 * 4 + 17; // support up to version 20 for mobile clients
+	FinderPatterns res;
+	PatternRow row;
+
+	// first row of the skip-grid inside [rowBegin, rowEnd)
+	int firstRow = rowBegin / skip * skip + skip - 1;
+
+	for (int y = firstRow; y < rowEnd; y += skip) {
+		GetPatternRow(image, y, row, false);
+		FindFinderPatternsInRow(image, row, y, res);
+	}
+
+	return res;
+}
 
-	// Let's assume that the maximum version QR Code we support takes up 1/4 the height of the
+FinderPatterns FindFinderPatterns(const BitMatrix& image, bool tryHarder, int maxThreads, int maxVerticalModules)
+{
+	constexpr int MIN_SKIP = 3; // 1 pixel/module times 3 modules/center
+
+	// Let's assume that the maximum version symbol we are looking for takes up 1/4 the height of the
 	// image, and then account for the center being 3 modules in size. This gives the smallest
 	// number of pixels the center could be, so skip this often. When trying harder, look for all
 	// QR versions regardless of how dense they are.
 	int height = image.height();
-	int skip = (3 * height) / (4 * MAX_MODULES_FAST);
+	int skip = (3 * height) / (4 * maxVerticalModules);
 	if (skip < MIN_SKIP || tryHarder)
 		skip = MIN_SKIP;
 
-	std::vector<ConcentricPattern> res;
-	[[maybe_unused]] int N = 0;
-	PatternRow row;
-
-	for (int y = skip - 1; y < height; y += skip) {
-		GetPatternRow(image, y, row, false);
-		PatternView next = row;
-
-		while (next = FindPattern(next), next.isValid()) {
-			PointF p(next.pixelsInFront() + next[0] + next[1] + next[2] / 2.0, y + 0.5);
-
-			// make sure p is not 'inside' an already found pattern area
-			if (FindIf(res, [p](const auto& old) { return distance(p, old) < old.size / 2; }) == res.end()) {
-				log(p);
-				N++;
-				auto pattern = LocateConcentricPattern<E2E>(image, PATTERN, p,
-															next.sum() * 3); // 3 for very skewed samples
-				if (pattern) {
-					log(*pattern, 3);
-					log(*pattern + PointF(.2, 0), 3);
-					log(*pattern - PointF(.2, 0), 3);
-					log(*pattern + PointF(0, .2), 3);
-					log(*pattern - PointF(0, .2), 3);
-					assert(image.get(pattern->x, pattern->y));
-					res.push_back(*pattern);
-				}
-			}
-
-			next.skipPair();
-			next.skipPair();
-			next.extend();
-		}
+#ifdef ZXING_EXPERIMENTAL_API
+	// Partitioned mode: each worker sweeps a contiguous band of the row grid with its own candidate
+	// list. A pattern close to a band boundary may be located by two workers, so the merge below
+	// applies the same 'inside an already found pattern' test that is used within a band. Bands are
+	// kept at least 16 grid rows tall to bound the duplicated location work.
+	int nThreads = std::clamp(maxThreads ? maxThreads : int(std::thread::hardware_concurrency()), 1,
+							  std::max(1, height / (16 * skip)));
+	if (nThreads > 1) {
+		int band = (height + nThreads - 1) / nThreads;
+		std::vector<FinderPatterns> bands(nThreads);
+		std::atomic<int> next = 0;
+		RunParallel(nThreads, [&] {
+			for (int i = next++; i < nThreads; i = next++)
+				bands[i] = FindFinderPatternsInRows(image, skip, i * band, std::min((i + 1) * band, height));
+		});
+		FinderPatterns res;
+		for (auto& bandRes : bands)
+			for (auto& fp : bandRes)
+				if (FindIf(res, [p = PointF(fp)](const auto& old) { return distance(p, old) < old.size / 2; }) == res.end())
+					res.push_back(fp);
+		return res;
 	}
+#else
+	(void)maxThreads;
+#endif
 
-	printf("FPs?  : %d\n", N);
-
-	return res;
+	return FindFinderPatternsInRows(image, skip, 0, height);
 }
 
 /**
@@ -123,12 +167,62 @@ FinderPatternSets GenerateFinderPatternSets(FinderPatterns& patterns)
 	const double cosLower = std::cos(135. / 180 * 3.1415);
 
 	int nbPatterns = Size(patterns);
+
+	// Bucket the candidate centers into a coarse grid so that for each pattern only partners within
+	// plausible mutual distance are enumerated. Any two patterns of one symbol are at most the symbol
+	// diagonal apart, which the moduleCount test below bounds by (2 * sumSizes / 21) * (177 * 1.5 - 7)
+	// with all three sizes limited to twice the smallest one. This turns the O(n^3) triple scan into a
+	// near linear one on frames where dense text produces many spread out false candidates.
+	auto maxDist = [](int size) { return 148. * size; };
+
+	// The grid is stored 'CSR style': one shared index array ordered by cell plus per-cell offsets,
+	// built with a counting sort. Compared to a map of per-cell vectors this performs no per-cell
+	// allocation and the neighborhood enumeration below walks contiguous memory.
+	const int cellSize = nbPatterns ? std::max(1, int(maxDist(patterns.front().size))) : 1;
+	int gridWidth = 1, gridHeight = 1;
+	for (const auto& p : patterns) {
+		gridWidth = std::max(gridWidth, int(std::max(0., p.x)) / cellSize + 1);
+		gridHeight = std::max(gridHeight, int(std::max(0., p.y)) / cellSize + 1);
+	}
+	auto cellOf = [&](double x, double y) {
+		return std::pair(std::clamp(int(std::max(0., x)) / cellSize, 0, gridWidth - 1),
+						 std::clamp(int(std::max(0., y)) / cellSize, 0, gridHeight - 1));
+	};
+	auto cellIndex = [&](const PointF& p) {
+		auto [cx, cy] = cellOf(p.x, p.y);
+		return cy * gridWidth + cx;
+	};
+	std::vector<int> cellStart(gridWidth * gridHeight + 1, 0), cellItems(nbPatterns);
+	for (const auto& p : patterns)
+		++cellStart[cellIndex(p) + 1];
+	std::partial_sum(cellStart.begin(), cellStart.end(), cellStart.begin());
+	for (int i = 0; i < nbPatterns; ++i)
+		cellItems[cellStart[cellIndex(patterns[i])]++] = i;
+	std::rotate(cellStart.begin(), cellStart.end() - 1, cellStart.end());
+	cellStart.front() = 0;
+
+	std::vector<int> nbrs;
 	for (int i = 0; i < nbPatterns - 2; i++) {
-		for (int j = i + 1; j < nbPatterns - 1; j++) {
-			for (int k = j + 1; k < nbPatterns - 0; k++) {
+		const double d = maxDist(patterns[i].size);
+		nbrs.clear();
+		auto [cx0, cy0] = cellOf(patterns[i].x - d, patterns[i].y - d);
+		auto [cx1, cy1] = cellOf(patterns[i].x + d, patterns[i].y + d);
+		for (int cy = cy0; cy <= cy1; ++cy)
+			for (int cx = cx0; cx <= cx1; ++cx)
+				for (int c = cy * gridWidth + cx, s = cellStart[c]; s < cellStart[c + 1]; ++s)
+					if (int l = cellItems[s]; l > i && distance(patterns[l], patterns[i]) <= d)
+						nbrs.push_back(l);
+		// keep the size sorted enumeration order of the full triple scan
+		std::sort(nbrs.begin(), nbrs.end());
+
+		for (int jj = 0; jj < Size(nbrs) - 1; jj++) {
+			for (int kk = jj + 1; kk < Size(nbrs); kk++) {
+				int j = nbrs[jj], k = nbrs[kk];
 				const auto* a = &patterns[i];
 				const auto* b = &patterns[j];
 				const auto* c = &patterns[k];
+				if (distance(*b, *c) > d)
+					continue;
 				// if the pattern sizes are too different to be part of the same symbol, skip this
 				// and the rest of the innermost loop (sorted list)
 				if (c->size > a->size * 2)
@@ -198,7 +292,7 @@ FinderPatternSets GenerateFinderPatternSets(FinderPatterns& patterns)
 	for (auto& [d, s] : sets)
 		res.push_back(s);
 
-	printf("FPSets: %d\n", Size(res));
+	detail::decodeCounters.symbolCandidates += Size(res);
 
 	return res;
 }
@@ -343,6 +437,38 @@ static const Version* ReadVersion(const BitMatrix& image, int dimension, const P
 	return Version::DecodeVersionInformation(bits[0], bits[1]);
 }
 
+/**
+* Cheap plausibility check of a sampled grid before it is handed to the decoder: the modules of the
+* timing patterns in row and column 6 between the finder patterns alternate by definition. The grid
+* stores one byte per module in contiguous rows, so the row is checked 8 modules at a time against
+* the expected alternation with an XOR + popcount. Damaged symbols may get individual timing modules
+* wrong (they carry no error correction), so only grids with more than a quarter of them wrong are
+* rejected - the textured false candidates this weeds out before the format info read and Reed-
+* Solomon stage come in at about half.
+*/
+static bool CheckTimingPattern(const BitMatrix& bits)
+{
+	const int from = 8, to = bits.width() - 8;
+	int wrong = 0;
+
+	// row 6, starting at the (even, hence black) module 8: expected bytes ff 00 ff 00 ...
+	const auto* row = bits.row(6).begin();
+	int x = from;
+	for (; x + 8 <= to; x += 8) {
+		uint64_t v;
+		memcpy(&v, row + x, sizeof(v));
+		v ^= UINT64_C(0x00ff00ff00ff00ff);
+		wrong += (BitHacks::CountBitsSet(uint32_t(v)) + BitHacks::CountBitsSet(uint32_t(v >> 32))) / 8;
+	}
+	for (; x < to; ++x)
+		wrong += bits.get(x, 6) != (x % 2 == 0);
+
+	for (int y = from; y < to; ++y)
+		wrong += bits.get(6, y) != (y % 2 == 0);
+
+	return wrong * 4 <= 2 * (to - from);
+}
+
 DetectorResult SampleQR(const BitMatrix& image, const FinderPatternSet& fp)
 {
 	auto top  = EstimateDimension(image, fp.tl, fp.tr);
@@ -502,11 +628,54 @@ DetectorResult SampleQR(const BitMatrix& image, const FinderPatternSet& fp)
 													 {*apP(x, y), *apP(x + 1, y), *apP(x + 1, y + 1), *apP(x, y + 1)}}});
 			}
 
-		return SampleGrid(image, dimension, dimension, rois);
+		auto res = SampleGrid(image, dimension, dimension, rois, true);
+		if (res.isValid() && !CheckTimingPattern(res.bits()))
+			return {};
+		return res;
 #endif
 	}
 
-	return SampleGrid(image, dimension, dimension, mod2Pix);
+	auto res = SampleGrid(image, dimension, dimension, mod2Pix, true);
+	if (res.isValid() && !CheckTimingPattern(res.bits()))
+		return {};
+	return res;
+}
+
+/**
+* This method detects a code in a "near pure" image -- a single symbol with clean margins (screenshots
+* and other app rendered images), possibly a few degrees of rotation and a non-integer module size.
+* The three finder patterns are located directly at the corners of the bounding box of all set pixels
+* and handed to the regular (rotation and perspective tolerant) sampling, skipping the full row scan
+* and the pattern set generation. If anything fails, the caller falls back to the general path.
+*/
+DetectorResult DetectNearPureQR(const BitMatrix& image)
+{
+	using Pattern = std::array<PatternView::value_type, PATTERN.size()>;
+
+	constexpr int MIN_MODULES = Version::SymbolSize(1, Type::Model2).x;
+
+	int left, top, width, height;
+	if (!image.findBoundingBox(left, top, width, height, MIN_MODULES) || std::abs(width - height) > width / 10)
+		return {};
+	int right  = left + width - 1;
+	int bottom = top + height - 1;
+
+	// Probe the corner diagonals like DetectPureQR does (a few degrees of rotation leave the 1:1:3:1:1
+	// sequence intact) and then let the concentric pattern finder determine the exact centers.
+	PointI tl{left, top}, tr{right, top}, bl{left, bottom};
+	FinderPatternSet fp;
+	for (auto [p, d, c] : {std::tuple(tl, PointI{1, 1}, &fp.tl), {tr, {-1, 1}, &fp.tr}, {bl, {1, -1}, &fp.bl}}) {
+		auto diagonal = BitMatrixCursorI(image, p, d).readPatternFromBlack<Pattern>(1, width / 3 + 1);
+		if (!IsPattern(diagonal, PATTERN))
+			return {};
+		auto fpWidth = Reduce(diagonal);
+		auto center = LocateConcentricPattern<E2E>(image, PATTERN, centered(p + fpWidth / 2 * d), fpWidth * 3);
+		if (!center)
+			return {};
+		*c = *center;
+	}
+
+	return SampleQR(image, fp);
 }
 
 /**
@@ -726,7 +895,7 @@ DetectorResult SampleMQR(const BitMatrix& image, const ConcentricPattern& fp)
 	if (blackPixels > 2 * dim / 3)
 		return {};
 
-	return SampleGrid(image, dim, dim, bestPT);
+	return SampleGrid(image, dim, dim, bestPT, true);
 }
 
 DetectorResult SampleRMQR(const BitMatrix& image, const ConcentricPattern& fp)
@@ -817,7 +986,7 @@ DetectorResult SampleRMQR(const BitMatrix& image, const ConcentricPattern& fp)
 		}
 	}
 
-	return SampleGrid(image, dim.x, dim.y, bestPT);
+	return SampleGrid(image, dim.x, dim.y, bestPT, true);
 }
 
 } // namespace ZXing::QRCode
@@ -27,13 +27,19 @@ struct FinderPatternSet
 using FinderPatterns = std::vector<ConcentricPattern>;
 using FinderPatternSets = std::vector<FinderPatternSet>;
 
-FinderPatterns FindFinderPatterns(const BitMatrix& image, bool tryHarder);
+// maxVerticalModules is the height in modules of the largest symbol searched for. It determines the row
+// skip of the (non-tryHarder) scan; the default supports up to version 20 for mobile clients.
+FinderPatterns FindFinderPatterns(const BitMatrix& image, bool tryHarder, int maxThreads = 1,
+								  int maxVerticalModules = 20 * 4 + 17);
+// single-row part of the sweep above, also used by the shared candidate stage in ConcentricCandidates.cpp
+void FindFinderPatternsInRow(const BitMatrix& image, const PatternRow& row, int y, FinderPatterns& res);
 FinderPatternSets GenerateFinderPatternSets(FinderPatterns& patterns);
 
 DetectorResult SampleQR(const BitMatrix& image, const FinderPatternSet& fp);
 DetectorResult SampleMQR(const BitMatrix& image, const ConcentricPattern& fp);
 DetectorResult SampleRMQR(const BitMatrix& image, const ConcentricPattern& fp);
 
+DetectorResult DetectNearPureQR(const BitMatrix& image);
 DetectorResult DetectPureQR(const BitMatrix& image);
 DetectorResult DetectPureMQR(const BitMatrix& image);
 DetectorResult DetectPureRMQR(const BitMatrix& image);
@@ -21,6 +21,7 @@
 #include <array>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 namespace ZXing::QRCode {
 
@@ -98,6 +99,69 @@ CodecMode ChooseMode(const std::wstring& content, CharacterSet encoding)
 	return CodecMode::BYTE;
 }
 
+struct Segment
+{
+	CodecMode mode;
+	std::wstring text;
+};
+
+/**
+* Split the content into mode segments such that the total size of the encoded bit stream is
+* minimized, using the standard dynamic program over the per character mode choice (see e.g.
+* ISO/IEC 18004:2015 Annex J). The character count bit widths and thereby the optimal split
+* depend on the version range the passed version belongs to. Kanji mode is not considered here,
+* pure double-byte Kanji content is handled up front in Encode().
+*/
+static std::vector<Segment> SegmentContent(const std::wstring& content, const Version& version)
+{
+	constexpr CodecMode modes[] = {CodecMode::BYTE, CodecMode::ALPHANUMERIC, CodecMode::NUMERIC};
+	// per character cost of each mode in 1/6 bit units: 8 bits, 11 bits per 2 and 10 bits per 3 characters
+	constexpr int charCost[] = {48, 33, 20};
+	const int n = Size(content);
+
+	auto modeFits = [](wchar_t c, int m) {
+		return m == 0 || (m == 1 ? GetAlphanumericCode(c) != -1 : c >= '0' && c <= '9');
+	};
+
+	// cost of starting a new segment: mode indicator plus character count field
+	std::array<int, 3> headerCost;
+	for (int m = 0; m < 3; ++m)
+		headerCost[m] = 6 * (4 + CharacterCountBits(modes[m], version));
+
+	constexpr int INF = std::numeric_limits<int>::max() / 2;
+	// cost[i][m] is the minimal cost of encoding the first i characters with character i-1 in mode m
+	std::vector<std::array<int, 3>> cost(n + 1, {INF, INF, INF});
+	std::vector<std::array<uint8_t, 3>> from(n + 1);
+	cost[0] = {0, 0, 0};
+
+	for (int i = 0; i < n; ++i)
+		for (int m = 0; m < 3; ++m) {
+			if (!modeFits(content[i], m))
+				continue;
+			for (int p = 0; p < 3; ++p) {
+				int c = cost[i][p] + charCost[m] + (i == 0 || p != m ? headerCost[m] : 0);
+				if (c < cost[i + 1][m]) {
+					cost[i + 1][m] = c;
+					from[i + 1][m] = narrow_cast<uint8_t>(p);
+				}
+			}
+		}
+
+	std::vector<uint8_t> charMode(n);
+	for (int i = n, m = narrow_cast<int>(std::min_element(cost[n].begin(), cost[n].end()) - cost[n].begin()); i > 0; --i) {
+		charMode[i - 1] = narrow_cast<uint8_t>(m);
+		m = from[i][m];
+	}
+
+	std::vector<Segment> res;
+	for (int i = 0; i < n; ++i) {
+		if (i == 0 || charMode[i] != charMode[i - 1])
+			res.push_back({modes[charMode[i]], {}});
+		res.back().text += content[i];
+	}
+	return res;
+}
+
 /*
 * See ISO/IEC 18004:2015 Table 4
 */
@@ -266,13 +330,26 @@ static bool WillFit(int numInputBits, const Version& version, ErrorCorrectionLev
 
 static const Version& ChooseVersion(int numInputBits, ErrorCorrectionLevel ecLevel)
 {
-	for (int versionNum = 1; versionNum <= 40; versionNum++) {
-		const Version* version = Version::Model2(versionNum);
-		if (WillFit(numInputBits, *version, ecLevel)) {
-			return *version;
-		}
-	}
-	throw std::invalid_argument("Data too big");
+	// Data codeword capacity per version and error correction level, distilled once from the
+	// version table (which is built at run time, so this cannot be constexpr). The capacities grow
+	// monotonically with the version number, so the smallest fitting version is a binary search
+	// away instead of running the WillFit() loop over all 40 versions for every encode.
+	static const auto capacities = [] {
+		std::array<std::array<uint16_t, 40>, 4> res;
+		for (int ec = 0; ec < 4; ++ec)
+			for (int number = 1; number <= 40; ++number) {
+				const Version* version = Version::Model2(number);
+				res[ec][number - 1] = narrow_cast<uint16_t>(
+					version->totalCodewords() - version->ecBlocksForLevel(ErrorCorrectionLevel(ec)).totalCodewords());
+			}
+		return res;
+	}();
+
+	auto& capacity = capacities[static_cast<int>(ecLevel)];
+	auto it = std::lower_bound(capacity.begin(), capacity.end(), (numInputBits + 7) / 8);
+	if (it == capacity.end())
+		throw std::invalid_argument("Data too big");
+	return *Version::Model2(narrow_cast<int>(it - capacity.begin()) + 1);
 }
 
 /**
@@ -418,6 +495,7 @@ BitArray InterleaveWithECBytes(const BitArray& bits, int numTotalBytes, int numD
 	}
 
 	BitArray output;
+	output.reserve(8 * numTotalBytes);
 	// First, place data blocks.
 	for (int i = 0; i < maxNumDataBytes; ++i) {
 		for (auto& block : blocks) {
@@ -458,91 +536,121 @@ static int ChooseMaskPattern(const BitArray& bits, ErrorCorrectionLevel ecLevel,
 	return bestMaskPattern;
 }
 
-static int CalculateBitsNeeded(CodecMode mode, const BitArray& headerBits, const BitArray& dataBits, const Version& version)
+static int CalculateBitsNeeded(const std::vector<Segment>& segments, const std::vector<BitArray>& dataBits,
+							   const BitArray& headerBits, const Version& version)
 {
-	return headerBits.size() + CharacterCountBits(mode, version) + dataBits.size();
+	int res = headerBits.size();
+	for (int i = 0; i < Size(segments); ++i)
+		res += 4 + CharacterCountBits(segments[i].mode, version) + dataBits[i].size();
+	return res;
 }
 
 /**
 * Decides the smallest version of QR code that will contain all of the provided data.
 * @throws WriterException if the data cannot fit in any version
 */
-static const Version& RecommendVersion(ErrorCorrectionLevel ecLevel, CodecMode mode, const BitArray& headerBits, const BitArray& dataBits)
+static const Version& RecommendVersion(ErrorCorrectionLevel ecLevel, const std::vector<Segment>& segments,
+									   const std::vector<BitArray>& dataBits, const BitArray& headerBits)
 {
 	// Hard part: need to know version to know how many bits length takes. But need to know how many
 	// bits it takes to know version. First we take a guess at version by assuming version will be
 	// the minimum, 1:
-	int provisionalBitsNeeded = CalculateBitsNeeded(mode, headerBits, dataBits, *Version::Model2(1));
+	int provisionalBitsNeeded = CalculateBitsNeeded(segments, dataBits, headerBits, *Version::Model2(1));
 	const Version& provisionalVersion = ChooseVersion(provisionalBitsNeeded, ecLevel);
 
 	// Use that guess to calculate the right version. I am still not sure this works in 100% of cases.
-	int bitsNeeded = CalculateBitsNeeded(mode, headerBits, dataBits, provisionalVersion);
+	int bitsNeeded = CalculateBitsNeeded(segments, dataBits, headerBits, provisionalVersion);
 	return ChooseVersion(bitsNeeded, ecLevel);
 }
 
 EncodeResult Encode(const std::wstring& content, ErrorCorrectionLevel ecLevel, CharacterSet charset, int versionNumber,
-					bool useGs1Format, int maskPattern)
+					bool useGs1Format, int maskPattern, bool optimalSegmentation)
 {
 	bool charsetWasUnknown = charset == CharacterSet::Unknown;
 	if (charsetWasUnknown) {
 		charset = DEFAULT_BYTE_MODE_ENCODING;
 	}
 
-	// Pick an encoding mode appropriate for the content. Note that this will not attempt to use
-	// multiple modes / segments even if that were more efficient. Twould be nice.
+	// Pick an encoding mode appropriate for the whole content. With optimalSegmentation requested,
+	// the content is instead split into multiple mode segments to minimize the bit stream size.
 	CodecMode mode = ChooseMode(content, charset);
 
-	// This will store the header information, like mode and
-	// length, as well as "header" segments like an ECI segment.
+	std::vector<Segment> segments;
+	std::vector<BitArray> dataBits;
+
+	// This will store the "header" information preceding the segments, i.e. the ECI and FNC1 headers.
 	BitArray headerBits;
 
-	// Append ECI segment if applicable
-	if (mode == CodecMode::BYTE && !charsetWasUnknown) {
-		AppendECI(charset, headerBits);
-	}
+	auto prepareSegments = [&](const Version& version) {
+		segments = optimalSegmentation && mode != CodecMode::KANJI ? SegmentContent(content, version)
+																   : std::vector<Segment>{{mode, content}};
 
-	// Append the FNC1 mode header for GS1 formatted data if applicable
-	if (useGs1Format) {
-		// GS1 formatted codes are prefixed with a FNC1 in first position mode header
-		AppendModeInfo(CodecMode::FNC1_FIRST_POSITION, headerBits);
-	}
+		// Collect the data of each segment separately, to count its size if needed. Don't add it to
+		// the main payload yet.
+		dataBits = std::vector<BitArray>(segments.size());
+		for (int i = 0; i < Size(segments); ++i)
+			AppendBytes(segments[i].text, segments[i].mode, charset, dataBits[i]);
 
-	// (With ECI in place,) Write the mode marker
-	AppendModeInfo(mode, headerBits);
+		headerBits = {};
 
-	// Collect data within the main segment, separately, to count its size if needed. Don't add it to
-	// main payload yet.
-	BitArray dataBits;
-	AppendBytes(content, mode, charset, dataBits);
+		// Append ECI segment if applicable
+		if (!charsetWasUnknown
+			&& std::any_of(segments.begin(), segments.end(), [](const Segment& s) { return s.mode == CodecMode::BYTE; })) {
+			AppendECI(charset, headerBits);
+		}
 
-	const Version* version;
-	if (versionNumber > 0) {
-		version = Version::Model2(versionNumber);
-		if (version != nullptr) {
-			int bitsNeeded = CalculateBitsNeeded(mode, headerBits, dataBits, *version);
-			if (!WillFit(bitsNeeded, *version, ecLevel)) {
-				throw std::invalid_argument("Data too big for requested version");
+		// Append the FNC1 mode header for GS1 formatted data if applicable
+		if (useGs1Format) {
+			// GS1 formatted codes are prefixed with a FNC1 in first position mode header
+			AppendModeInfo(CodecMode::FNC1_FIRST_POSITION, headerBits);
+		}
+	};
+
+	const Version* version = versionNumber > 0 ? Version::Model2(versionNumber) : nullptr;
+	if (version != nullptr) {
+		prepareSegments(*version);
+		int bitsNeeded = CalculateBitsNeeded(segments, dataBits, headerBits, *version);
+		if (!WillFit(bitsNeeded, *version, ecLevel)) {
+			throw std::invalid_argument("Data too big for requested version");
+		}
+	}
+	else if (optimalSegmentation && mode != CodecMode::KANJI) {
+		// The character count bit widths and thereby the optimal segmentation are constant within
+		// each of the three version ranges (see ISO/IEC 18004:2015 Table 3), so segment the content
+		// once per range and pick the first range whose largest version can hold the result.
+		for (int maxVersion : {9, 26, 40}) {
+			prepareSegments(*Version::Model2(maxVersion));
+			int bitsNeeded = CalculateBitsNeeded(segments, dataBits, headerBits, *Version::Model2(maxVersion));
+			if (WillFit(bitsNeeded, *Version::Model2(maxVersion), ecLevel)) {
+				version = &ChooseVersion(bitsNeeded, ecLevel);
+				break;
 			}
 		}
-		else {
-			version = &RecommendVersion(ecLevel, mode, headerBits, dataBits);
+		if (version == nullptr) {
+			throw std::invalid_argument("Data too big");
 		}
 	}
 	else {
-		version = &RecommendVersion(ecLevel, mode, headerBits, dataBits);
+		prepareSegments(*Version::Model2(1));
+		version = &RecommendVersion(ecLevel, segments, dataBits, headerBits);
 	}
 
-	BitArray headerAndDataBits;
-	headerAndDataBits.appendBitArray(headerBits);
-	// Find "length" of main segment and write it
-	int numLetters = mode == CodecMode::BYTE ? dataBits.sizeInBytes() : Size(content);
-	AppendLengthInfo(numLetters, *version, mode, headerAndDataBits);
-	// Put data together into the overall payload
-	headerAndDataBits.appendBitArray(dataBits);
-
 	auto& ecBlocks = version->ecBlocksForLevel(ecLevel);
 	int numDataBytes = version->totalCodewords() - ecBlocks.totalCodewords();
 
+	BitArray headerAndDataBits;
+	headerAndDataBits.reserve(8 * numDataBytes);
+	headerAndDataBits.appendBitArray(headerBits);
+	for (int i = 0; i < Size(segments); ++i) {
+		// Write the mode marker of the segment
+		AppendModeInfo(segments[i].mode, headerAndDataBits);
+		// Find "length" of the segment and write it
+		int numLetters = segments[i].mode == CodecMode::BYTE ? dataBits[i].sizeInBytes() : Size(segments[i].text);
+		AppendLengthInfo(numLetters, *version, segments[i].mode, headerAndDataBits);
+		// Put data together into the overall payload
+		headerAndDataBits.appendBitArray(dataBits[i]);
+	}
+
 	// Terminate the bits properly.
 	TerminateBits(numDataBytes, headerAndDataBits);
 
@@ -16,6 +16,6 @@ enum class ErrorCorrectionLevel;
 class EncodeResult;
 
 EncodeResult Encode(const std::wstring& content, ErrorCorrectionLevel ecLevel, CharacterSet encoding, int versionNumber,
-					bool useGs1Format, int maskPattern = -1);
+					bool useGs1Format, int maskPattern = -1, bool optimalSegmentation = false);
 
 } // namespace ZXing::QRCode
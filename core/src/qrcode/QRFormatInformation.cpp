@@ -18,30 +18,62 @@ static uint32_t MirrorBits(uint32_t bits)
 	return BitHacks::Reverse(bits) >> 17;
 }
 
-static FormatInformation FindBestFormatInfo(const std::vector<uint32_t>& masks, const std::vector<uint32_t>& bits)
+// See ISO 18004:2015, Annex C, Table C.1
+static constexpr uint32_t MODEL2_MASKED_PATTERNS[] = {
+	0x5412, 0x5125, 0x5E7C, 0x5B4B, 0x45F9, 0x40CE, 0x4F97, 0x4AA0, 0x77C4, 0x72F3, 0x7DAA, 0x789D, 0x662F, 0x6318, 0x6C41, 0x6976,
+	0x1689, 0x13BE, 0x1CE7, 0x19D0, 0x0762, 0x0255, 0x0D0C, 0x083B, 0x355F, 0x3068, 0x3F31, 0x3A06, 0x24B4, 0x2183, 0x2EDA, 0x2BED,
+};
+
+/**
+* Direct-index lookup table for the Model2/Micro format information: for every 15 bit input the
+* best matching (lowest Hamming distance) pattern of Table C.1, precomputed at compile time (64KB
+* of .rodata). The data bits are stored in bits 0-4, the distance in bits 8-11. This turns the
+* former 32 pattern distance loop into a single load per candidate - relevant because the finder
+* pattern detector produces many false candidates per frame and each one pays for the format
+* decode in both orientations before it can be rejected.
+*/
+struct FormatInfoLUT
 {
-	// See ISO 18004:2015, Annex C, Table C.1
-	constexpr uint32_t MODEL2_MASKED_PATTERNS[] = {
-		0x5412, 0x5125, 0x5E7C, 0x5B4B, 0x45F9, 0x40CE, 0x4F97, 0x4AA0, 0x77C4, 0x72F3, 0x7DAA, 0x789D, 0x662F, 0x6318, 0x6C41, 0x6976,
-		0x1689, 0x13BE, 0x1CE7, 0x19D0, 0x0762, 0x0255, 0x0D0C, 0x083B, 0x355F, 0x3068, 0x3F31, 0x3A06, 0x24B4, 0x2183, 0x2EDA, 0x2BED,
-	};
+	uint16_t entry[1 << 15] = {}; // a plain array: std::array::operator[] blows the constexpr ops budget
 
+	constexpr FormatInfoLUT()
+	{
+		// Build via a distance transform over the 15 dimensional hypercube (one relaxation sweep per
+		// bit) instead of the obvious 2^15 x 32 distance loop, which exceeds the compiler's constexpr
+		// operation limit. The entry layout (distance above data) makes the relaxation a plain
+		// compare/add: the code's minimum distance of 7 guarantees a unique nearest pattern wherever
+		// the result is valid (distance <= 3), so the tie-breaking for invalid entries is irrelevant.
+		for (auto& e : entry)
+			e = 16 << 8;
+		for (uint32_t pattern : MODEL2_MASKED_PATTERNS) {
+			// 'unmask' the pattern first to get the original 5-data bits + 10-ec bits back
+			pattern ^= FORMAT_INFO_MASK_MODEL2;
+			entry[pattern] = narrow_cast<uint16_t>(pattern >> 10); // drop the 10 BCH error correction bits
+		}
+		for (int bit = 0; bit < 15; ++bit)
+			for (uint32_t bits = 0; bits < (1 << 15); ++bits)
+				if (uint16_t viaNeighbor = entry[bits ^ (1 << bit)] + (1 << 8); viaNeighbor < entry[bits])
+					entry[bits] = viaNeighbor;
+	}
+};
+
+static constexpr FormatInfoLUT FORMAT_INFO_LUT{};
+
+static FormatInformation FindBestFormatInfo(const std::vector<uint32_t>& masks, const std::vector<uint32_t>& bits)
+{
 	FormatInformation fi;
 
 	for (auto mask : masks)
-		for (int bitsIndex = 0; bitsIndex < Size(bits); ++bitsIndex)
-			for (uint32_t pattern : MODEL2_MASKED_PATTERNS) {
-				// 'unmask' the pattern first to get the original 5-data bits + 10-ec bits back
-				pattern ^= FORMAT_INFO_MASK_MODEL2;
-				// Find the pattern with fewest bits differing
-				if (int hammingDist = BitHacks::CountBitsSet((bits[bitsIndex] ^ mask) ^ pattern);
-					hammingDist < fi.hammingDistance) {
-					fi.mask = mask; // store the used mask to discriminate between types/models
-					fi.data = pattern >> 10; // drop the 10 BCH error correction bits
-					fi.hammingDistance = hammingDist;
-					fi.bitsIndex = bitsIndex;
-				}
+		for (int bitsIndex = 0; bitsIndex < Size(bits); ++bitsIndex) {
+			// Find the pattern with fewest bits differing (precomputed, see FormatInfoLUT)
+			uint16_t entry = FORMAT_INFO_LUT.entry[(bits[bitsIndex] ^ mask) & 0x7FFF];
+			if (int hammingDist = entry >> 8; hammingDist < fi.hammingDistance) {
+				fi.mask = mask; // store the used mask to discriminate between types/models
+				fi.data = entry & 0x1F;
+				fi.hammingDistance = hammingDist;
+				fi.bitsIndex = bitsIndex;
 			}
+		}
 
 	return fi;
 }
@@ -6,11 +6,11 @@
 
 #include "QRMaskUtil.h"
 
-#include <algorithm>
-#include <array>
-#include <cassert>
+#include "ZXAlgorithms.h"
+
+#include <cstdint>
 #include <cstdlib>
-#include <utility>
+#include <vector>
 
 namespace ZXing::QRCode::MaskUtil {
 
@@ -20,135 +20,105 @@ static const int N2 = 3;
 static const int N3 = 40;
 static const int N4 = 10;
 
-/**
-* Helper function for applyMaskPenaltyRule1. We need this for doing this calculation in both
-* vertical and horizontal orders respectively.
-*/
-static int ApplyMaskPenaltyRule1Internal(const TritMatrix& matrix, bool isHorizontal)
-{
-	int penalty = 0;
-	int width = matrix.width();
-	int height = matrix.height();
-	int iLimit = isHorizontal ? height : width;
-	int jLimit = isHorizontal ? width : height;
-	for (int i = 0; i < iLimit; i++) {
-		int numSameBitCells = 0;
-		int prevBit = -1;
-		for (int j = 0; j < jLimit; j++) {
-			int bit = isHorizontal ? matrix.get(j, i) : matrix.get(i, j);
-			if (bit == prevBit) {
-				numSameBitCells++;
-			}
-			else {
-				if (numSameBitCells >= 5) {
-					penalty += N1 + (numSameBitCells - 5);
-				}
-				numSameBitCells = 1;  // Include the cell itself.
-				prevBit = bit;
-			}
-		}
-		if (numSameBitCells >= 5) {
-			penalty += N1 + (numSameBitCells - 5);
-		}
-	}
-	return penalty;
-}
+// Rule 3 looks for finder-like patterns: a 1:1:3:1:1 run starting with black (1011101) that is
+// preceded or followed by 4 white modules (a shorter run of white suffices at the symbol edge).
+// Both the horizontal and the vertical scan keep a sliding 15 bit window per line: the 7 most
+// recent modules (bits 0-6) hold a potential finder for the "white before" test, the 4+7 modules
+// before the last 4 (bits 4-10) one for the "white after" test. Since the window starts out all
+// zero and is flushed with 4 zero bits past the edge, out-of-symbol modules count as white, which
+// matches the truncated run handling at the edges. A pattern with white on both sides is counted
+// only once: for the "white after" test, at least one of the 4 modules preceding the finder
+// (bits 11-14) has to be black.
+constexpr uint16_t FINDER = 0b1011101;
+constexpr uint16_t WINDOW = (1 << 15) - 1;
 
-/**
-* Apply mask penalty rule 1 and return the penalty. Find repetitive cells with the same color and
-* give penalty to them. Example: 00000 or 11111.
-*/
-static int ApplyMaskPenaltyRule1(const TritMatrix& matrix)
+static int CountFinderPatterns(uint16_t bits)
 {
-	return ApplyMaskPenaltyRule1Internal(matrix, true) + ApplyMaskPenaltyRule1Internal(matrix, false);
+	return ((bits & 0x7FF) == FINDER) + ((bits & 0x7FF) == (FINDER << 4) && (bits & 0x7800));
 }
 
 /**
-* Apply mask penalty rule 2 and return the penalty. Find 2x2 blocks with the same color and give
-* penalty to them. This is actually equivalent to the spec's rule, which is to find MxN blocks and give a
-* penalty proportional to (M-1)x(N-1), because this is the number of 2x2 blocks inside such a block.
+* The mask penalty calculation is complicated. See Table 21 of JISX0510:2004 (p.45) for details.
+* Basically it applies four rules and summates all penalties. All four rules are evaluated in a
+* single row-major pass over the matrix, with a bit of per-column state for the vertical runs and
+* patterns, instead of traversing the matrix once per rule (and twice more column-major). This
+* matters, since the caller evaluates all 8 mask patterns to pick the best one.
 */
-static int ApplyMaskPenaltyRule2(const TritMatrix& matrix)
+int CalculateMaskPenalty(const TritMatrix& matrix)
 {
-	int penalty = 0;
-	for (int y = 0; y < matrix.height() - 1; y++) {
-		for (int x = 0; x < matrix.width() - 1; x++) {
-			auto value = matrix.get(x, y);
-			if (value == matrix.get(x+1, y) && value == matrix.get(x, y+1) && value == matrix.get(x+1, y+1)) {
-				penalty++;
-			}
-		}
-	}
-	return N2 * penalty;
-}
+	const int width = matrix.width();
+	const int height = matrix.height();
 
-template <size_t N>
-static bool HasPatternAt(const std::array<bool, N>& pattern, const Trit* begin, int count, int stride)
-{
-	assert(std::abs(count) <= (int)N);
-	auto end = begin + count * stride;
-	if (count < 0)
-		std::swap(begin, end);
-	auto a = begin;
-	for (auto b = pattern.begin(); a < end && b != pattern.end(); a += stride, ++b)
-		if (*a != *b)
-			return false;
-	return true;
-}
+	int penalty1 = 0; // runs of 5 or more same colored modules
+	int numBlocks = 0; // 2x2 blocks of same colored modules
+	int numPatterns = 0; // finder-like patterns
+	int numDarkCells = 0;
+
+	// per column state of the vertical scans
+	std::vector<int> colRun(width, 0);
+	std::vector<int8_t> colBit(width, -1);
+	std::vector<uint16_t> colBits(width, 0);
 
-/**
-* Apply mask penalty rule 3 and return the penalty. Find consecutive runs of 1:1:3:1:1:4
-* starting with black, or 4:1:1:3:1:1 starting with white, and give penalty to them.  If we
-* find patterns like 000010111010000, we give penalty once.
-*/
-static int ApplyMaskPenaltyRule3(const TritMatrix& matrix)
-{
-	const std::array<bool, 4> white = {0, 0, 0, 0};
-	const std::array<bool, 7> finder = {1, 0, 1, 1, 1, 0, 1};
-	const int whiteSize = Size(white);
-	const int finderSize = Size(finder);
-
-	int numPenalties = 0;
-	int width = matrix.width();
-	int height = matrix.height();
 	for (int y = 0; y < height; y++) {
+		const Trit* row = &matrix.get(0, y);
+		const Trit* prevRow = y > 0 ? row - width : nullptr;
+		int rowRun = 0;
+		int rowBit = -1;
+		uint16_t rowBits = 0;
 		for (int x = 0; x < width; x++) {
-			auto i = &matrix.get(x, y);
-			if (x <= width - finderSize && HasPatternAt(finder, i, finderSize, 1)
-				&& (HasPatternAt(white, i, -std::min(x, whiteSize), 1)
-					|| HasPatternAt(white, i + finderSize, std::min(width - x - finderSize, whiteSize), 1))) {
-				numPenalties++;
+			int bit = row[x];
+			numDarkCells += bit;
+
+			// Rule 1: repetitive cells with the same color, e.g. 00000 or 11111
+			if (bit == rowBit) {
+				rowRun++;
+			} else {
+				if (rowRun >= 5)
+					penalty1 += N1 + (rowRun - 5);
+				rowRun = 1;
+				rowBit = narrow_cast<int8_t>(bit);
 			}
-			if (y <= height - finderSize && HasPatternAt(finder, i, finderSize, width)
-				&& (HasPatternAt(white, i, -std::min(y, whiteSize), width)
-					|| HasPatternAt(white, i + finderSize * width, std::min(height - y - finderSize, whiteSize), width))) {
-				numPenalties++;
+			if (bit == colBit[x]) {
+				colRun[x]++;
+			} else {
+				if (colRun[x] >= 5)
+					penalty1 += N1 + (colRun[x] - 5);
+				colRun[x] = 1;
+				colBit[x] = narrow_cast<int8_t>(bit);
 			}
+
+			// Rule 2: 2x2 blocks with the same color, counted at their bottom right corner
+			if (x > 0 && prevRow && bit == row[x - 1] && bit == prevRow[x] && bit == prevRow[x - 1])
+				numBlocks++;
+
+			// Rule 3: finder-like patterns, see above
+			rowBits = ((rowBits << 1) | bit) & WINDOW;
+			numPatterns += CountFinderPatterns(rowBits);
+			colBits[x] = ((colBits[x] << 1) | bit) & WINDOW;
+			numPatterns += CountFinderPatterns(colBits[x]);
+		}
+		if (rowRun >= 5)
+			penalty1 += N1 + (rowRun - 5);
+		// flush the window with white to catch patterns truncated at the right edge
+		for (int i = 0; i < 4; i++) {
+			rowBits = (rowBits << 1) & WINDOW;
+			numPatterns += CountFinderPatterns(rowBits);
+		}
+	}
+	for (int x = 0; x < width; x++) {
+		if (colRun[x] >= 5)
+			penalty1 += N1 + (colRun[x] - 5);
+		// flush the window with white to catch patterns truncated at the bottom edge
+		for (int i = 0; i < 4; i++) {
+			colBits[x] = (colBits[x] << 1) & WINDOW;
+			numPatterns += CountFinderPatterns(colBits[x]);
 		}
 	}
-	return numPenalties * N3;
-}
 
-/**
-* Apply mask penalty rule 4 and return the penalty. Calculate the ratio of dark cells and give
-* penalty if the ratio is far from 50%. It gives 10 penalty for 5% distance.
-*/
-static int ApplyMaskPenaltyRule4(const TritMatrix& matrix)
-{
-	auto numDarkCells = std::count_if(matrix.begin(), matrix.end(), [](Trit cell) { return cell; });
-	auto numTotalCells = matrix.size();
-	auto fivePercentVariances = std::abs(numDarkCells * 2 - numTotalCells) * 10 / numTotalCells;
-	return narrow_cast<int>(fivePercentVariances * N4);
-}
+	// Rule 4: the ratio of dark cells, 10 penalty per 5% deviation from 50%
+	int penalty4 = narrow_cast<int>(std::abs(int64_t(numDarkCells) * 2 - matrix.size()) * 10 / matrix.size());
 
-// The mask penalty calculation is complicated.  See Table 21 of JISX0510:2004 (p.45) for details.
-// Basically it applies four rules and summate all penalties.
-int CalculateMaskPenalty(const TritMatrix& matrix)
-{
-	return MaskUtil::ApplyMaskPenaltyRule1(matrix)
-		   + MaskUtil::ApplyMaskPenaltyRule2(matrix)
-		   + MaskUtil::ApplyMaskPenaltyRule3(matrix)
-		   + MaskUtil::ApplyMaskPenaltyRule4(matrix);
+	return penalty1 + N2 * numBlocks + N3 * numPatterns + N4 * penalty4;
 }
 
 } // namespace ZXing::QRCode::MaskUtil
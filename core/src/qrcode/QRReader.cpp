@@ -15,10 +15,21 @@
 #include "LogMatrix.h"
 #include "QRDecoder.h"
 #include "QRDetector.h"
+#include "QRVersion.h"
+#include "ThreadPool.h"
 #include "Barcode.h"
 
 #include <utility>
 
+#ifdef ZXING_EXPERIMENTAL_API
+#include "ConcentricCandidates.h"
+#include "DecodeCache.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#endif
+
 namespace ZXing::QRCode {
 
 Barcode Reader::decode(const BinaryBitmap& image) const
@@ -43,7 +54,12 @@ Barcode Reader::decode(const BinaryBitmap& image) const
 	if (!detectorResult.isValid())
 		return {};
 
+#ifdef ZXING_EXPERIMENTAL_API
+	// pure path, nothing else runs in parallel: give the decoder the full thread budget
+	auto decoderResult = Decode(detectorResult.bits(), _opts.maxNumberOfThreads());
+#else
 	auto decoderResult = Decode(detectorResult.bits());
+#endif
 	auto format = detectorResult.bits().width() != detectorResult.bits().height() ? BarcodeFormat::RMQRCode
 				  : detectorResult.bits().width() < 21                            ? BarcodeFormat::MicroQRCode
 																				  : BarcodeFormat::QRCode;
@@ -77,7 +93,43 @@ Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 	LogMatrixWriter lmw(log, *binImg, 5, "qr-log.pnm");
 #endif
 	
-	auto allFPs = FindFinderPatterns(*binImg, _opts.tryHarder());
+#ifdef ZXING_EXPERIMENTAL_API
+	int maxThreads = _opts.maxNumberOfThreads();
+	// Skip the decode of any symbol whose sampled module grid is bit-identical to one successfully
+	// decoded in a previous frame of the same scan state (see DecodeCache.h) and let the decoder
+	// retry marginally sampled grids with the least confident modules flipped (see QRDecoder).
+	auto cachedDecode = [cache = image.decodeCache()](BarcodeFormat format, const DetectorResult& detRes, int nThreads = 1) {
+		return DecodeCache::FindOrDecode(cache, format, detRes.bits(), [&] { return Decode(detRes, nThreads); });
+	};
+#else
+	int maxThreads = 1;
+	auto cachedDecode = [](BarcodeFormat, const DetectorResult& detRes, int nThreads = 1) { return Decode(detRes.bits(), nThreads); };
+#endif
+	// Screenshots and app rendered images are mostly "near pure": try the cheap bounding box based
+	// tier first and only fall through to the full row scan + pattern set generation when it fails.
+	if (_opts.hasFormat(BarcodeFormat::QRCode) && maxSymbols == 1) {
+		if (auto detectorResult = DetectNearPureQR(*binImg); detectorResult.isValid())
+			if (auto decoderResult = cachedDecode(BarcodeFormat::QRCode, detectorResult, maxThreads); decoderResult.isValid())
+				return {Barcode(std::move(decoderResult), std::move(detectorResult), BarcodeFormat::QRCode)};
+	}
+
+	// Dedicated small-symbol fast path: when no full sized QR Code is searched for, the row scan can
+	// assume the much smaller maximal symbol height of the Micro QR / rMQR variants, and every finder
+	// pattern hit below goes straight to sampling with no pattern set generation involved.
+	int maxVerticalModules = _opts.hasFormat(BarcodeFormat::QRCode) ? 20 * 4 + 17 : Version::SymbolSize(4, Type::Micro).y;
+
+	std::vector<ConcentricPattern> allFPs;
+#ifdef ZXING_EXPERIMENTAL_API
+	if (_opts.hasFormat(BarcodeFormat::Aztec) && !_opts.isPure()) {
+		// An Aztec reader will run on this bitmap later: compute the candidate sets for both formats
+		// in one shared sweep and leave the Aztec set on the bitmap (see ConcentricCandidates.h).
+		auto candidates = std::make_unique<ConcentricCandidateSets>(
+			FindConcentricCandidates(*binImg, _opts.tryHarder(), maxVerticalModules));
+		allFPs = std::move(candidates->qr);
+		image.setConcentricCandidates(std::move(candidates));
+	} else
+#endif
+		allFPs = FindFinderPatterns(*binImg, _opts.tryHarder(), maxThreads, maxVerticalModules);
 
 #ifdef PRINT_DEBUG
 	printf("allFPs: %d\n", Size(allFPs));
@@ -85,18 +137,77 @@ Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 
 	std::vector<ConcentricPattern> usedFPs;
 	Barcodes res;
-	
+
 	if (_opts.hasFormat(BarcodeFormat::QRCode)) {
 		auto allFPSets = GenerateFinderPatternSets(allFPs);
-		for (const auto& fpSet : allFPSets) {
+
+		// Sample and decode each finder pattern set, accumulating the results in set order. The
+		// usedFPs filtering makes this order dependent: a set sharing a pattern with an already
+		// decoded symbol is skipped.
+		struct Candidate
+		{
+			DetectorResult det;
+			DecoderResult dec;
+			bool computed = false;
+		};
+		std::vector<Candidate> cands(allFPSets.size());
+		auto sampleAndDecode = [&](int i) {
+			auto& c = cands[i];
+			c.det = SampleQR(*binImg, allFPSets[i]);
+			if (c.det.isValid())
+				c.dec = cachedDecode(BarcodeFormat::QRCode, c.det);
+			c.computed = true;
+			return c.dec.isValid();
+		};
+
+#ifdef ZXING_EXPERIMENTAL_API
+		// Dispatch the expensive per-candidate work to worker threads up front. The order dependent
+		// usedFPs filtering happens in the (cheap) collection loop below; candidates a worker skipped
+		// because enough symbols were found already are computed lazily there if they turn out to be
+		// needed after all.
+		int nThreads = std::clamp(int(_opts.maxNumberOfThreads() ? _opts.maxNumberOfThreads()
+																 : std::thread::hardware_concurrency()),
+								  1, Size(allFPSets));
+		if (nThreads > 1) {
+			std::atomic<int> next = 0, found = 0;
+			std::mutex sharedFPsMutex;
+			std::vector<ConcentricPattern> sharedFPs; // patterns of symbols decoded by any worker so far
+			auto worker = [&]() {
+				for (int i = next++; i < Size(allFPSets) && (!maxSymbols || found < maxSymbols); i = next++) {
+					const auto& fpSet = allFPSets[i];
+					// same work-avoidance as the usedFPs test below, based on what is decoded so far;
+					// skipped candidates stay uncomputed and are sampled lazily below if needed
+					{
+						std::lock_guard lock(sharedFPsMutex);
+						if (Contains(sharedFPs, fpSet.bl) || Contains(sharedFPs, fpSet.tl) || Contains(sharedFPs, fpSet.tr))
+							continue;
+					}
+					if (sampleAndDecode(i)) {
+						++found;
+						std::lock_guard lock(sharedFPsMutex);
+						sharedFPs.push_back(fpSet.bl);
+						sharedFPs.push_back(fpSet.tl);
+						sharedFPs.push_back(fpSet.tr);
+					}
+				}
+			};
+			RunParallel(nThreads, worker, _opts.threadPriority());
+		}
+#endif
+
+		for (int i = 0; i < Size(allFPSets); ++i) {
+			const auto& fpSet = allFPSets[i];
 			if (Contains(usedFPs, fpSet.bl) || Contains(usedFPs, fpSet.tl) || Contains(usedFPs, fpSet.tr))
 				continue;
 
 			logFPSet(fpSet);
 
-			auto detectorResult = SampleQR(*binImg, fpSet);
+			if (!cands[i].computed)
+				sampleAndDecode(i);
+
+			auto& detectorResult = cands[i].det;
+			auto& decoderResult = cands[i].dec;
 			if (detectorResult.isValid()) {
-				auto decoderResult = Decode(detectorResult.bits());
 				if (decoderResult.isValid()) {
 					usedFPs.push_back(fpSet.bl);
 					usedFPs.push_back(fpSet.tl);
@@ -118,7 +229,7 @@ Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 
 			auto detectorResult = SampleMQR(*binImg, fp);
 			if (detectorResult.isValid()) {
-				auto decoderResult = Decode(detectorResult.bits());
+				auto decoderResult = cachedDecode(BarcodeFormat::MicroQRCode, detectorResult);
 				if (decoderResult.isValid(_opts.returnErrors())) {
 					res.emplace_back(std::move(decoderResult), std::move(detectorResult), BarcodeFormat::MicroQRCode);
 					if (maxSymbols && Size(res) == maxSymbols)
@@ -137,7 +248,7 @@ Barcodes Reader::decode(const BinaryBitmap& image, int maxSymbols) const
 
 			auto detectorResult = SampleRMQR(*binImg, fp);
 			if (detectorResult.isValid()) {
-				auto decoderResult = Decode(detectorResult.bits());
+				auto decoderResult = cachedDecode(BarcodeFormat::RMQRCode, detectorResult);
 				if (decoderResult.isValid(_opts.returnErrors())) {
 					res.emplace_back(std::move(decoderResult), std::move(detectorResult), BarcodeFormat::RMQRCode);
 					if (maxSymbols && Size(res) == maxSymbols)
@@ -20,7 +20,7 @@ namespace ZXing::QRCode {
 	* See ISO 18004:2006 Annex D.
 	* Element i represents the raw version bits that specify version i + 7
 	*/
-	static const int VERSION_DECODE_INFO[] = {
+	static constexpr int VERSION_DECODE_INFO[] = {
 		0x07C94, 0x085BC, 0x09A99, 0x0A4D3, 0x0BBF6,
 		0x0C762, 0x0D847, 0x0E60D, 0x0F928, 0x10B78,
 		0x1145D, 0x12A17, 0x13532, 0x149A6, 0x15683,
@@ -35,7 +35,7 @@ const Version* Version::Model2(int number)
 	/**
 	* See ISO 18004:2006 6.5.1 Table 9
 	*/
-	static const Version allVersions[] = {
+	static constexpr Version allVersions[] = {
 		{1, {}, {
 			7,  1, 19, 0, 0,
 			10, 1, 16, 0, 0,
@@ -288,7 +288,7 @@ const Version* Version::Micro(int number)
 	/**
 	 * See ISO 18004:2006 6.5.1 Table 9
 	 */
-	static const Version allVersions[] = {
+	static constexpr Version allVersions[] = {
 		{1, {2, 1, 3, 0, 0}},
 		{2, {5, 1, 5, 0, 0, 6, 1, 4, 0, 0}},
 		{3, {6, 1, 11, 0, 0, 8, 1, 9, 0, 0}},
@@ -305,7 +305,7 @@ const Version* Version::rMQR(int number)
 	 * See ISO/IEC 23941:2022 Annex D, Table D.1 - Column coordinates of centre module of alignment patterns
 	 * See ISO/IEC 23941:2022 7.5.1, Table 8 - Error correction characteristics for rMQR
 	 */
-	static const Version allVersions[] = {
+	static constexpr Version allVersions[] = {
 		// Version number, alignment pattern centres, `ECBlocks`
 		{ 1, {21}, { // R7x43
 			// 4 `ECBlocks`, one for each `ecLevel` - rMQR only uses M & H but using 2 dummies to keep `ecLevel` index same as QR Code
@@ -515,7 +515,7 @@ const Version* Version::Model1(int number)
 	 * See ISO 18004:2000 M.4.2 Table M.2
 	 * See ISO 18004:2000 M.5 Table M.4
 	 */
-	static const Version allVersions[] = {
+	static constexpr Version allVersions[] = {
 		{1, {
 			7 , 1, 19, 0, 0,
 			10, 1, 16, 0, 0,
@@ -607,21 +607,6 @@ const Version* Version::Model1(int number)
 	return allVersions + number - 1;
 }
 
-Version::Version(int versionNumber, std::initializer_list<int> alignmentPatternCenters, const std::array<ECBlocks, 4>& ecBlocks)
-	: _versionNumber(versionNumber), _alignmentPatternCenters(alignmentPatternCenters), _ecBlocks(ecBlocks),
-	   _type(ecBlocks[0].codewordsPerBlock == 0 ? Type::rMQR : Type::Model2)
-{
-	_totalCodewords = ecBlocks[1].totalDataCodewords(); // Use 1 (M) as 0 dummy for rMQR
-}
-
-Version::Version(int versionNumber, const std::array<ECBlocks, 4>& ecBlocks)
-	: _versionNumber(versionNumber),
-	  _ecBlocks(ecBlocks),
-	  _type(ecBlocks[0].codewordsPerBlock < 7 || ecBlocks[0].codewordsPerBlock == 8 ? Type::Micro : Type::Model1)
-{
-	_totalCodewords = ecBlocks[0].totalDataCodewords();
-}
-
 bool Version::HasValidSize(const BitMatrix& bitMatrix, Type type)
 {
 	return IsValidSize(PointI{bitMatrix.width(), bitMatrix.height()}, type);
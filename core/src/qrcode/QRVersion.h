@@ -33,6 +33,31 @@ constexpr std::array<PointI, 32> RMQR_SIZES {
 };
 // clang-format on
 
+/**
+* Fixed-capacity list of alignment pattern center coordinates. This is a literal type (unlike the
+* std::vector<int> it replaced) so that the Version tables can be constant-initialized into
+* read-only data instead of being constructed behind a guard variable on first use.
+*/
+class AlignmentCenters
+{
+	std::array<int, 7> _data = {}; // 7 suffices up to version 40 (ISO 18004:2006 Annex E)
+	int _size = 0;
+
+public:
+	constexpr AlignmentCenters() = default;
+	constexpr AlignmentCenters(std::initializer_list<int> centers)
+	{
+		for (int c : centers)
+			_data[_size++] = c;
+	}
+
+	constexpr const int* begin() const { return _data.data(); }
+	constexpr const int* end() const { return _data.data() + _size; }
+	constexpr int size() const { return _size; }
+	constexpr bool empty() const { return _size == 0; }
+	constexpr int operator[](int i) const { return _data[i]; }
+};
+
 /**
 * See ISO 18004:2006 Annex D
 */
@@ -47,7 +72,7 @@ public:
 
 	int versionNumber() const { return _versionNumber; }
 
-	const std::vector<int>& alignmentPatternCenters() const { return _alignmentPatternCenters; }
+	const AlignmentCenters& alignmentPatternCenters() const { return _alignmentPatternCenters; }
 
 	int totalCodewords() const { return _totalCodewords; }
 
@@ -114,13 +139,21 @@ public:
 
 private:
 	int _versionNumber;
-	std::vector<int> _alignmentPatternCenters;
+	AlignmentCenters _alignmentPatternCenters;
 	std::array<ECBlocks, 4> _ecBlocks;
 	int _totalCodewords;
 	Type _type;
 
-	Version(int versionNumber, std::initializer_list<int> alignmentPatternCenters, const std::array<ECBlocks, 4> &ecBlocks);
-	Version(int versionNumber, const std::array<ECBlocks, 4>& ecBlocks);
+	constexpr Version(int versionNumber, std::initializer_list<int> alignmentPatternCenters, const std::array<ECBlocks, 4>& ecBlocks)
+		: _versionNumber(versionNumber), _alignmentPatternCenters(alignmentPatternCenters), _ecBlocks(ecBlocks),
+		  _totalCodewords(ecBlocks[1].totalDataCodewords()), // Use 1 (M) as 0 dummy for rMQR
+		  _type(ecBlocks[0].codewordsPerBlock == 0 ? Type::rMQR : Type::Model2)
+	{}
+
+	constexpr Version(int versionNumber, const std::array<ECBlocks, 4>& ecBlocks)
+		: _versionNumber(versionNumber), _ecBlocks(ecBlocks), _totalCodewords(ecBlocks[0].totalDataCodewords()),
+		  _type(ecBlocks[0].codewordsPerBlock < 7 || ecBlocks[0].codewordsPerBlock == 8 ? Type::Micro : Type::Model1)
+	{}
 };
 
 } // QRCode
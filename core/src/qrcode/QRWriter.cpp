@@ -26,7 +26,8 @@ Writer::Writer()
 	  _encoding(CharacterSet::Unknown),
 	  _version(0),
 	  _useGs1Format(false),
-	  _maskPattern(-1)
+	  _maskPattern(-1),
+	  _optimalSegmentation(false)
 {}
 
 BitMatrix Writer::encode(const std::wstring& contents, int width, int height) const
@@ -39,7 +40,7 @@ BitMatrix Writer::encode(const std::wstring& contents, int width, int height) co
 		throw std::invalid_argument("Requested dimensions are invalid");
 	}
 
-	EncodeResult code = Encode(contents, _ecLevel, _encoding, _version, _useGs1Format, _maskPattern);
+	EncodeResult code = Encode(contents, _ecLevel, _encoding, _version, _useGs1Format, _maskPattern, _optimalSegmentation);
 	return Inflate(std::move(code.matrix), width, height, _margin);
 }
 
@@ -58,6 +58,11 @@ public:
 		return *this;
 	}
 
+	Writer& setOptimalSegmentation(bool enable) {
+		_optimalSegmentation = enable;
+		return *this;
+	}
+
 	BitMatrix encode(const std::wstring& contents, int width, int height) const;
 	BitMatrix encode(const std::string& contents, int width, int height) const;
 
@@ -68,6 +73,7 @@ private:
 	int _version;
 	bool _useGs1Format;
 	int _maskPattern;
+	bool _optimalSegmentation;
 };
 
 } // QRCode
@@ -24,7 +24,9 @@ inline ZXing::ImageView ImageViewFromMat(const cv::Mat& image)
 	if (image.depth() != CV_8U || fmt == ImageFormat::None)
 		return {nullptr, 0, 0, ImageFormat::None};
 
-	return {image.data, image.cols, image.rows, fmt};
+	// pass the row stride explicitly: a ROI of a larger Mat or a Mat with padded rows is not
+	// continuous and decodes in place just as well, no .clone() required
+	return {image.data, image.cols, image.rows, fmt, static_cast<int>(image.step)};
 }
 
 inline ZXing::Barcodes ReadBarcodes(const cv::Mat& image, const ZXing::ReaderOptions& options = {})
@@ -32,6 +34,48 @@ inline ZXing::Barcodes ReadBarcodes(const cv::Mat& image, const ZXing::ReaderOpt
 	return ZXing::ReadBarcodes(ImageViewFromMat(image), options);
 }
 
+// UMat overload: getMat(ACCESS_READ) maps the backing store into host memory (a no-op for
+// CPU-backed UMats, a map - not a download copy - for OpenCL ones where the driver supports it)
+inline ZXing::Barcodes ReadBarcodes(const cv::UMat& image, const ZXing::ReaderOptions& options = {})
+{
+	return ReadBarcodes(image.getMat(cv::ACCESS_READ), options);
+}
+
+#ifdef OPENCV_CORE_CUDA_HPP
+// Only available if <opencv2/core/cuda.hpp> is included before this header. GpuMat device memory
+// is not host mappable, so this downloads - but into one reused host buffer instead of a fresh
+// allocation per frame.
+inline ZXing::Barcodes ReadBarcodes(const cv::cuda::GpuMat& image, const ZXing::ReaderOptions& options = {})
+{
+	thread_local cv::Mat host;
+	image.download(host);
+	return ReadBarcodes(host, options);
+}
+#endif
+
+#ifdef ZXING_EXPERIMENTAL_API
+inline ZXing::Barcodes ReadBarcodes(const cv::Mat& image, const std::vector<cv::Rect>& rois,
+									const ZXing::ReaderOptions& options = {})
+{
+	ZXing::Rects zxRois;
+	for (const auto& r : rois)
+		zxRois.push_back({r.x, r.y, r.width, r.height});
+	return ZXing::ReadBarcodes(ImageViewFromMat(image), zxRois, options);
+}
+
+// Batch/threaded decode over a set of independent frames, e.g. all pages of a scanned document.
+// The Mats are read in place on a pool of worker threads, see ReadBarcodesBatch in ReadBarcode.h.
+inline std::vector<ZXing::Barcodes> ReadBarcodesBatch(const std::vector<cv::Mat>& images,
+													  const ZXing::ReaderOptions& options = {}, int nThreads = 0)
+{
+	std::vector<ZXing::ImageView> views;
+	views.reserve(images.size());
+	for (const auto& image : images)
+		views.push_back(ImageViewFromMat(image));
+	return ZXing::ReadBarcodesBatch(views, options, nThreads);
+}
+#endif
+
 inline void DrawBarcode(cv::Mat& img, ZXing::Barcode barcode)
 {
 	auto pos = barcode.position();
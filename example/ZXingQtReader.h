@@ -273,21 +273,26 @@ inline QList<Barcode> ReadBarcodes(const QVideoFrame& frame, const ReaderOptions
 	if (fmt != ImageFormat::None) {
 		auto img = frame; // shallow copy just get access to non-const map() function
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-		if (!img.isValid() || !img.map(QAbstractVideoBuffer::ReadOnly)){
+		if (img.isValid() && img.map(QAbstractVideoBuffer::ReadOnly)) {
 #else
-		if (!img.isValid() || !img.map(QVideoFrame::ReadOnly)){
+		if (img.isValid() && img.map(QVideoFrame::ReadOnly)) {
 #endif
-			qWarning() << "invalid QVideoFrame: could not map memory";
-			return {};
-		}
-		QScopeGuard unmap([&] { img.unmap(); });
+			QScopeGuard unmap([&] { img.unmap(); });
 
-		return ZXBarcodesToQBarcodes(ZXing::ReadBarcodes(
-			{img.bits(FIRST_PLANE) + pixOffset, img.width(), img.height(), fmt, img.bytesPerLine(FIRST_PLANE), pixStride}, opts));
+			// the plane data (for YUV formats: just the Y plane) is decoded in place, there is no
+			// QImage conversion and no YUV->RGB->luminance round trip on this path
+			return ZXBarcodesToQBarcodes(ZXing::ReadBarcodes(
+				{img.bits(FIRST_PLANE) + pixOffset, img.width(), img.height(), fmt, img.bytesPerLine(FIRST_PLANE), pixStride}, opts));
+		}
+		// e.g. RHI/GPU-backed frames on Android cannot be mapped into CPU memory,
+		// fall through to the (much slower) QImage conversion instead of dropping the frame
+		qWarning() << "could not map QVideoFrame, falling back to QImage conversion";
 	}
-	else {
+
+	{
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-		if (QVideoFrame::imageFormatFromPixelFormat(frame.pixelFormat()) != QImage::Format_Invalid) {
+		if (fmt == ImageFormat::None
+			&& QVideoFrame::imageFormatFromPixelFormat(frame.pixelFormat()) != QImage::Format_Invalid) {
 			qWarning() << "unsupported QVideoFrame::pixelFormat";
 			return {};
 		}
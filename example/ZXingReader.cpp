@@ -15,6 +15,7 @@
 #include <cctype>
 #include <chrono>
 #include <cstring>
+#include <future>
 #include <iostream>
 #include <iterator>
 #include <memory>
@@ -34,6 +35,8 @@ struct CLI
 	std::string outPath;
 	int forceChannels = 0;
 	int rotate = 0;
+	int numThreads = 1;
+	bool bench = false;
 	bool oneLine = false;
 	bool bytesOnly = false;
 	bool showSymbol = false;
@@ -55,6 +58,8 @@ static void PrintUsage(const char* exePath)
 			  << "               Binarizer to be used for gray to binary conversion\n"
 			  << "    -mode <plain|eci|hri|escaped>\n"
 			  << "               Text mode used to render the raw byte content into text\n"
+			  << "    -j <N>     Process multiple files with N parallel threads (overlaps image loading and decoding)\n"
+			  << "    -bench     Print aggregate throughput statistics after processing all files\n"
 			  << "    -1         Print only file name, content/error on one line per file/barcode (implies '-mode Escaped')\n"
 #ifdef ZXING_EXPERIMENTAL_API
 			  << "    -symbol    Print the detected symbol (if available)\n"
@@ -149,6 +154,12 @@ static bool ParseOptions(int argc, char* argv[], ReaderOptions& options, CLI& cl
 			if (++i == argc)
 				return false;
 			cli.rotate = std::stoi(argv[i]);
+		} else if (is("-j")) {
+			if (++i == argc)
+				return false;
+			cli.numThreads = std::max(1, std::stoi(argv[i]));
+		} else if (is("-bench")) {
+			cli.bench = true;
 		} else if (is("-help") || is("--help")) {
 			PrintUsage(argv[0]);
 			exit(0);
@@ -205,21 +216,56 @@ int main(int argc, char* argv[])
 	if (!cli.outPath.empty())
 		cli.forceChannels = 3; // the drawing code only works for RGB data
 
-	for (const auto& filePath : cli.filePaths) {
-		int width, height, channels;
-		std::unique_ptr<stbi_uc, void (*)(void*)> buffer(
-			filePath == "-" ? stbi_load_from_file(stdin, &width, &height, &channels, cli.forceChannels)
-							: stbi_load(filePath.c_str(), &width, &height, &channels, cli.forceChannels),
-			stbi_image_free);
-		if (buffer == nullptr) {
+	struct LoadedFile
+	{
+		std::unique_ptr<stbi_uc, void (*)(void*)> buffer{nullptr, stbi_image_free};
+		int width = 0, height = 0, channels = 0;
+		Barcodes barcodes;
+	};
+
+	auto loadAndDecode = [&](const std::string& filePath) {
+		LoadedFile res;
+		res.buffer.reset(filePath == "-" ? stbi_load_from_file(stdin, &res.width, &res.height, &res.channels, cli.forceChannels)
+										 : stbi_load(filePath.c_str(), &res.width, &res.height, &res.channels, cli.forceChannels));
+		if (res.buffer == nullptr)
+			return res;
+		res.channels = cli.forceChannels ? cli.forceChannels : res.channels;
+
+		auto ImageFormatFromChannels = std::array{ImageFormat::None, ImageFormat::Lum, ImageFormat::LumA, ImageFormat::RGB, ImageFormat::RGBA};
+		ImageView image{res.buffer.get(), res.width, res.height, ImageFormatFromChannels.at(res.channels)};
+		res.barcodes = ReadBarcodes(image.rotated(cli.rotate), options);
+		return res;
+	};
+
+	auto startTime = std::chrono::steady_clock::now();
+	int64_t totalPixels = 0;
+	int totalBarcodes = 0;
+
+	// With -j N, files are processed in blocks of N asynchronous load+decode tasks, which overlaps the
+	// image loading I/O of one file with the barcode decoding of others. Results are printed in input
+	// order and the block size bounds the number of decompressed images held in memory at once.
+	std::vector<std::future<LoadedFile>> futures;
+
+	for (int fileIndex = 0; fileIndex < Size(cli.filePaths); ++fileIndex) {
+		const auto& filePath = cli.filePaths[fileIndex];
+		if (cli.numThreads > 1 && fileIndex % cli.numThreads == 0) {
+			futures.clear();
+			for (int i = fileIndex; i < std::min(fileIndex + cli.numThreads, Size(cli.filePaths)); ++i)
+				futures.push_back(std::async(std::launch::async, loadAndDecode, cli.filePaths[i]));
+		}
+		auto res = cli.numThreads > 1 ? futures[fileIndex % cli.numThreads].get() : loadAndDecode(filePath);
+		if (res.buffer == nullptr) {
 			std::cerr << "Failed to read image: " << filePath << " (" << stbi_failure_reason() << ")" << "\n";
 			return -1;
 		}
-		channels = cli.forceChannels ? cli.forceChannels : channels;
 
-		auto ImageFormatFromChannels = std::array{ImageFormat::None, ImageFormat::Lum, ImageFormat::LumA, ImageFormat::RGB, ImageFormat::RGBA};
-		ImageView image{buffer.get(), width, height, ImageFormatFromChannels.at(channels)};
-		auto barcodes = ReadBarcodes(image.rotated(cli.rotate), options);
+		ImageView image{res.buffer.get(), res.width, res.height,
+						std::array{ImageFormat::None, ImageFormat::Lum, ImageFormat::LumA, ImageFormat::RGB,
+								   ImageFormat::RGBA}.at(res.channels)};
+		auto barcodes = std::move(res.barcodes);
+
+		totalPixels += int64_t(res.width) * res.height;
+		totalBarcodes += Size(barcodes);
 
 		// if we did not find anything, insert a dummy to produce some output for each file
 		if (barcodes.empty())
@@ -341,5 +387,12 @@ int main(int argc, char* argv[])
 #endif
 	}
 
+	if (cli.bench) {
+		auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+		printf("processed %d files (%d barcodes, %.1f MPixel) in %.2f s with %d thread(s): %.1f files/s, %.1f MPixel/s\n",
+			   Size(cli.filePaths), totalBarcodes, totalPixels / 1e6, seconds, cli.numThreads, Size(cli.filePaths) / seconds,
+			   totalPixels / 1e6 / seconds);
+	}
+
 	return ret;
 }
@@ -0,0 +1,188 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "BitMatrix.h"
+#include "CharacterSet.h"
+#include "GenericGF.h"
+#include "GlobalHistogramBinarizer.h"
+#include "GridSampler.h"
+#include "HybridBinarizer.h"
+#include "MultiFormatWriter.h"
+#include "Pattern.h"
+#include "PerspectiveTransform.h"
+#include "Quadrilateral.h"
+#include "ReadBarcode.h"
+#include "ReedSolomonDecoder.h"
+#include "ReedSolomonEncoder.h"
+#include "ZXAlgorithms.h"
+#include "qrcode/QRDetector.h"
+#include "qrcode/QRVersion.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace ZXing;
+
+namespace {
+
+constexpr int MARGIN = 10; // modules of quiet zone around the rendered symbols
+constexpr int SCALE = 4;   // pixels per module, roughly what a 'good' camera frame looks like
+
+// Render text into a symbol with MARGIN and scale it up to SCALE pixels per module.
+BitMatrix RenderSymbol(BarcodeFormat format, const std::string& text)
+{
+	auto matrix = MultiFormatWriter(format).setMargin(MARGIN).encode(text, 0, 0);
+	int width = matrix.width() * SCALE, height = matrix.height() * SCALE;
+	return Inflate(std::move(matrix), width, height, 0);
+}
+
+Matrix<uint8_t> RenderLumImage(BarcodeFormat format, const std::string& text)
+{
+	return ToMatrix<uint8_t>(RenderSymbol(format, text));
+}
+
+ImageView ImageViewOf(const Matrix<uint8_t>& lum)
+{
+	return {lum.data(), lum.width(), lum.height(), ImageFormat::Lum};
+}
+
+void BM_ReadBarcodes(benchmark::State& state, BarcodeFormat format, const std::string& text)
+{
+	auto lum = RenderLumImage(format, text);
+	auto opts = ReaderOptions().setFormats(format);
+
+	for (auto _ : state) {
+		auto barcodes = ReadBarcodes(ImageViewOf(lum), opts);
+		if (barcodes.empty() || !barcodes.front().isValid())
+			state.SkipWithError("failed to decode the rendered symbol");
+		benchmark::DoNotOptimize(barcodes);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_ReadBarcodes, QRCode, BarcodeFormat::QRCode, "BENCHMARK CONTENT 1234567890");
+BENCHMARK_CAPTURE(BM_ReadBarcodes, DataMatrix, BarcodeFormat::DataMatrix, "BENCHMARK CONTENT 1234567890");
+BENCHMARK_CAPTURE(BM_ReadBarcodes, Aztec, BarcodeFormat::Aztec, "BENCHMARK CONTENT 1234567890");
+BENCHMARK_CAPTURE(BM_ReadBarcodes, PDF417, BarcodeFormat::PDF417, "BENCHMARK CONTENT 1234567890");
+BENCHMARK_CAPTURE(BM_ReadBarcodes, Code128, BarcodeFormat::Code128, "BENCHMARK-1234567890");
+BENCHMARK_CAPTURE(BM_ReadBarcodes, EAN13, BarcodeFormat::EAN13, "5901234123457");
+
+// ExtractLum(SIMD) is internal to ReadBarcode.cpp, so the RGBA -> Lum conversion is exercised
+// via the packed pixel input path. Compare against BM_ReadBarcodes/QRCode for the Lum baseline.
+void BM_ReadBarcodesRGBA(benchmark::State& state)
+{
+	auto lum = RenderLumImage(BarcodeFormat::QRCode, "BENCHMARK CONTENT 1234567890");
+	std::vector<uint8_t> rgba(lum.size() * 4);
+	for (int i = 0; i < lum.size(); ++i)
+		rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = *(lum.data() + i), rgba[i * 4 + 3] = 0xff;
+	ImageView iv(rgba.data(), lum.width(), lum.height(), ImageFormat::RGBA);
+	auto opts = ReaderOptions().setFormats(BarcodeFormat::QRCode);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(ReadBarcodes(iv, opts));
+}
+
+BENCHMARK(BM_ReadBarcodesRGBA);
+
+template <typename Binarizer>
+void BM_Binarize(benchmark::State& state)
+{
+	auto lum = RenderLumImage(BarcodeFormat::QRCode, "BENCHMARK CONTENT 1234567890");
+
+	for (auto _ : state) {
+		Binarizer binarizer(ImageViewOf(lum));
+		benchmark::DoNotOptimize(binarizer.getBitMatrix());
+	}
+	state.SetBytesProcessed(state.iterations() * lum.size());
+}
+
+BENCHMARK_TEMPLATE(BM_Binarize, HybridBinarizer);
+BENCHMARK_TEMPLATE(BM_Binarize, GlobalHistogramBinarizer);
+
+void BM_GetPatternRow(benchmark::State& state)
+{
+	auto image = RenderSymbol(BarcodeFormat::QRCode, "BENCHMARK CONTENT 1234567890");
+	PatternRow row;
+
+	for (auto _ : state)
+		for (int y = 0; y < image.height(); ++y)
+			GetPatternRow(image.row(y), row);
+	state.SetItemsProcessed(state.iterations() * image.height());
+}
+
+BENCHMARK(BM_GetPatternRow);
+
+void BM_FindFinderPatterns(benchmark::State& state)
+{
+	auto image = RenderSymbol(BarcodeFormat::QRCode, "BENCHMARK CONTENT 1234567890");
+	bool tryHarder = state.range(0);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(QRCode::FindFinderPatterns(image, tryHarder));
+}
+
+BENCHMARK(BM_FindFinderPatterns)->Arg(0)->Arg(1);
+
+void BM_SampleGrid(benchmark::State& state)
+{
+	auto image = RenderSymbol(BarcodeFormat::QRCode, "BENCHMARK CONTENT 1234567890");
+	int dim = image.width() / SCALE - 2 * MARGIN; // modules of the symbol itself
+	auto off = PointF(MARGIN * SCALE, MARGIN * SCALE);
+	auto mod2Pix = PerspectiveTransform(
+		Rectangle(dim, dim, 0),
+		{off, off + PointF(dim * SCALE, 0), off + PointF(dim * SCALE, dim * SCALE), off + PointF(0, dim * SCALE)});
+
+	for (auto _ : state) {
+		auto res = SampleGrid(image, dim, dim, mod2Pix);
+		if (!res.isValid())
+			state.SkipWithError("failed to sample the rendered symbol");
+		benchmark::DoNotOptimize(res);
+	}
+}
+
+BENCHMARK(BM_SampleGrid);
+
+void BM_ReedSolomonDecode(benchmark::State& state)
+{
+	const auto& field = GenericGF::QRCodeField256();
+	const int numECCodeWords = narrow_cast<int>(state.range(0));
+	const int numErrors = numECCodeWords / 2;
+
+	std::vector<int> message(128 + numECCodeWords);
+	std::mt19937 rng(42);
+	for (int i = 0; i < Size(message) - numECCodeWords; ++i)
+		message[i] = rng() % 256;
+	ReedSolomonEncode(field, message, numECCodeWords);
+	for (int i = 0; i < numErrors; ++i)
+		message[rng() % message.size()] ^= 0x55;
+
+	for (auto _ : state) {
+		auto msg = message;
+		if (!ReedSolomonDecode(field, msg, numECCodeWords))
+			state.SkipWithError("failed to correct the introduced errors");
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ReedSolomonDecode)->Arg(10)->Arg(30);
+
+// Exercises the static lookup tables (QR version data, charset names) that used to be built lazily
+// on first use. With constant initialization this is a pure table walk with no guard checks; the
+// first iteration is no more expensive than any other.
+void BM_StaticTableLookup(benchmark::State& state)
+{
+	for (auto _ : state) {
+		for (int number = 1; number <= 40; ++number)
+			benchmark::DoNotOptimize(QRCode::Version::Model2(number));
+		benchmark::DoNotOptimize(CharacterSetFromString("ISO-8859-15"));
+		benchmark::DoNotOptimize(CharacterSetFromString("windows-1256"));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_StaticTableLookup);
+
+} // namespace
@@ -6,15 +6,20 @@
 
 #include "BlackboxTestRunner.h"
 
+#include "GlobalHistogramBinarizer.h"
+#include "HybridBinarizer.h"
 #include "ImageLoader.h"
 #include "ReadBarcode.h"
+#include "ThresholdBinarizer.h"
 #include "Utf.h"
 #include "ZXAlgorithms.h"
 
 #include <fmt/core.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <exception>
 #include <fstream>
 #include <map>
@@ -154,6 +159,28 @@ static int failed = 0;
 static int extra = 0;
 static int totalImageLoadTime = 0;
 
+// performance mode (PERF=<N> environment variable): each image is decoded N times and the latency
+// distribution is reported per test case, optionally as machine-readable JSON (PERF_JSON=<path>)
+static int perfRepeats = 0;
+
+namespace {
+	struct PerfRecord
+	{
+		std::string folder, tc, image;
+		int rotation;
+		int64_t binarizeUs; // the binarization stage timed on its own (core has no per-stage instrumentation)
+		std::vector<int64_t> samplesUs;
+	};
+}
+static std::vector<PerfRecord> perfRecords;
+
+static int64_t percentile(std::vector<int64_t> v, double p)
+{
+	auto nth = v.begin() + std::min(Size(v) - 1, static_cast<int>(p * Size(v)));
+	std::nth_element(v.begin(), nth, v.end());
+	return *nth;
+}
+
 int timeSince(std::chrono::steady_clock::time_point startTime)
 {
 	auto duration = std::chrono::steady_clock::now() - startTime;
@@ -238,7 +265,31 @@ static void doRunTests(const fs::path& directory, std::string_view format, int t
 			if (opts.isPure())
 				opts.setBinarizer(Binarizer::FixedThreshold);
 			for (const auto& imgPath : imgPaths) {
-				auto barcode = ReadBarcode(ImageLoader::load(imgPath).rotated(test.rotation), opts);
+				auto image = ImageLoader::load(imgPath).rotated(test.rotation);
+				Barcode barcode;
+				if (perfRepeats) {
+					auto usSince = [](std::chrono::steady_clock::time_point t0) {
+						return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0)
+							.count();
+					};
+					std::vector<int64_t> samples(perfRepeats);
+					for (auto& sample : samples) {
+						auto t0 = std::chrono::steady_clock::now();
+						barcode = ReadBarcode(image, opts);
+						sample = usSince(t0);
+					}
+					auto t0 = std::chrono::steady_clock::now();
+					switch (opts.binarizer()) {
+					case Binarizer::LocalAverage: HybridBinarizer(image).getBitMatrix(); break;
+					case Binarizer::GlobalHistogram: GlobalHistogramBinarizer(image).getBitMatrix(); break;
+					case Binarizer::FixedThreshold: ThresholdBinarizer(image, 127).getBitMatrix(); break;
+					case Binarizer::BoolCast: ThresholdBinarizer(image, 0).getBitMatrix(); break;
+					}
+					perfRecords.push_back({folderName.string(), tc.name, imgPath.filename().string(), test.rotation,
+										   usSince(t0), std::move(samples)});
+				} else {
+					barcode = ReadBarcode(image, opts);
+				}
 				if (barcode.isValid()) {
 					auto error = checkResult(imgPath, format, barcode);
 					if (!error.empty())
@@ -329,6 +380,13 @@ int runBlackBoxTests(const fs::path& testPathPrefix, const std::set<std::string>
 			doRunStructuredAppendTest(testPathPrefix / directory, format, total, tests);
 	};
 
+	if (auto var = getenv("PERF"))
+		perfRepeats = std::max(0, std::atoi(var));
+
+	if (auto var = getenv("CORPUS"))
+		if (!ImageLoader::useCorpus(var))
+			fmt::print(stderr, "failed to open corpus file {}, falling back to decoding images\n", var);
+
 	try
 	{
 		auto startTime = std::chrono::steady_clock::now();
@@ -685,6 +743,35 @@ int runBlackBoxTests(const fs::path& testPathPrefix, const std::set<std::string>
 		fmt::print("load time:   {} ms.\n", totalImageLoadTime);
 		fmt::print("decode time: {} ms.\n", decodeTime);
 		fmt::print("total time:  {} ms.\n", totalTime);
+
+		if (perfRepeats) {
+			fmt::print("\nlatency per test case ({} runs per image):\n", perfRepeats);
+			std::map<std::string, std::pair<std::vector<int64_t>, int64_t>> byCase; // all samples + summed binarize time
+			for (const auto& r : perfRecords) {
+				auto& [samples, binarizeUs] = byCase[fmt::format("{} @ {:3} ({})", r.folder, r.rotation, r.tc)];
+				samples.insert(samples.end(), r.samplesUs.begin(), r.samplesUs.end());
+				binarizeUs += r.binarizeUs;
+			}
+			for (const auto& [name, data] : byCase) {
+				const auto& [samples, binarizeUs] = data;
+				auto totalUs = std::max<int64_t>(1, Reduce(samples) / perfRepeats);
+				fmt::print("{:32} | p50: {:6} us | p99: {:6} us | binarize: {:4.1f}%\n", name, percentile(samples, 0.5),
+						   percentile(samples, 0.99), 100.0 * binarizeUs / totalUs);
+			}
+
+			if (auto path = getenv("PERF_JSON")) {
+				std::ofstream json(path);
+				json << "[\n";
+				for (const auto& r : perfRecords)
+					json << fmt::format(
+						"{{\"test\": \"{}\", \"tc\": \"{}\", \"rotation\": {}, \"image\": \"{}\", \"p50_us\": {}, "
+						"\"p99_us\": {}, \"binarize_us\": {}}}{}\n",
+						r.folder, r.tc, r.rotation, r.image, percentile(r.samplesUs, 0.5), percentile(r.samplesUs, 0.99),
+						r.binarizeUs, &r != &perfRecords.back() ? "," : "");
+				json << "]\n";
+				fmt::print("perf data written to {}\n", path);
+			}
+		}
 		if (failed)
 			fmt::print("WARNING: {} tests failed.\n", failed);
 		if (extra)
@@ -0,0 +1,177 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CorpusFile.h"
+
+#include "ImageLoader.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ZXing::Test {
+
+/*
+ * Corpus file layout (all integers little-endian):
+ *   Header:      char[8] magic "ZXCORPUS", uint32 version, uint32 count, uint64 indexOffset
+ *   Frames:      count raw Lum frames (width * height bytes each), concatenated
+ *   Index:       count entries of {uint64 frameOffset, int32 width, int32 height, uint32 nameLen, char[nameLen] name}
+ */
+
+namespace {
+
+constexpr char MAGIC[8] = {'Z', 'X', 'C', 'O', 'R', 'P', 'U', 'S'};
+constexpr uint32_t VERSION = 1;
+
+template <typename T>
+T ReadValue(const uint8_t*& pos, const uint8_t* end)
+{
+	if (pos + sizeof(T) > end)
+		throw std::runtime_error("corrupted corpus file: truncated index");
+	T val;
+	memcpy(&val, pos, sizeof(T));
+	pos += sizeof(T);
+	return val;
+}
+
+template <typename T>
+void WriteValue(std::ofstream& out, T val)
+{
+	out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+} // namespace
+
+bool CorpusFile::open(const fs::path& corpusPath)
+{
+	close();
+
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+
+#ifndef _WIN32
+	int fd = ::open(corpusPath.string().c_str(), O_RDONLY);
+	if (fd == -1)
+		return false;
+	struct stat st;
+	fstat(fd, &st);
+	_mappingSize = st.st_size;
+	_mapping = mmap(nullptr, _mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (_mapping == MAP_FAILED) {
+		_mapping = nullptr;
+		return false;
+	}
+	data = static_cast<const uint8_t*>(_mapping);
+	size = _mappingSize;
+#else
+	std::ifstream file(corpusPath, std::ios::binary);
+	if (!file)
+		return false;
+	_fallback.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	data = _fallback.data();
+	size = _fallback.size();
+#endif
+
+	const uint8_t* pos = data;
+	const uint8_t* end = data + size;
+	if (size < 24 || memcmp(pos, MAGIC, sizeof(MAGIC)) != 0)
+		throw std::runtime_error("not a corpus file: " + corpusPath.string());
+	pos += sizeof(MAGIC);
+	if (auto version = ReadValue<uint32_t>(pos, end); version != VERSION)
+		throw std::runtime_error("unsupported corpus file version: " + std::to_string(version));
+	auto count = ReadValue<uint32_t>(pos, end);
+	auto indexOffset = ReadValue<uint64_t>(pos, end);
+
+	pos = data + indexOffset;
+	for (uint32_t i = 0; i < count; ++i) {
+		auto offset = ReadValue<uint64_t>(pos, end);
+		auto width = ReadValue<int32_t>(pos, end);
+		auto height = ReadValue<int32_t>(pos, end);
+		auto nameLen = ReadValue<uint32_t>(pos, end);
+		if (pos + nameLen > end || offset + uint64_t(width) * height > size)
+			throw std::runtime_error("corrupted corpus file: frame out of bounds");
+		std::string name(reinterpret_cast<const char*>(pos), nameLen);
+		pos += nameLen;
+		_index.emplace(std::move(name), ImageView(data + offset, width, height, ImageFormat::Lum));
+	}
+
+	return true;
+}
+
+void CorpusFile::close()
+{
+#ifndef _WIN32
+	if (_mapping)
+		munmap(_mapping, _mappingSize);
+#endif
+	_mapping = nullptr;
+	_mappingSize = 0;
+	_fallback.clear();
+	_index.clear();
+}
+
+const ImageView* CorpusFile::find(const std::string& name) const
+{
+	auto it = _index.find(name);
+	return it != _index.end() ? &it->second : nullptr;
+}
+
+void CorpusFile::Pack(const std::vector<fs::path>& imgPaths, const fs::path& corpusPath)
+{
+	std::ofstream out(corpusPath, std::ios::binary);
+	if (!out)
+		throw std::runtime_error("failed to open corpus file for writing: " + corpusPath.string());
+
+	struct Entry
+	{
+		uint64_t offset;
+		int32_t width, height;
+		std::string name;
+	};
+	std::vector<Entry> entries;
+
+	out.write(MAGIC, sizeof(MAGIC));
+	WriteValue(out, VERSION);
+	WriteValue(out, static_cast<uint32_t>(imgPaths.size()));
+	WriteValue(out, uint64_t(0)); // indexOffset, patched below
+
+	for (const auto& imgPath : imgPaths) {
+		const auto& iv = ImageLoader::load(imgPath);
+		entries.push_back({static_cast<uint64_t>(out.tellp()), iv.width(), iv.height(), imgPath.filename().string()});
+
+		for (int y = 0; y < iv.height(); ++y)
+			for (int x = 0; x < iv.width(); ++x) {
+				const uint8_t* p = iv.data(x, y);
+				uint8_t lum = PixStride(iv.format()) < 3
+								  ? p[0]
+								  : RGBToLum(p[RedIndex(iv.format())], p[GreenIndex(iv.format())], p[BlueIndex(iv.format())]);
+				out.put(static_cast<char>(lum));
+			}
+
+		ImageLoader::clearCache(); // keep at most one decoded image in memory
+	}
+
+	uint64_t indexOffset = out.tellp();
+	for (const auto& e : entries) {
+		WriteValue(out, e.offset);
+		WriteValue(out, e.width);
+		WriteValue(out, e.height);
+		WriteValue(out, static_cast<uint32_t>(e.name.size()));
+		out.write(e.name.data(), e.name.size());
+	}
+
+	out.seekp(16); // position of indexOffset in the header
+	WriteValue(out, indexOffset);
+}
+
+} // namespace ZXing::Test
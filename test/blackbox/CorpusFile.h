@@ -0,0 +1,49 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ImageView.h"
+#include "ZXFilesystem.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ZXing::Test {
+
+/**
+ * A preprocessed image corpus: raw Lum frames concatenated in a single file with an offset index,
+ * memory-mapped on POSIX platforms. Scanning straight from the mapping involves no image decoding
+ * and the resident memory is bounded by the pages the kernel keeps warm, not by the corpus size.
+ */
+class CorpusFile
+{
+	void* _mapping = nullptr;
+	size_t _mappingSize = 0;
+	std::vector<uint8_t> _fallback; // used where mmap is unavailable
+	std::map<std::string, ImageView> _index;
+
+public:
+	CorpusFile() = default;
+	CorpusFile(const CorpusFile&) = delete;
+	CorpusFile& operator=(const CorpusFile&) = delete;
+	~CorpusFile() { close(); }
+
+	bool open(const fs::path& corpusPath);
+	void close();
+
+	bool isOpen() const { return !_index.empty(); }
+
+	/// Lum frame for the given file name (without directory) or nullptr if not in the corpus.
+	const ImageView* find(const std::string& name) const;
+
+	const std::map<std::string, ImageView>& images() const { return _index; }
+
+	/// Decode the given images (any format stb_image supports) and write them as one corpus file.
+	static void Pack(const std::vector<fs::path>& imgPaths, const fs::path& corpusPath);
+};
+
+} // namespace ZXing::Test
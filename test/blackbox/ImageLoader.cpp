@@ -7,6 +7,7 @@
 #include "ImageLoader.h"
 
 #include "BinaryBitmap.h"
+#include "CorpusFile.h"
 #include "ImageView.h"
 
 #include <array>
@@ -49,16 +50,26 @@ public:
 };
 
 std::map<fs::path, STBImage> cache;
+CorpusFile corpus;
 
 void ImageLoader::clearCache()
 {
 	cache.clear();
 }
 
+bool ImageLoader::useCorpus(const fs::path& corpusPath)
+{
+	return corpus.open(corpusPath);
+}
+
 const ImageView& ImageLoader::load(const fs::path& imgPath)
 {
 	thread_local std::unique_ptr<BinaryBitmap> localAverage, threshold;
 
+	if (corpus.isOpen())
+		if (auto* iv = corpus.find(imgPath.filename().string()))
+			return *iv;
+
 	auto& binImg = cache[imgPath];
 	if (!binImg)
 		binImg.load(imgPath);
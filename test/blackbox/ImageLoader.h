@@ -13,4 +13,8 @@ namespace ZXing::Test::ImageLoader {
 void clearCache();
 const ImageView& load(const fs::path& imgPath);
 
+// Serve subsequent load() calls (matched by file name) straight from a memory-mapped corpus
+// file (see CorpusFile.h) instead of decoding the individual images.
+bool useCorpus(const fs::path& corpusPath);
+
 } // namespace ZXing::Test::ImageLoader
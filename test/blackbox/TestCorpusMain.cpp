@@ -0,0 +1,74 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CorpusFile.h"
+#include "ReadBarcode.h"
+#include "ZXAlgorithms.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fmt/core.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace ZXing;
+using namespace ZXing::Test;
+
+int main(int argc, char** argv)
+{
+	if (argc < 3) {
+		fmt::print("Usage: {} pack <image_directory> <corpus_file>\n"
+				   "       {} list <corpus_file>\n"
+				   "       {} scan <corpus_file>\n"
+				   "Packs an image directory into a single mmap-able corpus file of raw Lum frames,\n"
+				   "lists its contents or scans all frames straight from the mapping (no image decoding).\n",
+				   argv[0], argv[0], argv[0]);
+		return 0;
+	}
+
+	try {
+		if (strcmp(argv[1], "pack") == 0 && argc == 4) {
+			std::vector<fs::path> imgPaths;
+			for (const auto& entry : fs::recursive_directory_iterator(argv[2]))
+				if (Contains({".png", ".jpg", ".pgm", ".gif"}, entry.path().extension()))
+					imgPaths.push_back(entry.path());
+			std::sort(imgPaths.begin(), imgPaths.end());
+
+			CorpusFile::Pack(imgPaths, argv[3]);
+			fmt::print("packed {} images into {} ({} MB)\n", imgPaths.size(), argv[3], fs::file_size(argv[3]) / (1024 * 1024));
+		} else if (strcmp(argv[1], "list") == 0) {
+			CorpusFile corpus;
+			if (!corpus.open(argv[2]))
+				throw std::runtime_error(std::string("failed to open ") + argv[2]);
+			for (const auto& [name, iv] : corpus.images())
+				fmt::print("{:<40} {:>5} x {:>5}\n", name, iv.width(), iv.height());
+		} else if (strcmp(argv[1], "scan") == 0) {
+			CorpusFile corpus;
+			if (!corpus.open(argv[2]))
+				throw std::runtime_error(std::string("failed to open ") + argv[2]);
+
+			auto opts = ReaderOptions().setTryHarder(true).setTryRotate(true).setTryInvert(true);
+			auto startTime = std::chrono::steady_clock::now();
+			int found = 0;
+			for (const auto& [name, iv] : corpus.images()) {
+				auto barcodes = ReadBarcodes(iv, opts);
+				found += Size(barcodes);
+				for (const auto& barcode : barcodes)
+					fmt::print("{} {} \"{}\"\n", name, ToString(barcode.format()), barcode.text());
+			}
+			auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+			fmt::print("scanned {} frames in {:.2f} s, found {} barcodes\n", corpus.images().size(), seconds, found);
+		} else {
+			fmt::print(stderr, "unknown command: {}\n", argv[1]);
+			return 1;
+		}
+	} catch (const std::exception& e) {
+		fmt::print(stderr, "{}\n", e.what());
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,198 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ImageLoader.h"
+#include "ReadBarcode.h"
+#include "ZXAlgorithms.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fmt/core.h>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#include <sys/resource.h>
+#endif
+
+using namespace ZXing;
+using namespace ZXing::Test;
+
+// Global allocation counters, updated by the operator new/delete replacements below. The harness
+// snapshots them around each ReadBarcodes call, so anything the decoder allocates is attributed
+// to the image being processed.
+static std::atomic<int64_t> numAllocs{0};
+static std::atomic<int64_t> numBytes{0};
+static std::atomic<int64_t> liveBytes{0};
+static std::atomic<int64_t> peakLiveBytes{0};
+
+static void countAlloc(void* p, size_t size)
+{
+	numAllocs.fetch_add(1, std::memory_order_relaxed);
+	numBytes.fetch_add(size, std::memory_order_relaxed);
+#ifdef __GLIBC__
+	auto live = liveBytes.fetch_add(malloc_usable_size(p), std::memory_order_relaxed) + (int64_t)malloc_usable_size(p);
+	auto peak = peakLiveBytes.load(std::memory_order_relaxed);
+	while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+		;
+#else
+	(void)p;
+#endif
+}
+
+static void countFree(void* p)
+{
+#ifdef __GLIBC__
+	if (p)
+		liveBytes.fetch_sub(malloc_usable_size(p), std::memory_order_relaxed);
+#else
+	(void)p;
+#endif
+}
+
+void* operator new(size_t size)
+{
+	void* p = malloc(size);
+	if (!p)
+		throw std::bad_alloc();
+	countAlloc(p, size);
+	return p;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, std::align_val_t al)
+{
+	void* p = aligned_alloc(static_cast<size_t>(al), size);
+	if (!p)
+		throw std::bad_alloc();
+	countAlloc(p, size);
+	return p;
+}
+
+void* operator new[](size_t size, std::align_val_t al)
+{
+	return operator new(size, al);
+}
+
+void operator delete(void* p) noexcept
+{
+	countFree(p);
+	free(p);
+}
+
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+void operator delete(void* p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { operator delete(p); }
+
+namespace {
+
+struct Sample
+{
+	fs::path image;
+	std::string format;
+	int64_t allocs, bytes, peak;
+};
+
+int64_t peakRSSBytes()
+{
+#ifdef __GLIBC__
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss * 1024;
+#else
+	return 0;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	fs::path directory;
+	int64_t maxAllocs = 0, maxBytes = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-max-allocs") == 0 && i + 1 < argc)
+			maxAllocs = std::stoll(argv[++i]);
+		else if (strcmp(argv[i], "-max-bytes") == 0 && i + 1 < argc)
+			maxBytes = std::stoll(argv[++i]);
+		else
+			directory = argv[i];
+	}
+
+	if (directory.empty()) {
+		fmt::print("Usage: {} [-max-allocs N] [-max-bytes N] <image_directory>\n", argv[0]);
+		fmt::print("Runs ReadBarcodes over every image below <image_directory> under a counting allocator\n"
+				   "and reports allocations/bytes/peak-heap per image and per format. If a per-image\n"
+				   "threshold is given and exceeded, the offending images are listed and the exit code is 1.\n");
+		return 0;
+	}
+
+	auto opts = ReaderOptions().setTryHarder(true).setTryRotate(true).setTryInvert(true);
+	if (getenv("FORMATS"))
+		opts.setFormats(BarcodeFormatsFromString(getenv("FORMATS")));
+
+	std::vector<fs::path> imgPaths;
+	for (const auto& entry : fs::recursive_directory_iterator(directory))
+		if (Contains({".png", ".jpg", ".pgm", ".gif"}, entry.path().extension()))
+			imgPaths.push_back(entry.path());
+	std::sort(imgPaths.begin(), imgPaths.end());
+
+	if (imgPaths.empty()) {
+		fmt::print(stderr, "No images found below {}\n", directory.string());
+		return 1;
+	}
+
+	std::vector<Sample> samples;
+	for (const auto& imgPath : imgPaths) {
+		const auto& image = ImageLoader::load(imgPath);
+		// warm-up run, so one-time lazy initializations are not attributed to the first image
+		auto barcodes = ReadBarcodes(image, opts);
+
+		auto allocs0 = numAllocs.load(), bytes0 = numBytes.load();
+		peakLiveBytes.store(liveBytes.load());
+		barcodes = ReadBarcodes(image, opts);
+
+		samples.push_back({imgPath, barcodes.empty() ? "none" : ToString(barcodes.front().format()),
+						   numAllocs.load() - allocs0, numBytes.load() - bytes0, peakLiveBytes.load() - liveBytes.load()});
+		ImageLoader::clearCache(); // keep the cache from skewing the live-heap baseline
+	}
+
+	fmt::print("{:<16} | {:>6} | {:>10} | {:>10} | {:>12} | {:>12}\n", "Format", "Images", "Allocs/img", "Max Allocs", "Bytes/img",
+			   "Max Bytes");
+	std::map<std::string, std::vector<const Sample*>> byFormat;
+	for (const auto& s : samples)
+		byFormat[s.format].push_back(&s);
+	for (const auto& [format, list] : byFormat) {
+		int64_t allocs = 0, bytes = 0, maxA = 0, maxB = 0;
+		for (const auto* s : list)
+			allocs += s->allocs, bytes += s->bytes, maxA = std::max(maxA, s->allocs), maxB = std::max(maxB, s->bytes);
+		fmt::print("{:<16} | {:>6} | {:>10} | {:>10} | {:>12} | {:>12}\n", format, list.size(), allocs / Size(list), maxA,
+				   bytes / Size(list), maxB);
+	}
+	fmt::print("\npeak RSS: {} MB\n", peakRSSBytes() / (1024 * 1024));
+
+	int ret = 0;
+	for (const auto& s : samples) {
+		if ((maxAllocs && s.allocs > maxAllocs) || (maxBytes && s.bytes > maxBytes)) {
+			fmt::print(stderr, "REGRESSION: {}: {} allocs, {} bytes (peak heap: {} bytes)\n", s.image.string(), s.allocs, s.bytes,
+					   s.peak);
+			ret = 1;
+		}
+	}
+	return ret;
+}
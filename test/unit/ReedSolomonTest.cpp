@@ -84,6 +84,28 @@ namespace {
 		}
 	}
 
+	void TestErasureDecoder(const GenericGF& field, const std::vector<int>& dataWords, const std::vector<int>& ecWords) {
+		PseudoRandom random(0x12345678);
+		for (size_t numErasures = 0; numErasures <= ecWords.size(); numErasures += std::max(size_t(1), ecWords.size() / 4)) {
+			// 2 * errors + erasures <= ecWords => fill the remaining capacity with regular errors
+			size_t numErrors = (ecWords.size() - numErasures) / 2;
+			auto sent = dataWords + ecWords;
+			auto message = sent;
+			Corrupt(message, numErasures + numErrors, random, field.size());
+			// report the first numErasures corrupted positions as erasures, the rest stay unknown
+			std::vector<int> erasures;
+			for (int i = 0; i < Size(message) && erasures.size() < numErasures; ++i)
+				if (message[i] != sent[i])
+					erasures.push_back(i);
+			bool success = ReedSolomonDecode(field, message, Size(ecWords), erasures);
+			ASSERT_TRUE(success) << "Decode in " << field << " (" << dataWords.size() << ',' << ecWords.size()
+								 << ") failed with " << numErasures << " erasures and " << numErrors << " errors";
+			message.resize(dataWords.size());
+			ASSERT_EQ(message, dataWords) << "Decode in " << field << " (" << dataWords.size() << ',' << ecWords.size()
+										  << ") failed with " << numErasures << " erasures and " << numErrors << " errors";
+		}
+	}
+
 	void TestEncodeDecode(const GenericGF& field, const std::vector<int>& dataWords, const std::vector<int>& ecWords) {
 		TestEncoder(field, dataWords, ecWords);
 		TestDecoder(field, dataWords, ecWords);
@@ -183,6 +205,24 @@ TEST(ReedSolomonTest, QRCode)
 	TestEncodeDecodeRandom(GenericGF::QRCodeField256(), 220, 35);
 }
 
+TEST(ReedSolomonTest, Erasures)
+{
+	// reuse the real life test cases from above, now filling the full 2 * errors + erasures capacity
+	TestErasureDecoder(GenericGF::DataMatrixField256(),
+		{ 142, 164, 186 }, { 114, 25, 5, 88, 102 });
+	TestErasureDecoder(GenericGF::QRCodeField256(), {
+		0x72, 0x67, 0x2F, 0x77, 0x69, 0x6B, 0x69, 0x2F,
+		0x4D, 0x61, 0x69, 0x6E, 0x5F, 0x50, 0x61, 0x67,
+		0x65, 0x3B, 0x3B, 0x00, 0xEC, 0x11, 0xEC, 0x11,
+		0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11 }, {
+		0xD8, 0xB8, 0xEF, 0x14, 0xEC, 0xD0, 0xCC, 0x85,
+		0x73, 0x40, 0x0B, 0xB5, 0x5A, 0xB8, 0x8B, 0x2E,
+		0x08, 0x62 });
+	TestErasureDecoder(GenericGF::AztecData6(),
+		{ 0x9, 0x32, 0x1, 0x29, 0x2F, 0x2, 0x27, 0x25, 0x1, 0x1B },
+		{ 0x2C, 0x2, 0xD, 0xD, 0xA, 0x16, 0x28, 0x9, 0x22, 0xA, 0x14 });
+}
+
 TEST(ReedSolomonTest, Aztec)
 {
 	// real life test cases
@@ -0,0 +1,67 @@
+/*
+* Copyright 2026 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Barcode.h"
+
+#ifdef ZXING_EXPERIMENTAL_API
+
+#include "DecoderResult.h"
+#include "DetectorResult.h"
+
+#include "gtest/gtest.h"
+
+using namespace ZXing;
+
+static Barcode MakePart(std::string text, int index, int count, std::string id)
+{
+	return Barcode(DecoderResult(Content(ByteArray(text), {})).setStructuredAppend({index, count, std::move(id)}),
+				   DetectorResult(), BarcodeFormat::QRCode);
+}
+
+TEST(StructuredAppendSessionTest, CollectAndMerge)
+{
+	StructuredAppendSession session;
+
+	EXPECT_TRUE(session.add(MakePart("bar", 1, 3, "id")));
+	EXPECT_TRUE(session.takeCompleted().empty());
+	EXPECT_FALSE(session.add(MakePart("bar", 1, 3, "id"))); // same part scanned again in a later frame
+	EXPECT_TRUE(session.add(MakePart("foo", 0, 3, "id")));
+	EXPECT_TRUE(session.add(MakePart("baz", 2, 3, "id")));
+
+	auto res = session.takeCompleted();
+	ASSERT_EQ(res.size(), 1u);
+	EXPECT_EQ(res.front().text(TextMode::Plain), "foobarbaz");
+	EXPECT_FALSE(res.front().isPartOfSequence());
+	EXPECT_TRUE(session.takeCompleted().empty());
+}
+
+TEST(StructuredAppendSessionTest, SeparateSequences)
+{
+	StructuredAppendSession session;
+
+	EXPECT_TRUE(session.add(MakePart("a", 0, 2, "1")));
+	EXPECT_TRUE(session.add(MakePart("c", 0, 2, "2")));
+	EXPECT_TRUE(session.add(MakePart("b", 1, 2, "1")));
+
+	auto res = session.takeCompleted();
+	ASSERT_EQ(res.size(), 1u);
+	EXPECT_EQ(res.front().text(TextMode::Plain), "ab");
+
+	EXPECT_TRUE(session.add(MakePart("d", 1, 2, "2")));
+	res = session.takeCompleted();
+	ASSERT_EQ(res.size(), 1u);
+	EXPECT_EQ(res.front().text(TextMode::Plain), "cd");
+}
+
+TEST(StructuredAppendSessionTest, IgnoreNonSequenceSymbols)
+{
+	StructuredAppendSession session;
+
+	EXPECT_FALSE(session.add(MakePart("foo", -1, -1, "")));
+	EXPECT_FALSE(session.add(Barcode()));
+	EXPECT_TRUE(session.takeCompleted().empty());
+}
+
+#endif // ZXING_EXPERIMENTAL_API
@@ -0,0 +1,114 @@
+/*
+* Copyright 2025 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#include "DecodeCounters.h"
+#include "ReadBarcode.h"
+
+#include "gtest/gtest.h"
+#include <random>
+#include <vector>
+
+using namespace ZXing;
+
+// Adversarial frames (noise, dense text, finder-pattern-like textures) dominate the tail latency of
+// real deployments. These tests generate such frames deterministically and bound the amount of work
+// the pipeline performs on them via the DecodeCounters, so that work-budget regressions in the
+// detectors are caught without relying on flaky wall-clock measurements.
+
+namespace {
+
+constexpr int W = 512, H = 512;
+
+std::vector<uint8_t> UniformNoise(unsigned seed)
+{
+	std::minstd_rand rng(seed);
+	std::vector<uint8_t> img(W * H);
+	for (auto& p : img)
+		p = rng() & 1 ? 0 : 255;
+	return img;
+}
+
+// text-like bands of short black/white runs, a common source of false 1D and finder pattern candidates
+std::vector<uint8_t> DenseText(unsigned seed)
+{
+	std::minstd_rand rng(seed);
+	std::vector<uint8_t> img(W * H, 255);
+	for (int line = 4; line + 10 < H; line += 14)
+		for (int y = line; y < line + 10; ++y)
+			for (int x = 4; x < W - 4;) {
+				int run = 1 + int(rng() % 4);
+				bool black = rng() % 3 != 0;
+				for (int i = 0; i < run && x < W - 4; ++i, ++x)
+					img[y * W + x] = black ? 0 : 255;
+			}
+	return img;
+}
+
+// a regular grid of concentric squares, i.e. hundreds of perfect QR finder patterns: the worst known
+// input for the finder pattern set generation and the sampling stages
+std::vector<uint8_t> FinderPatternGrid()
+{
+	std::vector<uint8_t> img(W * H, 255);
+	for (int by = 8; by + 12 < H; by += 18)
+		for (int bx = 8; bx + 12 < W; bx += 18)
+			for (int y = 0; y < 12; ++y)
+				for (int x = 0; x < 12; ++x)
+					if ((x < 2 || x >= 10 || y < 2 || y >= 10) || (x >= 4 && x < 8 && y >= 4 && y < 8))
+						img[(by + y) * W + (bx + x)] = 0;
+	return img;
+}
+
+std::vector<uint8_t> Checkerboard()
+{
+	std::vector<uint8_t> img(W * H);
+	for (int y = 0; y < H; ++y)
+		for (int x = 0; x < W; ++x)
+			img[y * W + x] = ((x / 2) ^ (y / 2)) & 1 ? 0 : 255;
+	return img;
+}
+
+DecodeCounters ScanCounters(const std::vector<uint8_t>& img)
+{
+	auto opts = ReaderOptions().setTryHarder(true).setTryRotate(true).setTryInvert(true);
+	ReadBarcodes(ImageView(img.data(), W, H, ImageFormat::Lum), opts);
+	return LastDecodeCounters();
+}
+
+} // namespace
+
+TEST(WorstCaseWorkloadTest, UniformNoise)
+{
+	auto c = ScanCounters(UniformNoise(1));
+	EXPECT_LE(c.symbolCandidates, 100);
+	EXPECT_LE(c.gridsSampled, 100);
+	EXPECT_LE(c.rowPatternsScanned, 4000);
+}
+
+TEST(WorstCaseWorkloadTest, DenseText)
+{
+	auto c = ScanCounters(DenseText(2));
+	EXPECT_LE(c.symbolCandidates, 100);
+	EXPECT_LE(c.gridsSampled, 100);
+	EXPECT_LE(c.rowPatternsScanned, 4000);
+}
+
+TEST(WorstCaseWorkloadTest, FinderPatternGrid)
+{
+	// the finder pattern set generation caps itself at 256 sets, make sure the cap holds and the
+	// downstream stages don't multiply the work further (measured: 256 sets, 76 grids, 55 RS calls)
+	auto c = ScanCounters(FinderPatternGrid());
+	EXPECT_LE(c.symbolCandidates, 600);
+	EXPECT_LE(c.gridsSampled, 300);
+	EXPECT_LE(c.rsDecodeCalls, 300);
+	EXPECT_LE(c.rowPatternsScanned, 4000);
+}
+
+TEST(WorstCaseWorkloadTest, Checkerboard)
+{
+	auto c = ScanCounters(Checkerboard());
+	EXPECT_LE(c.symbolCandidates, 100);
+	EXPECT_LE(c.gridsSampled, 100);
+	EXPECT_LE(c.rowPatternsScanned, 4000);
+}
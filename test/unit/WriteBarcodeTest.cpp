@@ -341,4 +341,23 @@ TEST(WriteBarcodeTest, RandomDataBar)
 	randomTest(BarcodeFormat::DataBarExpanded);
 }
 
+TEST(WriteBarcodeTest, CreateBarcodesBatch)
+{
+	std::vector<std::string> texts;
+	for (int i = 0; i < 20; ++i)
+		texts.push_back("batch content " + std::to_string(i));
+	std::vector<std::string_view> views(texts.begin(), texts.end());
+
+	for (int nThreads : {1, 4}) {
+		auto barcodes = CreateBarcodesFromText(views, {BarcodeFormat::QRCode}, nThreads);
+		ASSERT_EQ(barcodes.size(), texts.size());
+		for (size_t i = 0; i < barcodes.size(); ++i) {
+			EXPECT_EQ(barcodes[i].text(TextMode::Plain), texts[i]);
+			EXPECT_TRUE(barcodes[i].symbol().data());
+		}
+	}
+
+	EXPECT_TRUE(CreateBarcodesFromText({}, {BarcodeFormat::QRCode}).empty());
+}
+
 #endif // #if defined(ZXING_EXPERIMENTAL_API) && defined(ZXING_WRITERS) && defined(ZXING_USE_ZINT)
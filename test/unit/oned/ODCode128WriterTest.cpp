@@ -25,6 +25,7 @@ static const std::string START_CODE_B = "11010010000";
 static const std::string START_CODE_C = "11010011100";
 static const std::string SWITCH_CODE_A = "11101011110";
 static const std::string SWITCH_CODE_B = "10111101110";
+static const std::string SHIFT_CODE = "11110100010";
 static const std::string QUIET_SPACE = "00000";
 static const std::string STOP = "1100011101011";
 static const std::string LF = "10000110010";
@@ -125,10 +126,10 @@ TEST(ODCode128Writer, EncodeSwitchCodesetFromAToB)
 
 TEST(ODCode128Writer, EncodeSwitchCodesetFromBToA)
 {
-	// start with B switch to A and back to B
+	// start with B and encode the single "\0" with a SHIFT instead of switching to A and back
 	auto toEncode = std::string("ab\0ab", 5);
-	//                                           "a"             "b"             Switch to A     "\0             "Switch to B"   "a"             "b"             check digit
-	auto expected = QUIET_SPACE + START_CODE_B + "10010110000" + "10010000110" + SWITCH_CODE_A + "10100001100" + SWITCH_CODE_B + "10010110000" + "10010000110" + "11010001110" + STOP + QUIET_SPACE;
+	//                                           "a"             "b"             Shift           "\0"            "a"             "b"             check digit
+	auto expected = QUIET_SPACE + START_CODE_B + "10010110000" + "10010000110" + SHIFT_CODE + "10100001100" + "10010110000" + "10010000110" + "11101100100" + STOP + QUIET_SPACE;
 
 	auto encoded = Code128Writer().encode(toEncode, 0, 0);
 	auto actual = LineMatrixToString(encoded);
@@ -31,6 +31,21 @@ TEST(PDF417HighLevelEncoderTest, EncodeIso88591WithSpecialChars)
 	HighLevelEncoder::EncodeHighLevel(L"asdfg\xA7""asd", Compaction::AUTO, CharacterSet::ISO8859_1);
 }
 
+TEST(PDF417HighLevelEncoderTest, EncodeAutoOptimalSegmentation)
+{
+	// the optimal segmentation may never produce more codewords than the annex P heuristic ...
+	for (auto msg : {L"AB12345678 SMITH JOHN 19850317", L"ABCD", L"1234567890123", L"Mixed case, punct! and 123"}) {
+		auto heuristic = HighLevelEncoder::EncodeHighLevel(msg, Compaction::AUTO, CharacterSet::ISO8859_1);
+		auto optimal = HighLevelEncoder::EncodeHighLevel(msg, Compaction::AUTO, CharacterSet::ISO8859_1, true);
+		EXPECT_LE(optimal.size(), heuristic.size());
+	}
+
+	// ... and beats it on payloads with short alternating runs
+	auto heuristic = HighLevelEncoder::EncodeHighLevel(L"A1B2C3D4E5F6G7H8I9J0", Compaction::AUTO, CharacterSet::ISO8859_1);
+	auto optimal = HighLevelEncoder::EncodeHighLevel(L"A1B2C3D4E5F6G7H8I9J0", Compaction::AUTO, CharacterSet::ISO8859_1, true);
+	EXPECT_LT(optimal.size(), heuristic.size());
+}
+
 TEST(PDF417HighLevelEncoderTest, EncodeText)
 {
 	auto encoded = HighLevelEncoder::EncodeHighLevel(L"ABCD", Compaction::TEXT, CharacterSet::UTF8);
@@ -154,6 +154,25 @@ TEST(QREncoderTest, EncodeWithVersionTooSmall)
 	, std::invalid_argument);
 }
 
+TEST(QREncoderTest, EncodeWithOptimalSegmentation)
+{
+	// The single mode chooser has to fall back to BYTE mode for the whole content, while the
+	// segmented encoder switches to NUMERIC mode for the digit run and fits a smaller version.
+	std::wstring mixed = L"Tel:00498900010002000300040005000600070008";
+	auto heuristic = Encode(mixed, ErrorCorrectionLevel::Medium, CharacterSet::Unknown, 0, false, -1);
+	auto optimal = Encode(mixed, ErrorCorrectionLevel::Medium, CharacterSet::Unknown, 0, false, -1, true);
+	ASSERT_NE(heuristic.version, nullptr);
+	ASSERT_NE(optimal.version, nullptr);
+	EXPECT_LT(optimal.version->versionNumber(), heuristic.version->versionNumber());
+
+	// Single mode content ends up as the same single segment the mode chooser picks.
+	for (auto content : {L"0123456789", L"ABCDEF $%*+-./:"}) {
+		auto a = Encode(content, ErrorCorrectionLevel::High, CharacterSet::Unknown, 0, false, -1);
+		auto b = Encode(content, ErrorCorrectionLevel::High, CharacterSet::Unknown, 0, false, -1, true);
+		EXPECT_EQ(ToString(a.matrix, 'X', ' ', true), ToString(b.matrix, 'X', ' ', true));
+	}
+}
+
 TEST(QREncoderTest, SimpleUTF8ECI)
 {
 	auto qrCode = Encode(L"hello", ErrorCorrectionLevel::High, CharacterSet::UTF8, 0, false, -1);
@@ -0,0 +1,46 @@
+/*
+* Copyright 2026 Axel Waggershauser
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef ZXING_EXPERIMENTAL_API
+
+#include "BitMatrix.h"
+#include "DecoderResult.h"
+#include "DetectorResult.h"
+#include "WriteBarcode.h"
+#include "qrcode/QRDecoder.h"
+
+#include "gtest/gtest.h"
+
+using namespace ZXing;
+
+TEST(QRSoftDecodeTest, WeakModuleRetry)
+{
+	auto barcode = CreateBarcodeFromText("SOFT DECISION TEST 123", CreatorOptions(BarcodeFormat::QRCode));
+	auto symbol = WriteBarcodeToImage(barcode, WriterOptions().withQuietZones(false)); // 1 pixel per module
+	int dim = symbol.width();
+	BitMatrix bits(dim, dim);
+	for (int y = 0; y < dim; ++y)
+		for (int x = 0; x < dim; ++x)
+			bits.set(x, y, *symbol.data(x, y) < 128);
+
+	// flip data modules spread over more codewords than the Reed-Solomon budget can absorb
+	std::vector<PointI> flipped;
+	for (int y = 9; y < dim && Size(flipped) < 8; y += 3)
+		for (int x = 9; x < dim && Size(flipped) < 8; x += 4) {
+			bits.flip(x, y);
+			flipped.push_back({x, y});
+		}
+
+	EXPECT_FALSE(QRCode::Decode(bits).isValid());
+
+	// ... but with the flipped modules marked weak, the soft-decision retry recovers the symbol
+	DetectorResult detRes(bits.copy(), {PointI{0, 0}, {dim, 0}, {dim, dim}, {0, dim}});
+	detRes.setWeakModules(std::move(flipped));
+	auto res = QRCode::Decode(detRes);
+	EXPECT_TRUE(res.isValid());
+	EXPECT_EQ(res.content().utf8(), "SOFT DECISION TEST 123");
+}
+
+#endif // ZXING_EXPERIMENTAL_API
@@ -6,6 +6,7 @@
 #include "ReadBarcode.h"
 
 #include <android/bitmap.h>
+#include <android/hardware_buffer_jni.h>
 #include <android/log.h>
 #include <chrono>
 #include <exception>
@@ -324,6 +325,8 @@ Java_zxingcpp_BarcodeReader_readYBuffer(
 	jint left, jint top, jint width, jint height, jint rotation, jobject options)
 {
 	const uint8_t* pixels = static_cast<uint8_t *>(env->GetDirectBufferAddress(yBuffer));
+	if (!pixels)
+		return ThrowJavaException(env, "Invalid non-direct ByteBuffer");
 
 	auto image =
 		ImageView{pixels + top * rowStride + left, width, height, ImageFormat::Lum, rowStride}
@@ -332,6 +335,60 @@ Java_zxingcpp_BarcodeReader_readYBuffer(
 	return Read(env, thiz, image, CreateReaderOptions(env, options));
 }
 
+extern "C" JNIEXPORT jobject JNICALL
+Java_zxingcpp_BarcodeReader_readHardwareBuffer(
+	JNIEnv* env, jobject thiz, jobject hardwareBuffer, jint rotation, jobject options)
+{
+	// The AHardwareBuffer entry points are weak symbols (see CMakeLists.txt) so this library keeps
+	// loading on pre-26 devices. The kotlin side guards the call accordingly.
+	if (__builtin_available(android 26, *)) {
+		AHardwareBuffer* buffer = AHardwareBuffer_fromHardwareBuffer(env, hardwareBuffer);
+		if (!buffer)
+			return ThrowJavaException(env, "Failed to access native AHardwareBuffer");
+
+		AHardwareBuffer_Desc desc;
+		AHardwareBuffer_describe(buffer, &desc);
+
+		if (desc.format == AHARDWAREBUFFER_FORMAT_Y8Cb8Cr8_420) {
+			if (__builtin_available(android 29, *)) {
+				AHardwareBuffer_Planes planes;
+				if (AHardwareBuffer_lockPlanes(buffer, AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN, -1, nullptr, &planes) != 0)
+					return ThrowJavaException(env, "Failed to lock AHardwareBuffer planes for reading");
+
+				auto image = ImageView{static_cast<const uint8_t*>(planes.planes[0].data), (int)desc.width, (int)desc.height,
+									   ImageFormat::Lum, (int)planes.planes[0].rowStride, (int)planes.planes[0].pixelStride}
+								 .rotated(rotation);
+				auto res = Read(env, thiz, image, CreateReaderOptions(env, options));
+				AHardwareBuffer_unlock(buffer, nullptr);
+				return res;
+			}
+			return ThrowJavaException(env, "YUV AHardwareBuffer requires API level 29");
+		}
+
+		ImageFormat fmt = ImageFormat::None;
+		switch (desc.format) {
+		case AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM:
+		case AHARDWAREBUFFER_FORMAT_R8G8B8X8_UNORM: fmt = ImageFormat::RGBA; break;
+		case AHARDWAREBUFFER_FORMAT_R8G8B8_UNORM: fmt = ImageFormat::RGB; break;
+		case AHARDWAREBUFFER_FORMAT_R8_UNORM: fmt = ImageFormat::Lum; break;
+		default: return ThrowJavaException(env, "Unsupported AHardwareBuffer format");
+		}
+
+		void* pixels = nullptr;
+		if (AHardwareBuffer_lock(buffer, AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN, -1, nullptr, &pixels) != 0)
+			return ThrowJavaException(env, "Failed to lock AHardwareBuffer for reading");
+
+		// desc.stride is in pixels, ImageView expects bytes
+		auto image = ImageView{static_cast<const uint8_t*>(pixels), (int)desc.width, (int)desc.height, fmt,
+							   (int)desc.stride * PixStride(fmt)}
+						 .rotated(rotation);
+		auto res = Read(env, thiz, image, CreateReaderOptions(env, options));
+		AHardwareBuffer_unlock(buffer, nullptr);
+		return res;
+	}
+	return ThrowJavaException(env, "AHardwareBuffer requires API level 26");
+}
+
 struct LockedPixels
 {
 	JNIEnv* env;
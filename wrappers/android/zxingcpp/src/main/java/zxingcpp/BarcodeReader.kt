@@ -9,7 +9,10 @@ import android.graphics.Bitmap
 import android.graphics.ImageFormat
 import android.graphics.Point
 import android.graphics.Rect
+import android.hardware.HardwareBuffer
+import android.media.Image
 import android.os.Build
+import androidx.annotation.RequiresApi
 import androidx.camera.core.ImageProxy
 import java.nio.ByteBuffer
 
@@ -133,6 +136,32 @@ public class BarcodeReader(public var options: Options = Options()) {
 		)
 	}
 
+	// Decodes straight from the GPU/camera buffer without any JNI array round trip. The buffer
+	// has to be CPU readable (e.g. USAGE_CPU_READ_OFTEN) and in one of the formats RGBA_8888,
+	// RGBX_8888, RGB_888, R_8 or (API 29 and later) YCBCR_420_888.
+	@RequiresApi(Build.VERSION_CODES.O)
+	public fun read(hardwareBuffer: HardwareBuffer, rotation: Int = 0): List<Result> =
+		readHardwareBuffer(hardwareBuffer, rotation, options)
+
+	// Decodes an android.media.Image (e.g. from an ImageReader) via its HardwareBuffer if it has
+	// one, falling back to the direct Y plane buffer otherwise.
+	@RequiresApi(Build.VERSION_CODES.P)
+	public fun read(image: Image, rotation: Int = 0): List<Result> {
+		image.hardwareBuffer?.use { buffer ->
+			// YUV buffers can only be locked plane by plane since API 29
+			if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q || buffer.format != HardwareBuffer.YCBCR_420_888)
+				return read(buffer, rotation)
+		}
+		check(image.format in supportedYUVFormats) {
+			"Invalid image format: ${image.format}. Must be one of: $supportedYUVFormats"
+		}
+		return readYBuffer(
+			image.planes[0].buffer, image.planes[0].rowStride,
+			image.cropRect.left, image.cropRect.top, image.cropRect.width(), image.cropRect.height(),
+			rotation, options
+		)
+	}
+
 	private external fun readYBuffer(
 		yBuffer: ByteBuffer, rowStride: Int, left: Int, top: Int, width: Int, height: Int, rotation: Int, options: Options
 	): List<Result>
@@ -140,4 +169,8 @@ public class BarcodeReader(public var options: Options = Options()) {
 	private external fun readBitmap(
 		bitmap: Bitmap, left: Int, top: Int, width: Int, height: Int, rotation: Int, options: Options
 	): List<Result>
+
+	private external fun readHardwareBuffer(
+		buffer: HardwareBuffer, rotation: Int, options: Options
+	): List<Result>
 }
@@ -58,6 +58,27 @@ public class UnitTest1
 		Assert.Equal("", res[0].ErrorMsg);
 	}
 
+	[Fact]
+	public void ReadSpan()
+	{
+		var data = new List<byte>();
+		foreach (var v in "0000101000101101011110111101011011101010100111011100101000100101110010100000")
+			data.Add((byte)(v == '0' ? 255 : 0));
+
+		var br = new BarcodeReader() {
+			Binarizer = Binarizer.BoolCast,
+		};
+		var res = br.From(data.ToArray().AsSpan(), data.Count, 1, ImageFormat.Lum);
+
+		var expected = "96385074";
+
+		Assert.Single(res);
+		Assert.True(res[0].IsValid);
+		Assert.Equal(BarcodeFormats.EAN8, res[0].Format);
+		Assert.Equal(expected, res[0].Text);
+		Assert.True(res[0].BytesView.SequenceEqual(Encoding.ASCII.GetBytes(expected)));
+	}
+
 	[Fact]
 	public void Create()
 	{
@@ -53,6 +53,7 @@ internal class Dll
 
 	[DllImport(DllName)] public static extern IntPtr ZXing_ImageView_new(IntPtr data, int width, int height, ImageFormat format, int rowStride, int pixStride);
 	[DllImport(DllName)] public static extern IntPtr ZXing_ImageView_new_checked(byte[] data, int size, int width, int height, ImageFormat format, int rowStride, int pixStride);
+	[DllImport(DllName)] public static extern unsafe IntPtr ZXing_ImageView_new_checked(byte* data, int size, int width, int height, ImageFormat format, int rowStride, int pixStride);
 	[DllImport(DllName)] public static extern void ZXing_ImageView_delete(IntPtr iv);
 
 	[DllImport(DllName)] public static extern void ZXing_Image_delete(IntPtr img);
@@ -103,6 +104,7 @@ internal class Dll
 	[DllImport(DllName)] public static extern BarcodeFormat ZXing_Barcode_format(IntPtr barcode);
 	[DllImport(DllName)] public static extern ContentType ZXing_Barcode_contentType(IntPtr barcode);
 	[DllImport(DllName)] public static extern IntPtr ZXing_Barcode_bytes(IntPtr barcode, out int len);
+	[DllImport(DllName)] public static extern IntPtr ZXing_Barcode_bytesView(IntPtr barcode, out int len);
 	[DllImport(DllName)] public static extern IntPtr ZXing_Barcode_bytesECI(IntPtr barcode, out int len);
 	[DllImport(DllName)] public static extern IntPtr ZXing_Barcode_text(IntPtr barcode);
 	[DllImport(DllName)] public static extern IntPtr ZXing_Barcode_ecLevel(IntPtr barcode);
@@ -455,6 +457,18 @@ public class Barcode
 	public ContentType ContentType => ZXing_Barcode_contentType(_d);
 	public string Text => MarshalAsString(ZXing_Barcode_text(_d));
 	public byte[] Bytes => MarshalAsBytes(ZXing_Barcode_bytes, _d);
+
+	// Zero-copy view of the raw payload, backed by native memory owned by this Barcode.
+	// Copy the data if it needs to outlive this object.
+	public unsafe ReadOnlySpan<byte> BytesView
+	{
+		get
+		{
+			IntPtr ptr = ZXing_Barcode_bytesView(_d, out int len);
+			return ptr == IntPtr.Zero ? ReadOnlySpan<byte>.Empty : new ReadOnlySpan<byte>((void*)ptr, len);
+		}
+	}
+
 	public byte[] BytesECI => MarshalAsBytes(ZXing_Barcode_bytesECI, _d);
 	public string ECLevel => MarshalAsString(ZXing_Barcode_ecLevel(_d));
 	public string SymbologyIdentifier => MarshalAsString(ZXing_Barcode_symbologyIdentifier(_d));
@@ -493,8 +507,29 @@ public class Barcode
 public class BarcodeReader : ReaderOptions
 {
 	public static Barcode[] Read(ImageView iv, ReaderOptions? opts = null)
+		=> Read(iv._d, opts);
+
+	// Pins the span only for the duration of the call, i.e. no copy and no GCHandle allocation.
+	public static unsafe Barcode[] Read(ReadOnlySpan<byte> data, int width, int height, ImageFormat format,
+										int rowStride = 0, int pixStride = 0, ReaderOptions? opts = null)
 	{
-		var ptr = CheckError(ZXing_ReadBarcodes(iv._d, opts?._d ?? IntPtr.Zero));
+		fixed (byte* bytes = data)
+		{
+			var iv = CheckError(ZXing_ImageView_new_checked(bytes, data.Length, width, height, format, rowStride, pixStride));
+			try
+			{
+				return Read(iv, opts);
+			}
+			finally
+			{
+				ZXing_ImageView_delete(iv);
+			}
+		}
+	}
+
+	private static Barcode[] Read(IntPtr iv, ReaderOptions? opts)
+	{
+		var ptr = CheckError(ZXing_ReadBarcodes(iv, opts?._d ?? IntPtr.Zero));
 
 		// return static empty array if no Barcodes are found, avoiding any managed heap allocation
 		var res = Array.Empty<Barcode>();
@@ -511,6 +546,9 @@ public class BarcodeReader : ReaderOptions
 	}
 
 	public Barcode[] From(ImageView iv) => Read(iv, this);
+
+	public Barcode[] From(ReadOnlySpan<byte> data, int width, int height, ImageFormat format, int rowStride = 0, int pixStride = 0)
+		=> Read(data, width, height, format, rowStride, pixStride, this);
 }
 
 public class BarcodeCreator : CreatorOptions
@@ -58,31 +58,50 @@ ZXIGTIN *getGTIN(const Result &result) {
 - (NSArray<ZXIResult *> *)readCVPixelBuffer:(nonnull CVPixelBufferRef)pixelBuffer
                                       error:(NSError *__autoreleasing _Nullable *)error {
     OSType pixelFormat = CVPixelBufferGetPixelFormatType(pixelBuffer);
+    ImageFormat imageFormat = ImageFormat::None;
 
     // We tried to work with all luminance based formats listed in kCVPixelFormatType
-    // but only the following ones seem to be supported on iOS.
+    // but only the following ones seem to be supported on iOS. For the (bi-)planar YCbCr
+    // formats plane 0 is the luminance plane, the packed RGB variants are handed over as is.
     switch (pixelFormat) {
         case kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
         case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange:
-            NSInteger cols = CVPixelBufferGetWidth(pixelBuffer);
-            NSInteger rows = CVPixelBufferGetHeight(pixelBuffer);
-            NSInteger bytesPerRow = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0);
-            CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
-            const uint8_t * bytes = static_cast<const uint8_t *>(CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0));
-            ImageView imageView = ImageView(
-                                            static_cast<const uint8_t *>(bytes),
-                                            static_cast<int>(cols),
-                                            static_cast<int>(rows),
-                                            ImageFormat::Lum,
-                                            static_cast<int>(bytesPerRow),
-                                            0);
-            NSArray* results = [self readImageView:imageView error:error];
-            CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
-            return results;
+        case kCVPixelFormatType_420YpCbCr8Planar:
+        case kCVPixelFormatType_420YpCbCr8PlanarFullRange:
+        case kCVPixelFormatType_OneComponent8:
+            imageFormat = ImageFormat::Lum; break;
+        case kCVPixelFormatType_32BGRA:
+            imageFormat = ImageFormat::BGRA; break;
+        case kCVPixelFormatType_32RGBA:
+            imageFormat = ImageFormat::RGBA; break;
+        case kCVPixelFormatType_24RGB:
+            imageFormat = ImageFormat::RGB; break;
     }
 
-    // If given pixel format is not a supported type with a luminance channel we just use the
-    // default method
+    if (imageFormat != ImageFormat::None) {
+        NSInteger cols = CVPixelBufferGetWidth(pixelBuffer);
+        NSInteger rows = CVPixelBufferGetHeight(pixelBuffer);
+        bool planar = CVPixelBufferIsPlanar(pixelBuffer);
+        NSInteger bytesPerRow = planar
+            ? CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0)
+            : CVPixelBufferGetBytesPerRow(pixelBuffer);
+        CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        const uint8_t * bytes = static_cast<const uint8_t *>(planar
+            ? CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0)
+            : CVPixelBufferGetBaseAddress(pixelBuffer));
+        ImageView imageView = ImageView(
+                                        bytes,
+                                        static_cast<int>(cols),
+                                        static_cast<int>(rows),
+                                        imageFormat,
+                                        static_cast<int>(bytesPerRow),
+                                        0);
+        NSArray* results = [self readImageView:imageView error:error];
+        CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        return results;
+    }
+
+    // If given pixel format is not a supported type we just use the default method
     return [self readCIImage:[[CIImage alloc] initWithCVImageBuffer:pixelBuffer] error:error];
 }
 
@@ -13,17 +13,34 @@ import kotlin.experimental.ExperimentalNativeApi
 import kotlin.native.ref.createCleaner
 
 @OptIn(ExperimentalForeignApi::class)
-class ImageView(
-	val data: ByteArray,
-	val width: Int,
-	val height: Int,
-	val format: ImageFormat,
-	val rowStride: Int = 0,
-	val pixStride: Int = 0,
-) {
-	private val pinnedData = data.pin()
-	val cValue: CPointer<ZXing_ImageView>? =
-		ZXing_ImageView_new_checked(
+class ImageView {
+	val data: ByteArray?
+	val width: Int
+	val height: Int
+	val format: ImageFormat
+	val rowStride: Int
+	val pixStride: Int
+	val cValue: CPointer<ZXing_ImageView>?
+
+	private val pinnedData: Pinned<ByteArray>?
+
+	/** Pins the ByteArray for the lifetime of this view, the pixels are never copied. */
+	constructor(
+		data: ByteArray,
+		width: Int,
+		height: Int,
+		format: ImageFormat,
+		rowStride: Int = 0,
+		pixStride: Int = 0,
+	) {
+		this.data = data
+		this.width = width
+		this.height = height
+		this.format = format
+		this.rowStride = rowStride
+		this.pixStride = pixStride
+		pinnedData = data.pin()
+		cValue = ZXing_ImageView_new_checked(
 			pinnedData.addressOf(0).reinterpret(),
 			data.size,
 			width,
@@ -32,6 +49,32 @@ class ImageView(
 			rowStride,
 			pixStride
 		)
+	}
+
+	/**
+	 * Zero-copy view of native memory, e.g. a camera or interop buffer already outside the Kotlin
+	 * heap (CVPixelBuffer base address, android.media.Image plane, ...). The strides map straight
+	 * to the underlying ImageView, so planar/padded layouts need no repacking. The caller
+	 * guarantees the memory stays valid while this view (or a session result based on it) is used.
+	 */
+	constructor(
+		data: CPointer<UByteVar>,
+		size: Int,
+		width: Int,
+		height: Int,
+		format: ImageFormat,
+		rowStride: Int = 0,
+		pixStride: Int = 0,
+	) {
+		this.data = null
+		this.width = width
+		this.height = height
+		this.format = format
+		this.rowStride = rowStride
+		this.pixStride = pixStride
+		pinnedData = null
+		cValue = ZXing_ImageView_new_checked(data, size, width, height, format.cValue, rowStride, pixStride)
+	}
 
 	@Suppress("unused")
 	@OptIn(ExperimentalNativeApi::class)
@@ -39,7 +82,7 @@ class ImageView(
 
 	@Suppress("unused")
 	@OptIn(ExperimentalNativeApi::class)
-	private val pinnedDataCleaner = createCleaner(pinnedData) { it.unpin() }
+	private val pinnedDataCleaner = createCleaner(pinnedData) { it?.unpin() }
 }
 
 
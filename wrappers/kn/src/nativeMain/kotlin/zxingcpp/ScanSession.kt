@@ -0,0 +1,81 @@
+/*
+* Copyright 2025 ISNing
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+package zxingcpp
+
+import cnames.structs.ZXing_Barcode
+import cnames.structs.ZXing_Barcodes
+import cnames.structs.ZXing_ScanSession
+import kotlinx.cinterop.*
+import zxingcpp.cinterop.*
+import kotlin.experimental.ExperimentalNativeApi
+import kotlin.native.ref.createCleaner
+
+/**
+ * Scan session for video/camera loops: keeps the internal pipeline buffers and the result set
+ * alive frame to frame, so a steady-state scan() allocates nothing and copies nothing. Results
+ * are returned as views into session-owned memory ([BarcodeView]) and stay valid only until the
+ * next scan() call — read the fields you need to keep (bytes, text, ...) before then.
+ *
+ * A session is not thread safe, use one session per scanning thread.
+ */
+@OptIn(ExperimentalForeignApi::class)
+class ScanSession(opts: ReaderOptions? = null) {
+	val cValue: CPointer<ZXing_ScanSession> = ZXing_ScanSession_new(opts?.cValue)
+		?: throw BarcodeReadingException(ZXing_LastErrorMsg()?.toKStringNullPtrHandledAndFree())
+
+	/** See ScanContext::setFrameDiffThreshold() in ReadBarcode.h */
+	fun setFrameDiffThreshold(threshold: Int) = ZXing_ScanSession_setFrameDiffThreshold(cValue, threshold)
+
+	/** Scan one frame. The returned list is a view into session-owned memory, valid until the
+	 * next scan() call. The [ImageView] pixels are read in place, including the native-pointer
+	 * zero-copy variant. */
+	@Throws(BarcodeReadingException::class)
+	fun scan(imageView: ImageView): List<BarcodeView> =
+		ZXing_ScanSession_scan(cValue, imageView.cValue)?.let { cValues ->
+			List(ZXing_Barcodes_size(cValues)) { BarcodeView(this, ZXing_Barcodes_at(cValues, it)!!) }
+		} ?: throw BarcodeReadingException(ZXing_LastErrorMsg()?.toKStringNullPtrHandledAndFree())
+
+	@Suppress("unused")
+	@OptIn(ExperimentalNativeApi::class)
+	private val cleaner = createCleaner(cValue) { ZXing_ScanSession_delete(it) }
+}
+
+/**
+ * Borrowed view of one barcode in a session's result set, valid until the session's next scan()
+ * call. Accessors read the session-owned data in place; nothing is copied until asked for.
+ */
+@OptIn(ExperimentalForeignApi::class)
+class BarcodeView internal constructor(private val session: ScanSession, val cValue: CPointer<ZXing_Barcode>) {
+	val isValid: Boolean
+		get() = ZXing_Barcode_isValid(cValue)
+	val format: BarcodeFormat
+		get() = ZXing_Barcode_format(cValue).parseIntoBarcodeFormat().first { it != BarcodeFormat.None }
+	val contentType: ContentType
+		get() = ZXing_Barcode_contentType(cValue).toKObject()
+
+	/** The raw bytes, copied out of the session-owned barcode on access. */
+	val bytes: ByteArray?
+		get() = memScoped {
+			val len = alloc<IntVar>()
+			ZXing_Barcode_bytesView(cValue, len.ptr)?.readBytes(len.value)?.takeUnless { it.isEmpty() }
+		}
+
+	/** The text, rendered lazily into session-owned storage and copied into a Kotlin String on
+	 * access; nothing is rendered for barcodes whose text is never read. */
+	val text: String?
+		get() = ZXing_ScanSession_text(session.cValue, cValue)?.toKString()?.ifEmpty { null }
+
+	val position: Position
+		get() = ZXing_Barcode_position(cValue).useContents { toKObject() }
+	val orientation: Int
+		get() = ZXing_Barcode_orientation(cValue)
+	val isInverted: Boolean
+		get() = ZXing_Barcode_isInverted(cValue)
+	val isMirrored: Boolean
+		get() = ZXing_Barcode_isMirrored(cValue)
+	val lineCount: Int
+		get() = ZXing_Barcode_lineCount(cValue)
+}
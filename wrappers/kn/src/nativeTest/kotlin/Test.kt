@@ -39,6 +39,29 @@ class BarcodeReaderTest {
 		assertEquals(1, res.lineCount)
 	}
 
+	@Test
+	@OptIn(ExperimentalNativeApi::class)
+	fun `read barcode via scan session`() {
+		val data = "0000101000101101011110111101011011101010100111011100101000100101110010100000".map {
+			if (it == '0') 255.toByte() else 0.toByte()
+		}
+
+		val iv = ImageView(data.toByteArray(), data.size, 1, ImageFormat.Lum)
+		val session = ScanSession(BarcodeReader().apply {
+			binarizer = Binarizer.BoolCast
+		})
+
+		repeat(3) {
+			val res = session.scan(iv).firstOrNull()
+
+			assertNotNull(res)
+			assert(res.isValid)
+			assertEquals(BarcodeFormat.EAN8, res.format)
+			assertEquals("96385074", res.text)
+			assertContentEquals("96385074".encodeToByteArray(), res.bytes)
+		}
+	}
+
 	@Test
 	@OptIn(ExperimentalNativeApi::class, ExperimentalWriterApi::class)
 	fun `create write and read barcode with text`() {
@@ -131,6 +131,47 @@ class TestReadWrite(unittest.TestCase):
 		self.check_res(zxingcpp.read_barcode(img), format, text)
 		self.check_res(zxingcpp.read_barcode(img[4:40,4:40]), format, text)
 
+	@unittest.skipIf(not has_numpy, "need numpy for read/write tests")
+	def test_write_read_cycle_numpy_strided(self):
+		import numpy as np
+		format = BF.QRCode
+		text = "I have the best words."
+		img = np.array(zxingcpp.write_barcode(format, text, quiet_zone=10))
+
+		# non-contiguous views must decode without a copy: flipped rows/columns and reversed channels
+		self.check_res(zxingcpp.read_barcode(img[::-1, :]), format, text)
+		self.check_res(zxingcpp.read_barcode(img[:, ::-1]), format, text)
+		rgb = np.stack([img, img, img], axis=-1)
+		self.check_res(zxingcpp.read_barcode(rgb), format, text)
+		self.check_res(zxingcpp.read_barcode(rgb[:, :, ::-1]), format, text)
+
+	@unittest.skipIf(not has_numpy, "need numpy for read/write tests")
+	def test_write_read_batch_numpy(self):
+		import numpy as np
+		format = BF.QRCode
+		texts = ["I have the best words.", "I know words.", ""]
+		imgs = [np.array(zxingcpp.write_barcode(format, text)) if text else np.zeros((40, 40), np.uint8)
+				for text in texts]
+
+		results = zxingcpp.read_barcodes_batch(imgs)
+		self.assertEqual(len(results), len(imgs))
+		for text, res in zip(texts, results):
+			if text:
+				self.check_res(res[0], format, text)
+			else:
+				self.assertEqual(res, [])
+
+	@unittest.skipIf(not has_numpy, "need numpy for read/write tests")
+	def test_write_batch_numpy(self):
+		import numpy as np
+		format = BF.QRCode
+		texts = ["I have the best words.", "I know words.", "Believe me."]
+		out = np.zeros((len(texts), 99, 99), np.uint8)
+
+		zxingcpp.write_barcodes_batch(texts, format, 99, 99, out)
+		for text, img in zip(texts, out):
+			self.check_res(zxingcpp.read_barcode(img), format, text)
+
 	@unittest.skipIf(not has_pil, "need PIL for read/write tests")
 	def test_write_read_cycle_pil(self):
 		from PIL import Image
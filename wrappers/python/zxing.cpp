@@ -16,11 +16,15 @@
 #include "WriteBarcode.h"
 #include <bit>
 #else
-#include "BitMatrix.h"
 #include "Matrix.h"
-#include "MultiFormatWriter.h"
 #include <cstring>
 #endif
+#include "BitMatrix.h"
+#include "MultiFormatWriter.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <thread>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -40,29 +44,12 @@ std::ostream& operator<<(std::ostream& os, const Position& points) {
 	return os;
 }
 
-auto read_barcodes_impl(py::object _image, const BarcodeFormats& formats, bool try_rotate, bool try_downscale, TextMode text_mode,
-						Binarizer binarizer, bool is_pure, EanAddOnSymbol ean_add_on_symbol, bool return_errors,
-						uint8_t max_number_of_symbols = 0xff)
+// Parse any of the supported image objects into an ImageView referencing the object's pixel
+// memory without a copy. The caller-provided buffer_info keeps the underlying Py_buffer alive
+// and has to outlive the returned view.
+ImageView as_image_view(py::object _image, py::buffer_info& info)
 {
-	const auto opts = ReaderOptions()
-		.setFormats(formats)
-		.setTryRotate(try_rotate)
-		.setTryDownscale(try_downscale)
-		.setTextMode(text_mode)
-		.setBinarizer(binarizer)
-		.setIsPure(is_pure)
-		.setMaxNumberOfSymbols(max_number_of_symbols)
-		.setEanAddOnSymbol(ean_add_on_symbol)
-		.setReturnErrors(return_errors);
-
-	if (py::isinstance<ImageView>(_image)) {
-		// Disables the GIL during zxing processing (restored automatically upon completion)
-		py::gil_scoped_release release;
-		return ReadBarcodes(_image.cast<ImageView>(), opts);
-	}
-
 	const auto _type = std::string(py::str(py::type::of(_image)));
-	py::buffer_info info;
 	ImageFormat imgfmt = ImageFormat::None;
 	try {
 		if (py::hasattr(_image, "__array_interface__")) {
@@ -162,6 +149,7 @@ auto read_barcodes_impl(py::object _image, const BarcodeFormats& formats, bool t
 	const auto channels = info.ndim == 2 ? 1 : narrow_cast<int>(info.shape[2]);
 	const auto rowStride = narrow_cast<int>(info.strides[0]);
 	const auto pixStride = narrow_cast<int>(info.strides[1]);
+	const auto chanStride = info.ndim == 2 ? 1 : narrow_cast<int>(info.strides[2]);
 	if (imgfmt == ImageFormat::None) {
 		// Assume grayscale or BGR image depending on channels number
 		if (channels == 1)
@@ -172,10 +160,40 @@ auto read_barcodes_impl(py::object _image, const BarcodeFormats& formats, bool t
 			throw py::value_error("Unsupported number of channels for buffer: " + std::to_string(channels));
 	}
 
-	const auto bytes = static_cast<uint8_t*>(info.ptr);
+	auto bytes = static_cast<uint8_t*>(info.ptr);
+	// Accept the common channel-reversed numpy view (e.g. `frame[:, :, ::-1]` to go RGB <-> BGR)
+	// without a copy by pointing at the last channel and flipping the assumed channel order.
+	if (channels == 3 && chanStride == -1) {
+		bytes -= channels - 1;
+		imgfmt = imgfmt == ImageFormat::BGR ? ImageFormat::RGB : imgfmt == ImageFormat::RGB ? ImageFormat::BGR : imgfmt;
+	} else if (channels > 1 && chanStride != 1) {
+		throw py::value_error("Unsupported channel stride for buffer: " + std::to_string(chanStride));
+	}
+
+	return {bytes, width, height, imgfmt, rowStride, pixStride};
+}
+
+auto read_barcodes_impl(py::object _image, const BarcodeFormats& formats, bool try_rotate, bool try_downscale, TextMode text_mode,
+						Binarizer binarizer, bool is_pure, EanAddOnSymbol ean_add_on_symbol, bool return_errors,
+						uint8_t max_number_of_symbols = 0xff)
+{
+	const auto opts = ReaderOptions()
+		.setFormats(formats)
+		.setTryRotate(try_rotate)
+		.setTryDownscale(try_downscale)
+		.setTextMode(text_mode)
+		.setBinarizer(binarizer)
+		.setIsPure(is_pure)
+		.setMaxNumberOfSymbols(max_number_of_symbols)
+		.setEanAddOnSymbol(ean_add_on_symbol)
+		.setReturnErrors(return_errors);
+
+	py::buffer_info info;
+	auto image = py::isinstance<ImageView>(_image) ? _image.cast<ImageView>() : as_image_view(_image, info);
+
 	// Disables the GIL during zxing processing (restored automatically upon completion)
 	py::gil_scoped_release release;
-	return ReadBarcodes({bytes, width, height, imgfmt, rowStride, pixStride}, opts);
+	return ReadBarcodes(image, opts);
 }
 
 std::optional<Barcode> read_barcode(py::object _image, const BarcodeFormats& formats, bool try_rotate, bool try_downscale,
@@ -194,6 +212,35 @@ Barcodes read_barcodes(py::object _image, const BarcodeFormats& formats, bool tr
 							  return_errors);
 }
 
+std::vector<Barcodes> read_barcodes_batch(py::sequence images, const BarcodeFormats& formats, bool try_rotate,
+										  bool try_downscale, TextMode text_mode, Binarizer binarizer, bool is_pure,
+										  EanAddOnSymbol ean_add_on_symbol, bool return_errors, int workers)
+{
+	const auto opts = ReaderOptions()
+		.setFormats(formats)
+		.setTryRotate(try_rotate)
+		.setTryDownscale(try_downscale)
+		.setTextMode(text_mode)
+		.setBinarizer(binarizer)
+		.setIsPure(is_pure)
+		.setEanAddOnSymbol(ean_add_on_symbol)
+		.setReturnErrors(return_errors);
+
+	// Materialize all views up front while holding the GIL; the buffer_infos keep the underlying
+	// Py_buffers alive for the duration of the decode.
+	std::vector<py::buffer_info> infos(images.size());
+	std::vector<ImageView> views;
+	views.reserve(images.size());
+	for (size_t i = 0; i < images.size(); ++i) {
+		auto image = py::reinterpret_borrow<py::object>(images[i]);
+		views.push_back(py::isinstance<ImageView>(image) ? image.cast<ImageView>() : as_image_view(image, infos[i]));
+	}
+
+	// One GIL release covers the whole batch, so the worker pool threads never contend with Python.
+	py::gil_scoped_release release;
+	return ReadBarcodesBatch(views, opts, workers);
+}
+
 #ifdef ZXING_EXPERIMENTAL_API
 
 auto image_view(py::buffer buffer, int width, int height, ImageFormat format, int rowStride, int pixStride)
@@ -232,6 +279,59 @@ std::string write_barcode_to_svg(Barcode barcode, int size_hint, bool with_hrt,
 }
 #endif
 
+void write_barcodes_batch(py::sequence contents, BarcodeFormat format, int width, int height, py::buffer out,
+						  int quiet_zone, int ec_level, int workers)
+{
+	// materialize the contents while holding the GIL
+	struct Item
+	{
+		std::string data;
+		CharacterSet encoding;
+	};
+	std::vector<Item> items;
+	items.reserve(contents.size());
+	for (auto content : contents) {
+		if (py::isinstance<py::str>(content))
+			items.push_back({py::cast<std::string>(content), CharacterSet::UTF8});
+		else if (py::isinstance<py::bytes>(content))
+			items.push_back({py::cast<std::string>(content), CharacterSet::BINARY});
+		else
+			throw py::type_error("Invalid input: only 'str' and 'bytes' supported.");
+	}
+
+	auto info = out.request(true);
+	if (info.format != py::format_descriptor<uint8_t>::format())
+		throw py::type_error("Incompatible buffer format '" + info.format + "': expected a uint8_t array.");
+	if (size_t(info.size) < items.size() * size_t(width) * height)
+		throw py::value_error("Output buffer too small: need " + std::to_string(items.size() * size_t(width) * height)
+							  + " bytes for " + std::to_string(items.size()) + " symbols of " + std::to_string(width) + "x"
+							  + std::to_string(height));
+	auto* dst = static_cast<uint8_t*>(info.ptr);
+
+	// one GIL release covers the whole batch, the workers only touch C++ data and the output buffer
+	py::gil_scoped_release release;
+
+	std::atomic<int> next = 0;
+	auto worker = [&]() {
+		for (int i = next++; i < Size(items); i = next++) {
+			auto bits = MultiFormatWriter(format)
+							.setEncoding(items[i].encoding)
+							.setMargin(quiet_zone)
+							.setEccLevel(ec_level)
+							.encode(items[i].data, width, height);
+			// rasterize straight into this symbol's rows of the output, no intermediate image
+			uint8_t* cell = dst + size_t(i) * width * height;
+			for (int y = 0; y < height; ++y) {
+				const int by = y * bits.height() / height;
+				uint8_t* row = cell + size_t(y) * width;
+				for (int x = 0; x < width; ++x)
+					row[x] = bits.get(x * bits.width() / width, by) ? 0 : 255;
+			}
+		}
+	};
+	RunParallel(std::min(workers ? workers : int(std::thread::hardware_concurrency()), Size(items)), worker);
+}
+
 Image write_barcode(BarcodeFormat format, py::object content, int width, int height, int quiet_zone, int ec_level)
 {
 #ifdef ZXING_EXPERIMENTAL_API
@@ -520,6 +620,28 @@ PYBIND11_MODULE(zxingcpp, m)
 		":rtype: list[zxingcpp.Barcode]\n"
 		":return: a list of Barcodes, the list is empty if none is found"
 	);
+	m.def("read_barcodes_batch", &read_barcodes_batch,
+		py::arg("images"),
+		py::arg("formats") = BarcodeFormats{},
+		py::arg("try_rotate") = true,
+		py::arg("try_downscale") = true,
+		py::arg("text_mode") = TextMode::HRI,
+		py::arg("binarizer") = Binarizer::LocalAverage,
+		py::arg("is_pure") = false,
+		py::arg("ean_add_on_symbol") = EanAddOnSymbol::Ignore,
+		py::arg("return_errors") = false,
+		py::arg("workers") = 0,
+		"Read (decode) barcodes from a sequence of images on an internal worker pool.\n\n"
+		"All images are decoded under a single GIL release, so the per-image binding overhead and\n"
+		"GIL ping-pong of calling read_barcodes in a Python loop is paid only once per batch.\n\n"
+		":type images: list[buffer|numpy.ndarray|PIL.Image.Image]\n"
+		":param images: sequence of image objects to decode, each accepting the same types as read_barcodes.\n"
+		":type workers: int\n"
+		":param workers: number of native worker threads, 0 (the default) means one per core.\n"
+		"  The remaining parameters match read_barcodes.\n"
+		":rtype: list[list[zxingcpp.Barcode]]\n"
+		":return: one list of Barcodes per input image, in input order"
+	);
 	py::class_<Image>(m, "Image", py::buffer_protocol())
 		.def_property_readonly(
 			"__array_interface__",
@@ -609,4 +731,35 @@ PYBIND11_MODULE(zxingcpp, m)
 		":param ec_level: error correction level of the barcode (Used for Aztec, PDF417, and QRCode only).\n"
 		":rtype: zxingcpp.Bitmap\n"
 	);
+	m.def("write_barcodes_batch", &write_barcodes_batch,
+		py::arg("contents"),
+		py::arg("format"),
+		py::arg("width"),
+		py::arg("height"),
+		py::arg("out"),
+		py::arg("quiet_zone") = -1,
+		py::arg("ec_level") = -1,
+		py::arg("workers") = 0,
+		"Write (encode) a batch of texts into barcodes, rendered directly into a preallocated buffer.\n\n"
+		"Symbol i is rasterized (8-bit grayscale, scaled to width x height) straight into bytes\n"
+		"[i*width*height, (i+1)*width*height) of ``out``, e.g. the rows of a numpy array of shape\n"
+		"(n, height, width) and dtype uint8. The whole batch runs on native worker threads under a\n"
+		"single GIL release, so neither per-call binding overhead nor an image copy per symbol is paid.\n\n"
+		":type contents: list[str|bytes]\n"
+		":param contents: the texts/contents of the barcodes, encoded like in write_barcode.\n"
+		":type format: zxing.BarcodeFormat\n"
+		":param format: format of the barcodes to create\n"
+		":type width: int\n"
+		":param width: width (in pixels) of each barcode\n"
+		":type height: int\n"
+		":param height: height (in pixels) of each barcode\n"
+		":type out: buffer|numpy.ndarray\n"
+		":param out: writable uint8 buffer of at least len(contents) * width * height bytes\n"
+		":type quiet_zone: int\n"
+		":param quiet_zone: see write_barcode\n"
+		":type ec_level: int\n"
+		":param ec_level: see write_barcode\n"
+		":type workers: int\n"
+		":param workers: number of native worker threads, 0 (the default) means one per core"
+	);
 }
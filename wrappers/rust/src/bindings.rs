@@ -27,6 +27,11 @@ pub struct ZXing_ReaderOptions {
 }
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
+pub struct ZXing_ScanSession {
+	_unused: [u8; 0],
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
 pub struct ZXing_CreatorOptions {
 	_unused: [u8; 0],
 }
@@ -198,6 +203,12 @@ extern "C" {
 	pub fn ZXing_ReaderOptions_getMinLineCount(opts: *const ZXing_ReaderOptions) -> ::core::ffi::c_int;
 	pub fn ZXing_ReaderOptions_getMaxNumberOfSymbols(opts: *const ZXing_ReaderOptions) -> ::core::ffi::c_int;
 	pub fn ZXing_ReadBarcodes(iv: *const ZXing_ImageView, opts: *const ZXing_ReaderOptions) -> *mut ZXing_Barcodes;
+	pub fn ZXing_ScanSession_new(opts: *const ZXing_ReaderOptions) -> *mut ZXing_ScanSession;
+	pub fn ZXing_ScanSession_delete(session: *mut ZXing_ScanSession);
+	pub fn ZXing_ScanSession_setFrameDiffThreshold(session: *mut ZXing_ScanSession, threshold: ::core::ffi::c_int);
+	pub fn ZXing_ScanSession_scan(session: *mut ZXing_ScanSession, iv: *const ZXing_ImageView) -> *const ZXing_Barcodes;
+	pub fn ZXing_Barcode_bytesView(barcode: *const ZXing_Barcode, len: *mut ::core::ffi::c_int) -> *const u8;
+	pub fn ZXing_ScanSession_text(session: *mut ZXing_ScanSession, barcode: *const ZXing_Barcode) -> *const ::core::ffi::c_char;
 	pub fn ZXing_CreatorOptions_new(format: ZXing_BarcodeFormat) -> *mut ZXing_CreatorOptions;
 	pub fn ZXing_CreatorOptions_delete(opts: *mut ZXing_CreatorOptions);
 	pub fn ZXing_CreatorOptions_setFormat(opts: *mut ZXing_CreatorOptions, format: ZXing_BarcodeFormat);
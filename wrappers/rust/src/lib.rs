@@ -532,6 +532,92 @@ impl BarcodeReader {
 	}
 }
 
+make_zxing_class!(ScanSession, ZXing_ScanSession);
+
+impl ScanSession {
+	pub fn new(opts: &BarcodeReader) -> Result<Self, Error> {
+		let session = unsafe { ZXing_ScanSession_new(opts.0) };
+		last_error_if_null_or!(session, ScanSession(session))
+	}
+
+	pub fn set_frame_diff_threshold(&mut self, threshold: i32) -> &mut Self {
+		unsafe { ZXing_ScanSession_setFrameDiffThreshold(self.0, threshold) };
+		self
+	}
+
+	/// Scan one frame. The result set borrows the session: it stays valid (and the session cannot
+	/// be used again) until it is dropped, and no field is copied out of it unless accessed.
+	pub fn scan<'a, IV>(&mut self, image: IV) -> Result<ScanResults<'_>, Error>
+	where
+		IV: TryInto<ImageView<'a>>,
+		IV::Error: Into<Error>,
+	{
+		let iv_: ImageView = image.try_into().map_err(Into::into)?;
+		let results = unsafe { ZXing_ScanSession_scan(self.0, (iv_.0).0) };
+		last_error_if_null_or!(results, ScanResults { results, session: self })
+	}
+}
+
+/// Borrowed view of a session's scan results, valid until the next `scan()` call.
+pub struct ScanResults<'s> {
+	results: *const ZXing_Barcodes,
+	session: &'s mut ScanSession,
+}
+
+impl ScanResults<'_> {
+	pub fn len(&self) -> usize {
+		unsafe { ZXing_Barcodes_size(self.results) as usize }
+	}
+
+	pub fn is_empty(&self) -> bool {
+		self.len() == 0
+	}
+
+	pub fn barcode(&self, i: usize) -> Option<BarcodeView<'_>> {
+		let barcode = unsafe { ZXing_Barcodes_at(self.results, i as c_int) };
+		(!barcode.is_null()).then_some(BarcodeView(barcode, PhantomData))
+	}
+
+	/// Text of barcode `i`, lazily rendered into session-owned storage: the returned view is only
+	/// valid until the next `text()` call.
+	pub fn text(&mut self, i: usize) -> &str {
+		let barcode = unsafe { ZXing_Barcodes_at(self.results, i as c_int) };
+		let str = match barcode.is_null() {
+			true => std::ptr::null(),
+			false => unsafe { ZXing_ScanSession_text(self.session.0, barcode) },
+		};
+		match str.is_null() {
+			true => "",
+			false => unsafe { CStr::from_ptr(str) }.to_str().unwrap_or_default(),
+		}
+	}
+}
+
+/// Borrowed view of a single barcode inside a [ScanResults], fetching each field on access.
+pub struct BarcodeView<'r>(*const ZXing_Barcode, PhantomData<&'r ScanResults<'r>>);
+
+impl BarcodeView<'_> {
+	getter!(Barcode, isValid, transmute, bool);
+	getter!(Barcode, format, (|f| BarcodeFormats::new(f).unwrap().into_iter().last().unwrap()), BarcodeFormat);
+	getter!(Barcode, contentType, transmute, ContentType);
+	getter!(Barcode, position, transmute, Position);
+	getter!(Barcode, orientation, transmute, i32);
+	getter!(Barcode, hasECI, has_eci, transmute, bool);
+	getter!(Barcode, isInverted, transmute, bool);
+	getter!(Barcode, isMirrored, transmute, bool);
+	getter!(Barcode, lineCount, transmute, i32);
+
+	/// Zero-copy view of the raw payload, borrowed from the result set.
+	pub fn bytes(&self) -> &[u8] {
+		let mut len: c_int = 0;
+		let ptr = unsafe { ZXing_Barcode_bytesView(self.0, &mut len) };
+		match ptr.is_null() || len <= 0 {
+			true => &[],
+			false => unsafe { std::slice::from_raw_parts(ptr, len as usize) },
+		}
+	}
+}
+
 make_zxing_class!(BarcodeCreator, ZXing_CreatorOptions);
 
 impl BarcodeCreator {
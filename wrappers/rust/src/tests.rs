@@ -98,4 +98,30 @@ mod tests {
 		assert!(matches!(res[0].error(), BarcodeError::None()));
 		assert_eq!(res[0].error().to_string(), "");
 	}
+
+	#[test]
+	fn scan_session() {
+		let mut data = Vec::<u8>::new();
+		for v in "0000101000101101011110111101011011101010100111011100101000100101110010100000".chars() {
+			data.push(if v == '0' { 255 } else { 0 });
+		}
+		let expected = "96385074";
+		let reader = read().binarizer(Binarizer::BoolCast);
+		let mut session = ScanSession::new(&reader).unwrap();
+
+		for _frame in 0..2 {
+			let iv = ImageView::from_slice(&data, data.len(), 1, ImageFormat::Lum).unwrap();
+			let mut res = session.scan(&iv).unwrap();
+
+			assert_eq!(res.len(), 1);
+			{
+				let barcode = res.barcode(0).unwrap();
+				assert_eq!(barcode.is_valid(), true);
+				assert_eq!(barcode.format(), BarcodeFormat::EAN8);
+				assert_eq!(barcode.bytes(), expected.as_bytes());
+				assert_eq!(barcode.line_count(), 1);
+			}
+			assert_eq!(res.text(0), expected);
+		}
+	}
 }
@@ -94,6 +94,34 @@ ReadResult readBarcodeFromPixmap(int bufferPtr, int imgWidth, int imgHeight, boo
 	return FirstOrDefault(readBarcodesFromPixmap(bufferPtr, imgWidth, imgHeight, tryHarder, format, 1));
 }
 
+// Persistent frame buffer for camera loops: allocated once on the WASM heap, the JS side writes
+// each frame straight into it (HEAPU8.set) instead of pairing every frame with _malloc/_free.
+std::vector<uint8_t> frameBuffer;
+
+int allocateFrameBuffer(int size)
+{
+	frameBuffer.resize(size);
+	return reinterpret_cast<intptr_t>(frameBuffer.data());
+}
+
+void releaseFrameBuffer()
+{
+	frameBuffer = {};
+}
+
+std::vector<ReadResult> readBarcodesFromFrameBuffer(int imgWidth, int imgHeight, bool tryHarder, std::string format, int maxSymbols)
+{
+	if (frameBuffer.size() < size_t(imgWidth) * imgHeight * 4)
+		return {{"", "", {}, "Frame buffer too small, call allocateFrameBuffer() first"}};
+
+	return readBarcodes({frameBuffer.data(), imgWidth, imgHeight, ImageFormat::RGBA}, tryHarder, format, maxSymbols);
+}
+
+ReadResult readBarcodeFromFrameBuffer(int imgWidth, int imgHeight, bool tryHarder, std::string format)
+{
+	return FirstOrDefault(readBarcodesFromFrameBuffer(imgWidth, imgHeight, tryHarder, format, 1));
+}
+
 EMSCRIPTEN_BINDINGS(BarcodeReader)
 {
 	using namespace emscripten;
@@ -118,7 +146,12 @@ EMSCRIPTEN_BINDINGS(BarcodeReader)
 
 	function("readBarcodeFromImage", &readBarcodeFromImage);
 	function("readBarcodeFromPixmap", &readBarcodeFromPixmap);
+	function("readBarcodeFromFrameBuffer", &readBarcodeFromFrameBuffer);
 
 	function("readBarcodesFromImage", &readBarcodesFromImage);
 	function("readBarcodesFromPixmap", &readBarcodesFromPixmap);
+	function("readBarcodesFromFrameBuffer", &readBarcodesFromFrameBuffer);
+
+	function("allocateFrameBuffer", &allocateFrameBuffer);
+	function("releaseFrameBuffer", &releaseFrameBuffer);
 };
@@ -47,26 +47,33 @@ public:
 	}
 };
 
-WriteResult generateBarcode(std::wstring text, std::string format, std::string encoding, int margin, int width, int height, int eccLevel)
+static ZXing::BitMatrix encodeBarcode(std::wstring text, std::string format, std::string encoding, int margin, int width,
+									  int height, int eccLevel)
 {
 	using namespace ZXing;
-	try {
-		auto barcodeFormat = BarcodeFormatFromString(format);
-		if (barcodeFormat == BarcodeFormat::None)
-			return {"Unsupported format: " + format};
 
-		MultiFormatWriter writer(barcodeFormat);
-		if (margin >= 0)
-			writer.setMargin(margin);
+	auto barcodeFormat = BarcodeFormatFromString(format);
+	if (barcodeFormat == BarcodeFormat::None)
+		throw std::invalid_argument("Unsupported format: " + format);
+
+	MultiFormatWriter writer(barcodeFormat);
+	if (margin >= 0)
+		writer.setMargin(margin);
+
+	CharacterSet charset = CharacterSetFromString(encoding);
+	if (charset != CharacterSet::Unknown)
+		writer.setEncoding(charset);
 
-		CharacterSet charset = CharacterSetFromString(encoding);
-		if (charset != CharacterSet::Unknown)
-			writer.setEncoding(charset);
+	if (eccLevel >= 0 && eccLevel <= 8)
+		writer.setEccLevel(eccLevel);
 
-		if (eccLevel >= 0 && eccLevel <= 8)
-			writer.setEccLevel(eccLevel);
+	return writer.encode(text, width, height);
+}
 
-		auto buffer = ToMatrix<uint8_t>(writer.encode(text, width, height));
+WriteResult generateBarcode(std::wstring text, std::string format, std::string encoding, int margin, int width, int height, int eccLevel)
+{
+	try {
+		auto buffer = ZXing::ToMatrix<uint8_t>(encodeBarcode(text, format, encoding, margin, width, height, eccLevel));
 
 		int len;
 		uint8_t* bytes = stbi_write_png_to_mem(buffer.data(), 0, buffer.width(), buffer.height(), 1, &len);
@@ -81,6 +88,52 @@ WriteResult generateBarcode(std::wstring text, std::string format, std::string e
 	}
 }
 
+// RGBA pixels in the wasm heap, directly usable as an ImageData backing store:
+//   let res = zxing.generateBarcodePixmap(...);
+//   let img = new ImageData(new Uint8ClampedArray(zxing.HEAPU8.buffer, res.pixels.byteOffset, res.pixels.byteLength),
+//                           res.width, res.height);
+//   ctx.putImageData(img, 0, 0);
+// The pixels are written exactly once (no PNG encode, no embind copy), which makes per-keystroke
+// preview regeneration cheap. The view is valid until the result object is .delete()d.
+class PixmapResult
+{
+	std::vector<uint8_t> _pixels;
+	int _width = 0, _height = 0;
+	std::string _error;
+
+public:
+	PixmapResult(const ZXing::BitMatrix& bits) : _pixels(size_t(bits.width()) * bits.height() * 4), _width(bits.width()), _height(bits.height())
+	{
+		auto* dst = reinterpret_cast<uint32_t*>(_pixels.data());
+		for (int y = 0; y < _height; ++y)
+			for (int x = 0; x < _width; ++x)
+				*dst++ = bits.get(x, y) ? 0xff000000 : 0xffffffff; // opaque black / white in RGBA8 (wasm is little endian)
+	}
+	PixmapResult(std::string error) : _error(std::move(error)) {}
+
+	std::string error() const { return _error; }
+	int width() const { return _width; }
+	int height() const { return _height; }
+
+	emscripten::val pixels() const
+	{
+		if (_pixels.empty())
+			return emscripten::val::null();
+		return emscripten::val(emscripten::typed_memory_view(_pixels.size(), _pixels.data()));
+	}
+};
+
+PixmapResult generateBarcodePixmap(std::wstring text, std::string format, std::string encoding, int margin, int width, int height, int eccLevel)
+{
+	try {
+		return {encodeBarcode(text, format, encoding, margin, width, height, eccLevel)};
+	} catch (const std::exception& e) {
+		return {std::string(e.what())};
+	} catch (...) {
+		return {std::string("Unknown error")};
+	}
+}
+
 EMSCRIPTEN_BINDINGS(BarcodeWriter)
 {
 	using namespace emscripten;
@@ -90,5 +143,13 @@ EMSCRIPTEN_BINDINGS(BarcodeWriter)
 	    .property("error", &WriteResult::error)
 	    ;
 
+	class_<PixmapResult>("PixmapResult")
+	    .property("pixels", &PixmapResult::pixels)
+	    .property("width", &PixmapResult::width)
+	    .property("height", &PixmapResult::height)
+	    .property("error", &PixmapResult::error)
+	    ;
+
 	function("generateBarcode", &generateBarcode);
+	function("generateBarcodePixmap", &generateBarcodePixmap);
 }
@@ -1,216 +1,283 @@
-/*
-* Copyright 2016 Nu-book Inc.
-*/
-// SPDX-License-Identifier: Apache-2.0
-
-#if (_MSC_VER >= 1915)
-#define no_init_all deprecated
-#pragma warning(disable : 4996)
-#endif
-
-#include "BarcodeReader.h"
-
-#include "BarcodeFormat.h"
-#include "ReaderOptions.h"
-#include "ReadBarcode.h"
-#include "ReadResult.h"
-#include "Utf.h"
-
-#include <algorithm>
-#include <MemoryBuffer.h>
-#include <stdexcept>
-#include <wrl.h>
-
-using namespace Microsoft::WRL;
-using namespace Windows::Foundation;
-using namespace Windows::Graphics::Imaging;
-
-namespace ZXing {
-
-BarcodeReader::BarcodeReader(bool tryHarder, bool tryRotate, const Platform::Array<BarcodeType>^ types)
-{
-	init(tryHarder, tryRotate, types);
-}
-
-BarcodeReader::BarcodeReader(bool tryHarder, bool tryRotate)
-{
-	init(tryHarder, tryRotate, nullptr);
-}
-
-BarcodeReader::BarcodeReader(bool tryHarder)
-{
-	init(tryHarder, tryHarder, nullptr);
-}
-
-void
-BarcodeReader::init(bool tryHarder, bool tryRotate, const Platform::Array<BarcodeType>^ types)
-{
-	m_opts.reset(new ReaderOptions());
-	m_opts->setTryHarder(tryHarder);
-	m_opts->setTryRotate(tryRotate);
-	m_opts->setTryInvert(tryHarder);
-
-	if (types != nullptr && types->Length > 0) {
-		BarcodeFormats barcodeFormats;
-		for (BarcodeType type : types) {
-			barcodeFormats |= BarcodeReader::ConvertRuntimeToNative(type);
-		}
-		m_opts->setFormats(barcodeFormats);
-	}
-}
-
-BarcodeReader::~BarcodeReader()
-{
-}
-
-BarcodeFormat BarcodeReader::ConvertRuntimeToNative(BarcodeType type)
-{
-	switch (type) {
-	case BarcodeType::AZTEC:
-		return BarcodeFormat::Aztec;
-	case BarcodeType::CODABAR:
-		return BarcodeFormat::Codabar;
-	case BarcodeType::CODE_128:
-		return BarcodeFormat::Code128;
-	case BarcodeType::CODE_39:
-		return BarcodeFormat::Code39;
-	case BarcodeType::CODE_93:
-		return BarcodeFormat::Code93;
-	case BarcodeType::DATA_MATRIX:
-		return BarcodeFormat::DataMatrix;
-	case BarcodeType::EAN_13:
-		return BarcodeFormat::EAN13;
-	case BarcodeType::EAN_8:
-		return BarcodeFormat::EAN8;
-	case BarcodeType::ITF:
-		return BarcodeFormat::ITF;
-	case BarcodeType::MAXICODE:
-		return BarcodeFormat::MaxiCode;
-	case BarcodeType::PDF_417:
-		return BarcodeFormat::PDF417;
-	case BarcodeType::QR_CODE:
-		return BarcodeFormat::QRCode;
-	case BarcodeType::MICRO_QR_CODE:
-		return BarcodeFormat::MicroQRCode;
-	case BarcodeType::RMQR_CODE:
-		return BarcodeFormat::RMQRCode;
-	case BarcodeType::RSS_14:
-		return BarcodeFormat::DataBar;
-	case BarcodeType::RSS_EXPANDED:
-		return BarcodeFormat::DataBarExpanded;
-	case BarcodeType::DATA_BAR_LIMITED:
-		return BarcodeFormat::DataBarLimited;
-	case BarcodeType::DX_FILM_EDGE:
-		return BarcodeFormat::DXFilmEdge;
-	case BarcodeType::UPC_A:
-		return BarcodeFormat::UPCA;
-	case BarcodeType::UPC_E:
-		return BarcodeFormat::UPCE;
-	default:
-		std::wstring typeAsString = type.ToString()->Begin();
-		throw std::invalid_argument("Unknown Barcode Type: " + ToUtf8(typeAsString));
-	}
-}
-
-BarcodeType BarcodeReader::ConvertNativeToRuntime(BarcodeFormat format)
-{
-	switch (format) {
-	case BarcodeFormat::Aztec:
-		return BarcodeType::AZTEC;
-	case BarcodeFormat::Codabar:
-		return BarcodeType::CODABAR;
-	case BarcodeFormat::Code128:
-		return BarcodeType::CODE_128;
-	case BarcodeFormat::Code39:
-		return BarcodeType::CODE_39;
-	case BarcodeFormat::Code93:
-		return BarcodeType::CODE_93;
-	case BarcodeFormat::DataMatrix:
-		return BarcodeType::DATA_MATRIX;
-	case BarcodeFormat::EAN13:
-		return BarcodeType::EAN_13;
-	case BarcodeFormat::EAN8:
-		return BarcodeType::EAN_8;
-	case BarcodeFormat::ITF:
-		return BarcodeType::ITF;
-	case BarcodeFormat::MaxiCode:
-		return BarcodeType::MAXICODE;
-	case BarcodeFormat::PDF417:
-		return BarcodeType::PDF_417;
-	case BarcodeFormat::QRCode:
-		return BarcodeType::QR_CODE;
-	case BarcodeFormat::MicroQRCode:
-		return BarcodeType::MICRO_QR_CODE;
-	case BarcodeFormat::RMQRCode:
-		return BarcodeType::RMQR_CODE;
-	case BarcodeFormat::DataBar:
-		return BarcodeType::RSS_14;
-	case BarcodeFormat::DataBarExpanded:
-		return BarcodeType::RSS_EXPANDED;
-	case BarcodeFormat::DataBarLimited:
-		return BarcodeType::DATA_BAR_LIMITED;
-	case BarcodeFormat::DXFilmEdge:
-		return BarcodeType::DX_FILM_EDGE;
-	case BarcodeFormat::UPCA:
-		return BarcodeType::UPC_A;
-	case BarcodeFormat::UPCE:
-		return BarcodeType::UPC_E;
-	default:
-		throw std::invalid_argument("Unknown Barcode Format ");
-	}
-}
-
-static Platform::String^ ToPlatformString(const std::string& str)
-{
-	std::wstring wstr = FromUtf8(str);
-	return ref new Platform::String(wstr.c_str(), (unsigned)wstr.length());
-}
-
-ReadResult^
-BarcodeReader::Read(SoftwareBitmap^ bitmap, int cropWidth, int cropHeight)
-{
-	try {
-		cropWidth = cropWidth <= 0 ? bitmap->PixelWidth : std::min(bitmap->PixelWidth, cropWidth);
-		cropHeight = cropHeight <= 0 ? bitmap->PixelHeight : std::min(bitmap->PixelHeight, cropHeight);
-		int cropLeft = (bitmap->PixelWidth - cropWidth) / 2;
-		int cropTop = (bitmap->PixelHeight - cropHeight) / 2;
-
-		auto inBuffer = bitmap->LockBuffer(BitmapBufferAccessMode::Read);
-		auto inMemRef = inBuffer->CreateReference();
-		ComPtr<IMemoryBufferByteAccess> inBufferAccess;
-
-		if (SUCCEEDED(ComPtr<IUnknown>(reinterpret_cast<IUnknown*>(inMemRef)).As(&inBufferAccess))) {
-			BYTE* inBytes = nullptr;
-			UINT32 inCapacity = 0;
-			inBufferAccess->GetBuffer(&inBytes, &inCapacity);
-
-			ImageFormat fmt = ImageFormat::None;
-			switch (bitmap->BitmapPixelFormat)
-			{
-			case BitmapPixelFormat::Gray8: fmt = ImageFormat::Lum; break;
-			case BitmapPixelFormat::Bgra8: fmt = ImageFormat::BGRA; break;
-			case BitmapPixelFormat::Rgba8: fmt = ImageFormat::RGBA; break;
-			default:
-				throw std::runtime_error("Unsupported BitmapPixelFormat");
-			}
-
-			auto img = ImageView(inBytes, bitmap->PixelWidth, bitmap->PixelHeight, fmt, inBuffer->GetPlaneDescription(0).Stride)
-						   .cropped(cropLeft, cropTop, cropWidth, cropHeight);
-
-			auto barcode = ReadBarcode(img, *m_opts);
-			if (barcode.isValid()) {
-				return ref new ReadResult(ToPlatformString(ZXing::ToString(barcode.format())), ToPlatformString(barcode.text()), ConvertNativeToRuntime(barcode.format()));
-			}
-		} else {
-			throw std::runtime_error("Failed to read bitmap's data");
-		}
-	}
-	catch (const std::exception& e) {
-		OutputDebugStringA(e.what());
-	}
-	catch (...) {
-	}
-	return nullptr;
-}
-
-} // ZXing
+/*
+* Copyright 2016 Nu-book Inc.
+*/
+// SPDX-License-Identifier: Apache-2.0
+
+#if (_MSC_VER >= 1915)
+#define no_init_all deprecated
+#pragma warning(disable : 4996)
+#endif
+
+#include "BarcodeReader.h"
+
+#include "BarcodeFormat.h"
+#include "ReaderOptions.h"
+#include "ReadBarcode.h"
+#include "ReadResult.h"
+#include "Utf.h"
+
+#include <algorithm>
+#include <d3d11.h>
+#include <MemoryBuffer.h>
+#include <ppltasks.h>
+#include <stdexcept>
+#include <windows.graphics.directx.direct3d11.interop.h>
+#include <wrl.h>
+
+using namespace Microsoft::WRL;
+using namespace Windows::Foundation;
+using namespace Windows::Graphics::Imaging;
+
+namespace ZXing {
+
+BarcodeReader::BarcodeReader(bool tryHarder, bool tryRotate, const Platform::Array<BarcodeType>^ types)
+{
+	init(tryHarder, tryRotate, types);
+}
+
+BarcodeReader::BarcodeReader(bool tryHarder, bool tryRotate)
+{
+	init(tryHarder, tryRotate, nullptr);
+}
+
+BarcodeReader::BarcodeReader(bool tryHarder)
+{
+	init(tryHarder, tryHarder, nullptr);
+}
+
+void
+BarcodeReader::init(bool tryHarder, bool tryRotate, const Platform::Array<BarcodeType>^ types)
+{
+	m_opts.reset(new ReaderOptions());
+	m_opts->setTryHarder(tryHarder);
+	m_opts->setTryRotate(tryRotate);
+	m_opts->setTryInvert(tryHarder);
+
+	if (types != nullptr && types->Length > 0) {
+		BarcodeFormats barcodeFormats;
+		for (BarcodeType type : types) {
+			barcodeFormats |= BarcodeReader::ConvertRuntimeToNative(type);
+		}
+		m_opts->setFormats(barcodeFormats);
+	}
+}
+
+BarcodeReader::~BarcodeReader()
+{
+}
+
+BarcodeFormat BarcodeReader::ConvertRuntimeToNative(BarcodeType type)
+{
+	switch (type) {
+	case BarcodeType::AZTEC:
+		return BarcodeFormat::Aztec;
+	case BarcodeType::CODABAR:
+		return BarcodeFormat::Codabar;
+	case BarcodeType::CODE_128:
+		return BarcodeFormat::Code128;
+	case BarcodeType::CODE_39:
+		return BarcodeFormat::Code39;
+	case BarcodeType::CODE_93:
+		return BarcodeFormat::Code93;
+	case BarcodeType::DATA_MATRIX:
+		return BarcodeFormat::DataMatrix;
+	case BarcodeType::EAN_13:
+		return BarcodeFormat::EAN13;
+	case BarcodeType::EAN_8:
+		return BarcodeFormat::EAN8;
+	case BarcodeType::ITF:
+		return BarcodeFormat::ITF;
+	case BarcodeType::MAXICODE:
+		return BarcodeFormat::MaxiCode;
+	case BarcodeType::PDF_417:
+		return BarcodeFormat::PDF417;
+	case BarcodeType::QR_CODE:
+		return BarcodeFormat::QRCode;
+	case BarcodeType::MICRO_QR_CODE:
+		return BarcodeFormat::MicroQRCode;
+	case BarcodeType::RMQR_CODE:
+		return BarcodeFormat::RMQRCode;
+	case BarcodeType::RSS_14:
+		return BarcodeFormat::DataBar;
+	case BarcodeType::RSS_EXPANDED:
+		return BarcodeFormat::DataBarExpanded;
+	case BarcodeType::DATA_BAR_LIMITED:
+		return BarcodeFormat::DataBarLimited;
+	case BarcodeType::DX_FILM_EDGE:
+		return BarcodeFormat::DXFilmEdge;
+	case BarcodeType::UPC_A:
+		return BarcodeFormat::UPCA;
+	case BarcodeType::UPC_E:
+		return BarcodeFormat::UPCE;
+	default:
+		std::wstring typeAsString = type.ToString()->Begin();
+		throw std::invalid_argument("Unknown Barcode Type: " + ToUtf8(typeAsString));
+	}
+}
+
+BarcodeType BarcodeReader::ConvertNativeToRuntime(BarcodeFormat format)
+{
+	switch (format) {
+	case BarcodeFormat::Aztec:
+		return BarcodeType::AZTEC;
+	case BarcodeFormat::Codabar:
+		return BarcodeType::CODABAR;
+	case BarcodeFormat::Code128:
+		return BarcodeType::CODE_128;
+	case BarcodeFormat::Code39:
+		return BarcodeType::CODE_39;
+	case BarcodeFormat::Code93:
+		return BarcodeType::CODE_93;
+	case BarcodeFormat::DataMatrix:
+		return BarcodeType::DATA_MATRIX;
+	case BarcodeFormat::EAN13:
+		return BarcodeType::EAN_13;
+	case BarcodeFormat::EAN8:
+		return BarcodeType::EAN_8;
+	case BarcodeFormat::ITF:
+		return BarcodeType::ITF;
+	case BarcodeFormat::MaxiCode:
+		return BarcodeType::MAXICODE;
+	case BarcodeFormat::PDF417:
+		return BarcodeType::PDF_417;
+	case BarcodeFormat::QRCode:
+		return BarcodeType::QR_CODE;
+	case BarcodeFormat::MicroQRCode:
+		return BarcodeType::MICRO_QR_CODE;
+	case BarcodeFormat::RMQRCode:
+		return BarcodeType::RMQR_CODE;
+	case BarcodeFormat::DataBar:
+		return BarcodeType::RSS_14;
+	case BarcodeFormat::DataBarExpanded:
+		return BarcodeType::RSS_EXPANDED;
+	case BarcodeFormat::DataBarLimited:
+		return BarcodeType::DATA_BAR_LIMITED;
+	case BarcodeFormat::DXFilmEdge:
+		return BarcodeType::DX_FILM_EDGE;
+	case BarcodeFormat::UPCA:
+		return BarcodeType::UPC_A;
+	case BarcodeFormat::UPCE:
+		return BarcodeType::UPC_E;
+	default:
+		throw std::invalid_argument("Unknown Barcode Format ");
+	}
+}
+
+static Platform::String^ ToPlatformString(const std::string& str)
+{
+	std::wstring wstr = FromUtf8(str);
+	return ref new Platform::String(wstr.c_str(), (unsigned)wstr.length());
+}
+
+// Center-crops an image view to the requested size
+static ImageView CenterCropped(ImageView img, int cropWidth, int cropHeight)
+{
+	cropWidth = cropWidth <= 0 ? img.width() : std::min(img.width(), cropWidth);
+	cropHeight = cropHeight <= 0 ? img.height() : std::min(img.height(), cropHeight);
+	return img.cropped((img.width() - cropWidth) / 2, (img.height() - cropHeight) / 2, cropWidth, cropHeight);
+}
+
+ReadResult^
+BarcodeReader::Read(SoftwareBitmap^ bitmap, int cropWidth, int cropHeight)
+{
+	try {
+		auto inBuffer = bitmap->LockBuffer(BitmapBufferAccessMode::Read);
+		auto inMemRef = inBuffer->CreateReference();
+		ComPtr<IMemoryBufferByteAccess> inBufferAccess;
+
+		if (SUCCEEDED(ComPtr<IUnknown>(reinterpret_cast<IUnknown*>(inMemRef)).As(&inBufferAccess))) {
+			BYTE* inBytes = nullptr;
+			UINT32 inCapacity = 0;
+			inBufferAccess->GetBuffer(&inBytes, &inCapacity);
+
+			int stride = inBuffer->GetPlaneDescription(0).Stride;
+			ImageView img;
+			switch (bitmap->BitmapPixelFormat)
+			{
+			case BitmapPixelFormat::Gray8: img = {inBytes, bitmap->PixelWidth, bitmap->PixelHeight, ImageFormat::Lum, stride}; break;
+			case BitmapPixelFormat::Bgra8: img = {inBytes, bitmap->PixelWidth, bitmap->PixelHeight, ImageFormat::BGRA, stride}; break;
+			case BitmapPixelFormat::Rgba8: img = {inBytes, bitmap->PixelWidth, bitmap->PixelHeight, ImageFormat::RGBA, stride}; break;
+			// the leading Y plane of Nv12 is dense luminance, the interleaved UV plane is simply ignored
+			case BitmapPixelFormat::Nv12:  img = YPlaneView(inBytes, bitmap->PixelWidth, bitmap->PixelHeight, stride); break;
+			// Yuy2 is Y0 U Y1 V: luminance at every even byte, i.e. a Lum view with a pixel stride of 2
+			case BitmapPixelFormat::Yuy2:  img = {inBytes, bitmap->PixelWidth, bitmap->PixelHeight, ImageFormat::Lum, stride, 2}; break;
+			default:
+				throw std::runtime_error("Unsupported BitmapPixelFormat");
+			}
+
+			auto barcode = ReadBarcode(CenterCropped(img, cropWidth, cropHeight), *m_opts);
+			if (barcode.isValid()) {
+				return ref new ReadResult(ToPlatformString(ZXing::ToString(barcode.format())), ToPlatformString(barcode.text()), ConvertNativeToRuntime(barcode.format()));
+			}
+		} else {
+			throw std::runtime_error("Failed to read bitmap's data");
+		}
+	}
+	catch (const std::exception& e) {
+		OutputDebugStringA(e.what());
+	}
+	catch (...) {
+	}
+	return nullptr;
+}
+
+IAsyncOperation<ReadResult^>^
+BarcodeReader::ReadAsync(SoftwareBitmap^ bitmap, int cropWidth, int cropHeight)
+{
+	// the bitmap's buffer is locked inside the task, so neither the caller's thread copies nor
+	// blocks; the caller must not modify the bitmap until the operation completes
+	return concurrency::create_async([this, bitmap, cropWidth, cropHeight] {
+		return Read(bitmap, cropWidth, cropHeight);
+	});
+}
+
+ReadResult^
+BarcodeReader::Read(Windows::Graphics::DirectX::Direct3D11::IDirect3DSurface^ surface, int cropWidth, int cropHeight)
+{
+	try {
+		ComPtr<IDXGISurface> dxgiSurface;
+		if (FAILED(Windows::Graphics::DirectX::Direct3D11::GetDXGIInterface(surface, dxgiSurface.GetAddressOf())))
+			throw std::runtime_error("Failed to get DXGI interface from surface");
+
+		DXGI_SURFACE_DESC desc;
+		dxgiSurface->GetDesc(&desc);
+
+		// Map() requires a CPU-readable (staging) surface like those handed out by MediaFrameReader
+		// when the SharedLowLagPhotoCapture/FrameReader is configured for CPU access
+		DXGI_MAPPED_RECT mapped;
+		if (FAILED(dxgiSurface->Map(&mapped, DXGI_MAP_READ)))
+			throw std::runtime_error("Failed to map Direct3D surface for reading (not a CPU-accessible staging surface?)");
+
+		ReadResult^ result = nullptr;
+		try {
+			ImageView img;
+			switch (desc.Format)
+			{
+			case DXGI_FORMAT_B8G8R8A8_UNORM: img = {mapped.pBits, (int)desc.Width, (int)desc.Height, ImageFormat::BGRA, mapped.Pitch}; break;
+			case DXGI_FORMAT_R8G8B8A8_UNORM: img = {mapped.pBits, (int)desc.Width, (int)desc.Height, ImageFormat::RGBA, mapped.Pitch}; break;
+			case DXGI_FORMAT_NV12:           img = YPlaneView(mapped.pBits, (int)desc.Width, (int)desc.Height, mapped.Pitch); break;
+			case DXGI_FORMAT_R8_UNORM:       img = {mapped.pBits, (int)desc.Width, (int)desc.Height, ImageFormat::Lum, mapped.Pitch}; break;
+			default:
+				throw std::runtime_error("Unsupported DXGI_FORMAT");
+			}
+
+			auto barcode = ReadBarcode(CenterCropped(img, cropWidth, cropHeight), *m_opts);
+			if (barcode.isValid()) {
+				result = ref new ReadResult(ToPlatformString(ZXing::ToString(barcode.format())), ToPlatformString(barcode.text()), ConvertNativeToRuntime(barcode.format()));
+			}
+		} catch (...) {
+			dxgiSurface->Unmap();
+			throw;
+		}
+		dxgiSurface->Unmap();
+		return result;
+	}
+	catch (const std::exception& e) {
+		OutputDebugStringA(e.what());
+	}
+	catch (...) {
+	}
+	return nullptr;
+}
+
+} // ZXing
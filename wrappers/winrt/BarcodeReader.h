@@ -46,6 +46,16 @@ public:
 
 	ReadResult^ Read(Windows::Graphics::Imaging::SoftwareBitmap^ bitmap, int cropWidth, int cropHeight);
 
+	/// Same as Read() but runs on a background thread. The bitmap's buffer is locked there, so no
+	/// pixel copy is made on the caller's (UI/camera) thread either.
+	Windows::Foundation::IAsyncOperation<ReadResult^>^ ReadAsync(Windows::Graphics::Imaging::SoftwareBitmap^ bitmap,
+																 int cropWidth, int cropHeight);
+
+	/// Decode directly from a CPU-readable Direct3D surface (e.g. a staging texture from
+	/// MediaFrameReader). The surface is mapped for read and decoded in place, no copy is made.
+	/// Supports BGRA8, RGBA8, NV12 (luminance plane) and R8 surfaces.
+	ReadResult^ Read(Windows::Graphics::DirectX::Direct3D11::IDirect3DSurface^ surface, int cropWidth, int cropHeight);
+
 private:
 	~BarcodeReader();
 